@@ -3,11 +3,20 @@
 #include <cstring>
 #include <vector>
 #include <tuple>
+#ifndef BUFFER_NO_POOL
+#include "Pool.h"
+#endif
 
 namespace Buffer
 {
     namespace
     {
+        // Default encoder hook: observes nothing and compiles away
+        struct noHook
+        {
+            void operator()(const char*, size_t) const noexcept {}
+        };
+
         template<class, template<class...> class>
         inline constexpr bool isSpecialization = false;
         template<template<class...> class T, class... Args>
@@ -42,15 +51,16 @@ namespace Buffer
         template<typename ...Ts>
         Buffer(const Ts&... Args)
         {
-            data = new char[getSize(Args...)];
-            handleArg(Args...);
+            data = allocate(getSize(Args...));
+            noHook hook;
+            handleArg(hook, Args...);
         }
 
         ~Buffer()
         {
             if (data != nullptr) [[likely]]
             {
-                delete[] data;
+                release(data);
                 data = nullptr;
             }
         }
@@ -73,7 +83,48 @@ namespace Buffer
         [[nodiscard]] const char* GetData() const noexcept { return data; }
         [[nodiscard]] const std::string GetDataAsString() const { return std::string(data, size); }
 
+    protected:
+        // Room reserved around the arguments in the same allocation, for wrappers that frame the payload
+        struct Room
+        {
+            size_t Head = 0;
+            size_t Tail = 0;
+        };
+
+        // Hook(data, size) is called as the arguments are written (after each argument, vector element,
+        // tuple member and string), so it can consume freshly written bytes while they are still in cache.
+        template<typename Hook, typename ...Ts>
+        Buffer(Room Reserved, Hook&& OnWrite, const Ts&... Args)
+        {
+            data = allocate(Reserved.Head + getSize(Args...) + Reserved.Tail);
+            size = Reserved.Head;
+            handleArg(OnWrite, Args...);
+            size += Reserved.Tail;
+        }
+
+        size_t size{ 0 };
+        char* data{ nullptr }; // NOTE: not null terminated
+
     private:
+        // Storage comes from the per-thread Pool unless BUFFER_NO_POOL is defined
+        static char* allocate(size_t Size)
+        {
+#ifdef BUFFER_NO_POOL
+            return new char[Size];
+#else
+            return Pool::Allocate(Size);
+#endif
+        }
+
+        static void release(char* Data) noexcept
+        {
+#ifdef BUFFER_NO_POOL
+            delete[] Data;
+#else
+            Pool::Free(Data);
+#endif
+        }
+
         template<typename T>
         static T retrieveArg(const char* Data, size_t& Cursor)
         {
@@ -132,21 +183,22 @@ namespace Buffer
             return T{};
         }
 
-        void handleArg() {}
-        template <typename First, typename... Rest>
-        void handleArg(const First& first, const Rest&... rest)
+        template <typename Hook>
+        void handleArg(Hook&) {}
+        template <typename Hook, typename First, typename... Rest>
+        void handleArg(Hook& hook, const First& first, const Rest&... rest)
         {
             if constexpr (isVector<First>)
             {
                 data[size++] = static_cast<char>(first.size());
                 for (auto const& d : first) [[likely]]
-                    handleArg(d);
+                    handleArg(hook, d);
             }
             else if constexpr (isTuple<First>)
             {
-                std::apply([this](auto&&... args)
+                std::apply([this, &hook](auto&&... args)
                 {
-                    (handleArg(args), ...);
+                    (handleArg(hook, args), ...);
                 }, first);
             }
             else if constexpr (isString<First>)
@@ -172,7 +224,8 @@ namespace Buffer
                 data[size++] = static_cast<char>(first >> 16 & 0xFF);
                 data[size++] = static_cast<char>(first >> 24 & 0xFF);
             }
-            handleArg(rest...);
+            hook(data, size);
+            handleArg(hook, rest...);
         }
 
         template<typename T>
@@ -206,8 +259,5 @@ namespace Buffer
             ((size += getSizeSimple(args)), ...);
             return size;
         }
-
-        size_t size{ 0 };
-        char* data{ nullptr }; // NOTE: not null terminated
     };
 }
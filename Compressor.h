@@ -0,0 +1,277 @@
+#pragma once
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include "Buffer.h"
+
+namespace Buffer
+{
+    // LZ77-style block compressor using an LZ4-like sequence layout: speed over ratio, no dependency.
+    // Frame: [flags:1][original size:4, little endian][payload]. The payload is stored raw when the input
+    // is under the threshold or doesn't shrink, so Decompress() always accepts what Compress() produced.
+    // Inputs of 4 GiB or more don't fit the header: Compress() throws std::length_error for them.
+    class Compressor
+    {
+    public:
+        enum Flags : unsigned char
+        {
+            Raw = 0x00,
+            LZ = 0x01,
+        };
+
+        static constexpr size_t HeaderSize = 5;
+        static constexpr size_t DefaultThreshold = 256;
+
+        static std::string Compress(const char* Data, size_t Size, size_t Threshold = DefaultThreshold)
+        {
+            if (Size > maxOriginalSize) [[unlikely]]
+                throw std::length_error("Compressor: input of 4 GiB or more");
+            std::string output;
+            if (Size >= Threshold && Size >= minInput) [[likely]]
+            {
+                output.resize(HeaderSize + maxCompressedSize(Size));
+                size_t written = compressBlock(reinterpret_cast<const unsigned char*>(Data), Size,
+                    reinterpret_cast<unsigned char*>(output.data() + HeaderSize));
+                if (written < Size) [[likely]]
+                {
+                    writeHeader(output.data(), LZ, Size);
+                    output.resize(HeaderSize + written);
+                    return output;
+                }
+            }
+            output.resize(HeaderSize + Size);
+            writeHeader(output.data(), Raw, Size);
+            if (Size != 0)
+                memcpy(output.data() + HeaderSize, Data, Size);
+            return output;
+        }
+
+        static std::string Compress(const Buffer& Buf, size_t Threshold = DefaultThreshold)
+        {
+            return Compress(Buf.GetData(), Buf.GetSize(), Threshold);
+        }
+
+        // Compresses several finished Buffers as one frame; decompressing yields their concatenation.
+        template<typename... Bs>
+        static std::string CompressBatch(const Bs&... Bufs)
+        {
+            std::string joined;
+            joined.reserve((Bufs.GetSize() + ... + 0));
+            (joined.append(Bufs.GetData(), Bufs.GetSize()), ...);
+            return Compress(joined.data(), joined.size());
+        }
+
+        [[nodiscard]] static std::optional<std::string> Decompress(const char* Data, size_t Size)
+        {
+            if (Size < HeaderSize) [[unlikely]]
+                return std::nullopt;
+
+            const unsigned char* d = reinterpret_cast<const unsigned char*>(Data);
+            size_t originalSize = static_cast<size_t>(
+                (static_cast<uint32_t>(d[4]) << 24) |
+                (static_cast<uint32_t>(d[3]) << 16) |
+                (static_cast<uint32_t>(d[2]) << 8) |
+                (static_cast<uint32_t>(d[1])));
+
+            if (d[0] == Raw)
+            {
+                if (Size - HeaderSize != originalSize) [[unlikely]]
+                    return std::nullopt;
+                return std::string(Data + HeaderSize, originalSize);
+            }
+            if (d[0] == LZ)
+            {
+                // The size comes from the frame: don't allocate more than the payload can expand to
+                if (originalSize > maxDecompressedSize(Size - HeaderSize)) [[unlikely]]
+                    return std::nullopt;
+                std::string output(originalSize, '\0');
+                if (!decompressBlock(d + HeaderSize, Size - HeaderSize,
+                    reinterpret_cast<unsigned char*>(output.data()), originalSize)) [[unlikely]]
+                    return std::nullopt;
+                return output;
+            }
+            return std::nullopt;
+        }
+
+        [[nodiscard]] static std::optional<std::string> Decompress(const std::string& Frame)
+        {
+            return Decompress(Frame.data(), Frame.size());
+        }
+
+        [[nodiscard]] static bool IsCompressed(const char* Data, size_t Size) noexcept
+        {
+            return Size >= HeaderSize && static_cast<unsigned char>(Data[0]) == LZ;
+        }
+
+    private:
+        static constexpr size_t minMatch = 4;
+        static constexpr size_t lastLiterals = 5; // a match never covers the tail, so the decoder ends on literals
+        static constexpr size_t matchSearchLimit = 12;
+        static constexpr size_t minInput = matchSearchLimit + 1;
+        static constexpr size_t maxOffset = 65535;
+        static constexpr unsigned hashLog = 12;
+        static constexpr unsigned skipTrigger = 6; // speeds up the scan through incompressible data
+
+        static constexpr size_t maxOriginalSize = UINT32_MAX;
+
+        static constexpr size_t maxCompressedSize(size_t Size) noexcept { return Size + Size / 255 + 16; }
+        // A payload byte yields at most 255 output bytes: a match length byte. Shorter sequences yield less.
+        static constexpr size_t maxDecompressedSize(size_t PayloadSize) noexcept
+        {
+            return PayloadSize > maxOriginalSize / 255 ? maxOriginalSize : PayloadSize * 255;
+        }
+
+        static void writeHeader(char* Out, Flags Flag, size_t OriginalSize) noexcept
+        {
+            Out[0] = static_cast<char>(Flag);
+            Out[1] = static_cast<char>(OriginalSize & 0xFF);
+            Out[2] = static_cast<char>(OriginalSize >> 8 & 0xFF);
+            Out[3] = static_cast<char>(OriginalSize >> 16 & 0xFF);
+            Out[4] = static_cast<char>(OriginalSize >> 24 & 0xFF);
+        }
+
+        static uint32_t read32(const unsigned char* P) noexcept
+        {
+            uint32_t v;
+            memcpy(&v, P, sizeof v);
+            return v;
+        }
+
+        static uint32_t hash(uint32_t Sequence) noexcept
+        {
+            return (Sequence * 2654435761u) >> (32 - hashLog);
+        }
+
+        static unsigned char* writeLength(unsigned char* Op, size_t Length) noexcept
+        {
+            for (; Length >= 255; Length -= 255) [[unlikely]]
+                *Op++ = 255;
+            *Op++ = static_cast<unsigned char>(Length);
+            return Op;
+        }
+
+        static unsigned char* writeSequence(unsigned char* Op, const unsigned char* Literals, size_t LiteralLength,
+            size_t Offset, size_t MatchLength) noexcept
+        {
+            unsigned char* token = Op++;
+            size_t matchCode = MatchLength - minMatch;
+            *token = static_cast<unsigned char>(((LiteralLength < 15 ? LiteralLength : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+            if (LiteralLength >= 15)
+                Op = writeLength(Op, LiteralLength - 15);
+            memcpy(Op, Literals, LiteralLength);
+            Op += LiteralLength;
+            *Op++ = static_cast<unsigned char>(Offset & 0xFF);
+            *Op++ = static_cast<unsigned char>(Offset >> 8 & 0xFF);
+            if (matchCode >= 15)
+                Op = writeLength(Op, matchCode - 15);
+            return Op;
+        }
+
+        static size_t compressBlock(const unsigned char* Src, size_t Size, unsigned char* Dst) noexcept
+        {
+            uint32_t table[1 << hashLog] = {};
+            unsigned char* op = Dst;
+            size_t anchor = 0, ip = 0;
+            const size_t matchEnd = Size - lastLiterals;
+            const size_t searchEnd = Size - matchSearchLimit;
+
+            while (ip < searchEnd) [[likely]]
+            {
+                uint32_t sequence = read32(Src + ip);
+                uint32_t h = hash(sequence);
+                size_t ref = table[h];
+                table[h] = static_cast<uint32_t>(ip);
+
+                if (ref >= ip || ip - ref > maxOffset || read32(Src + ref) != sequence)
+                {
+                    ip += 1 + ((ip - anchor) >> skipTrigger);
+                    continue;
+                }
+
+                while (ip > anchor && ref > 0 && Src[ip - 1] == Src[ref - 1]) [[unlikely]]
+                {
+                    ip--;
+                    ref--;
+                }
+
+                size_t length = minMatch;
+                while (ip + length < matchEnd && Src[ref + length] == Src[ip + length]) [[likely]]
+                    length++;
+
+                op = writeSequence(op, Src + anchor, ip - anchor, ip - ref, length);
+                ip += length;
+                anchor = ip;
+            }
+
+            size_t literalLength = Size - anchor;
+            *op++ = static_cast<unsigned char>((literalLength < 15 ? literalLength : 15) << 4);
+            if (literalLength >= 15)
+                op = writeLength(op, literalLength - 15);
+            memcpy(op, Src + anchor, literalLength);
+            op += literalLength;
+            return static_cast<size_t>(op - Dst);
+        }
+
+        static bool readLength(const unsigned char* Src, size_t Size, size_t& Ip, size_t& Length) noexcept
+        {
+            unsigned char s;
+            do
+            {
+                if (Ip >= Size) [[unlikely]]
+                    return false;
+                s = Src[Ip++];
+                Length += s;
+            } while (s == 255);
+            return true;
+        }
+
+        // Every read and write is bounds checked: frames can come from the network.
+        static bool decompressBlock(const unsigned char* Src, size_t Size, unsigned char* Dst, size_t DstSize) noexcept
+        {
+            size_t ip = 0, op = 0;
+            while (true)
+            {
+                if (ip >= Size) [[unlikely]]
+                    return false;
+                unsigned char token = Src[ip++];
+
+                size_t literalLength = token >> 4;
+                if (literalLength == 15 && !readLength(Src, Size, ip, literalLength)) [[unlikely]]
+                    return false;
+                if (literalLength > Size - ip || literalLength > DstSize - op) [[unlikely]]
+                    return false;
+                memcpy(Dst + op, Src + ip, literalLength);
+                ip += literalLength;
+                op += literalLength;
+
+                if (ip == Size)
+                    return op == DstSize;
+
+                if (Size - ip < 2) [[unlikely]]
+                    return false;
+                size_t offset = static_cast<size_t>(Src[ip] | (Src[ip + 1] << 8));
+                ip += 2;
+                if (offset == 0 || offset > op) [[unlikely]]
+                    return false;
+
+                size_t matchLength = token & 15;
+                if (matchLength == 15 && !readLength(Src, Size, ip, matchLength)) [[unlikely]]
+                    return false;
+                matchLength += minMatch;
+                if (matchLength > DstSize - op) [[unlikely]]
+                    return false;
+
+                // An overlapping match repeats the last `offset` bytes: copy it in offset-sized chunks
+                for (size_t copied = 0; copied < matchLength;)
+                {
+                    size_t chunk = matchLength - copied < offset ? matchLength - copied : offset;
+                    memcpy(Dst + op + copied, Dst + op + copied - offset, chunk);
+                    copied += chunk;
+                }
+                op += matchLength;
+            }
+        }
+    };
+}
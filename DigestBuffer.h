@@ -0,0 +1,172 @@
+#pragma once
+#include <array>
+#include <cstring>
+#include <cstdint>
+#include <optional>
+#include <sodium.h>
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+#include "Buffer.h"
+
+namespace Buffer
+{
+    // Unkeyed BLAKE2b-256 through libsodium's incremental crypto_generichash API
+    class Blake2bDigest
+    {
+    public:
+        static constexpr size_t Size = crypto_generichash_BYTES;
+
+        Blake2bDigest() noexcept { crypto_generichash_init(&state, nullptr, 0, Size); }
+
+        void Update(const char* Data, size_t DataSize) noexcept
+        {
+            crypto_generichash_update(&state, reinterpret_cast<const unsigned char*>(Data), DataSize);
+        }
+
+        void Final(unsigned char* Out) noexcept { crypto_generichash_final(&state, Out, Size); }
+
+    private:
+        crypto_generichash_state state;
+    };
+
+    // CRC32C (Castagnoli), with the SSE4.2 crc32 instruction when the CPU has it
+    class Crc32cDigest
+    {
+    public:
+        static constexpr size_t Size = 4;
+
+        void Update(const char* Data, size_t DataSize) noexcept
+        {
+            const unsigned char* d = reinterpret_cast<const unsigned char*>(Data);
+#if defined(__x86_64__)
+            if (hasHardware) [[likely]]
+            {
+                crc = updateHardware(crc, d, DataSize);
+                return;
+            }
+#endif
+            crc = updateSoftware(crc, d, DataSize);
+        }
+
+        void Final(unsigned char* Out) noexcept
+        {
+            uint32_t value = ~crc;
+            Out[0] = static_cast<unsigned char>(value & 0xFF);
+            Out[1] = static_cast<unsigned char>(value >> 8 & 0xFF);
+            Out[2] = static_cast<unsigned char>(value >> 16 & 0xFF);
+            Out[3] = static_cast<unsigned char>(value >> 24 & 0xFF);
+        }
+
+    private:
+        static constexpr std::array<uint32_t, 256> table = []()
+        {
+            std::array<uint32_t, 256> t{};
+            for (uint32_t i = 0; i < 256; i++)
+            {
+                uint32_t c = i;
+                for (int k = 0; k < 8; k++)
+                    c = (c >> 1) ^ (0x82F63B78u & (0u - (c & 1)));
+                t[i] = c;
+            }
+            return t;
+        }();
+
+        static uint32_t updateSoftware(uint32_t Crc, const unsigned char* Data, size_t DataSize) noexcept
+        {
+            while (DataSize--)
+                Crc = (Crc >> 8) ^ table[(Crc ^ *Data++) & 0xFF];
+            return Crc;
+        }
+
+#if defined(__x86_64__)
+        inline static const bool hasHardware = __builtin_cpu_supports("sse4.2");
+
+        __attribute__((target("sse4.2")))
+        static uint32_t updateHardware(uint32_t Crc, const unsigned char* Data, size_t DataSize) noexcept
+        {
+            uint64_t c = Crc;
+            for (; DataSize >= 8; DataSize -= 8, Data += 8) [[likely]]
+            {
+                uint64_t v;
+                memcpy(&v, Data, sizeof v);
+                c = _mm_crc32_u64(c, v);
+            }
+            uint32_t c32 = static_cast<uint32_t>(c);
+            while (DataSize--)
+                c32 = _mm_crc32_u8(c32, *Data++);
+            return c32;
+        }
+#endif
+
+        uint32_t crc{ 0xFFFFFFFFu };
+    };
+
+    // A Buffer followed by a digest of its bytes. The digest is folded in while the arguments are encoded,
+    // ChunkSize bytes or more at a time while they are still in cache; only the last, shorter run is hashed
+    // once the Buffer is finished.
+    // Layout: [arguments][digest]; Digest is Blake2bDigest, Crc32cDigest or anything with Size/Update/Final.
+    template<typename Digest>
+    class DigestBuffer : public Buffer
+    {
+    public:
+        static constexpr size_t DigestSize = Digest::Size;
+        static constexpr size_t ChunkSize = 256;
+
+        template<typename ...Ts>
+        DigestBuffer(const Ts&... Args)
+            : DigestBuffer(sealTag{}, pendingDigest{}, Args...)
+        {}
+
+        [[nodiscard]] size_t GetPayloadSize() const noexcept { return size - DigestSize; }
+        [[nodiscard]] const unsigned char* GetDigest() const noexcept { return reinterpret_cast<const unsigned char*>(data + GetPayloadSize()); }
+
+        [[nodiscard]] static bool Verify(const char* Data, size_t Size) noexcept
+        {
+            if (Size < DigestSize) [[unlikely]]
+                return false;
+            unsigned char expected[DigestSize];
+            Digest digest;
+            digest.Update(Data, Size - DigestSize);
+            digest.Final(expected);
+            return sodium_memcmp(expected, Data + Size - DigestSize, DigestSize) == 0;
+        }
+
+        // Decodes T only if the digest matches the bytes it covers
+        template<typename T>
+        [[nodiscard]] static std::optional<T> GetVerifiedArguments(const char* Data, size_t Size)
+        {
+            if (!Verify(Data, Size)) [[unlikely]]
+                return std::nullopt;
+            return GetArguments<T>(Data);
+        }
+
+    private:
+        struct sealTag {};
+
+        // Hashes whole chunks as the encoder produces them; the constructor hashes the remainder
+        struct pendingDigest
+        {
+            Digest digest;
+            size_t consumed = 0;
+
+            void operator()(const char* Data, size_t Size) noexcept
+            {
+                if (Size - consumed >= ChunkSize) [[unlikely]]
+                {
+                    digest.Update(Data + consumed, Size - consumed);
+                    consumed = Size;
+                }
+            }
+        };
+
+        template<typename ...Ts>
+        DigestBuffer(sealTag, pendingDigest&& Pending, const Ts&... Args)
+            : Buffer(Room{ 0, DigestSize }, Pending, Args...)
+        {
+            size_t payloadSize = GetPayloadSize();
+            Pending.digest.Update(data + Pending.consumed, payloadSize - Pending.consumed);
+            Pending.digest.Final(reinterpret_cast<unsigned char*>(data + payloadSize));
+        }
+    };
+}
@@ -0,0 +1,212 @@
+#pragma once
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace Buffer
+{
+    // Size-class memory pool for Buffer storage with one cache per thread.
+    // A block freed by the thread that allocated it goes back to that thread's free list without any
+    // synchronisation. A block freed by another thread is pushed onto the owner's lock-free remote stack,
+    // which the owner drains when its own list runs dry, so producer/consumer pipelines don't contend on
+    // the global allocator. Caches of exited threads are kept and handed to the next new thread.
+    class Pool
+    {
+    public:
+        static constexpr size_t MinBlockSize = 32;
+        static constexpr size_t ClassCount = 12; // 32 B to 64 KiB blocks, header included
+        static constexpr size_t MaxBlockSize = MinBlockSize << (ClassCount - 1);
+        static constexpr size_t HeaderSize = 16;
+
+        [[nodiscard]] static char* Allocate(size_t Size)
+        {
+            size_t sizeClass = classOf(Size + HeaderSize);
+            threadCache* cache = sizeClass < ClassCount ? localCache() : nullptr;
+            if (cache == nullptr) [[unlikely]]
+                return makeBlock(nullptr, largeClass, Size + HeaderSize);
+
+            freeBlock* block = cache->local[sizeClass];
+            if (block == nullptr) [[unlikely]]
+            {
+                cache->drainRemote();
+                block = cache->local[sizeClass];
+                if (block == nullptr)
+                    return makeBlock(cache, sizeClass, MinBlockSize << sizeClass);
+            }
+            cache->local[sizeClass] = block->next;
+            cache->localCount[sizeClass]--;
+            reinterpret_cast<blockHeader*>(block)->owner = cache;
+            return reinterpret_cast<char*>(block) + HeaderSize;
+        }
+
+        static void Free(char* Data) noexcept
+        {
+            if (Data == nullptr) [[unlikely]]
+                return;
+            blockHeader* header = reinterpret_cast<blockHeader*>(Data - HeaderSize);
+            threadCache* owner = header->owner;
+            if (owner == nullptr) [[unlikely]]
+            {
+                ::operator delete(header);
+                return;
+            }
+            if (owner == current) [[likely]]
+                owner->pushLocal(header);
+            else
+                owner->pushRemote(header);
+        }
+
+        // Blocks cached by the calling thread for the class serving Size bytes, remote frees not yet drained excluded
+        [[nodiscard]] static size_t GetCachedCount(size_t Size) noexcept
+        {
+            size_t sizeClass = classOf(Size + HeaderSize);
+            threadCache* cache = localCache();
+            return cache != nullptr && sizeClass < ClassCount ? cache->localCount[sizeClass] : 0;
+        }
+
+    private:
+        static constexpr uint32_t largeClass = ClassCount;
+
+        struct threadCache;
+
+        struct blockHeader
+        {
+            threadCache* owner;
+            uint32_t sizeClass;
+        };
+        static_assert(sizeof(blockHeader) <= HeaderSize);
+
+        // A free block reuses its header: the class stays, the owner slot becomes the link
+        struct freeBlock
+        {
+            freeBlock* next;
+            uint32_t sizeClass;
+        };
+        static_assert(sizeof(freeBlock) == sizeof(blockHeader));
+
+        struct alignas(64) threadCache
+        {
+            freeBlock* local[ClassCount] = {};
+            uint32_t localCount[ClassCount] = {};
+            alignas(64) std::atomic<freeBlock*> remote{ nullptr }; // written by other threads: own cache line
+
+            // 256 blocks up to 512 B, then halving with the block size: at most 128 KiB per class
+            static constexpr uint32_t capacity(size_t SizeClass) noexcept
+            {
+                return 256u >> (SizeClass > 4 ? SizeClass - 4 : 0);
+            }
+
+            void pushLocal(blockHeader* Header) noexcept
+            {
+                uint32_t sizeClass = Header->sizeClass;
+                if (localCount[sizeClass] >= capacity(sizeClass)) [[unlikely]]
+                {
+                    ::operator delete(Header);
+                    return;
+                }
+                freeBlock* block = reinterpret_cast<freeBlock*>(Header);
+                block->next = local[sizeClass];
+                local[sizeClass] = block;
+                localCount[sizeClass]++;
+            }
+
+            void pushRemote(blockHeader* Header) noexcept
+            {
+                freeBlock* block = reinterpret_cast<freeBlock*>(Header);
+                freeBlock* head = remote.load(std::memory_order_relaxed);
+                do
+                    block->next = head;
+                while (!remote.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            void drainRemote() noexcept
+            {
+                if (remote.load(std::memory_order_relaxed) == nullptr)
+                    return;
+                freeBlock* block = remote.exchange(nullptr, std::memory_order_acquire);
+                while (block != nullptr)
+                {
+                    freeBlock* next = block->next;
+                    pushLocal(reinterpret_cast<blockHeader*>(block));
+                    block = next;
+                }
+            }
+        };
+
+        // Hands caches from exited threads to new ones; only touched at thread start and exit.
+        // Leaked on purpose so frees during static destruction still find their owner.
+        struct registry
+        {
+            std::mutex lock;
+            std::vector<threadCache*> orphans;
+        };
+
+        static registry& getRegistry()
+        {
+            static registry* instance = new registry;
+            return *instance;
+        }
+
+        struct cacheLease
+        {
+            cacheLease()
+            {
+                registry& reg = getRegistry();
+                {
+                    std::lock_guard<std::mutex> guard(reg.lock);
+                    if (!reg.orphans.empty())
+                    {
+                        current = reg.orphans.back();
+                        reg.orphans.pop_back();
+                    }
+                }
+                if (current == nullptr)
+                    current = new threadCache;
+            }
+
+            ~cacheLease()
+            {
+                threadCache* cache = current;
+                current = nullptr;
+                retired = true;
+                registry& reg = getRegistry();
+                std::lock_guard<std::mutex> guard(reg.lock);
+                reg.orphans.push_back(cache);
+            }
+        };
+
+        inline static thread_local threadCache* current = nullptr;
+        inline static thread_local bool retired = false;
+
+        static threadCache* localCache()
+        {
+            if (current != nullptr) [[likely]]
+                return current;
+            if (retired) // thread is exiting: fall back to unpooled blocks
+                return nullptr;
+            static thread_local cacheLease lease;
+            return current;
+        }
+
+        // Index of the smallest class holding BlockSize, ClassCount when none does
+        static constexpr size_t classOf(size_t BlockSize) noexcept
+        {
+            if (BlockSize <= MinBlockSize)
+                return 0;
+            size_t sizeClass = std::bit_width(BlockSize - 1) - std::bit_width(MinBlockSize - 1);
+            return sizeClass < ClassCount ? sizeClass : ClassCount;
+        }
+
+        static char* makeBlock(threadCache* Owner, uint32_t SizeClass, size_t BlockSize)
+        {
+            blockHeader* header = static_cast<blockHeader*>(::operator new(BlockSize));
+            header->owner = Owner;
+            header->sizeClass = SizeClass;
+            return reinterpret_cast<char*>(header) + HeaderSize;
+        }
+    };
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include <sodium.h>
+#include "Buffer.h"
+
+namespace Buffer
+{
+    // A Buffer sized with room for an XChaCha20-Poly1305 nonce before the arguments and its tag after them,
+    // so it is sealed and opened in place with the detached AEAD API: one allocation, no copy.
+    // Layout: [nonce][payload][tag], i.e. the nonce followed by libsodium's combined ciphertext.
+    // Buffer's destructor isn't virtual: own a SecureBuffer by its own type, never through a Buffer*,
+    // or the wipe in ~SecureBuffer() is skipped.
+    class SecureBuffer final : public Buffer
+    {
+    public:
+        static constexpr size_t KeySize = crypto_aead_xchacha20poly1305_ietf_KEYBYTES;
+        static constexpr size_t NonceSize = crypto_aead_xchacha20poly1305_ietf_NPUBBYTES;
+        static constexpr size_t TagSize = crypto_aead_xchacha20poly1305_ietf_ABYTES;
+        static constexpr size_t Overhead = NonceSize + TagSize;
+
+        template<typename ...Ts>
+        SecureBuffer(const Ts&... Args)
+            : Buffer(Room{ NonceSize, TagSize }, noHook{}, Args...)
+        {}
+
+        ~SecureBuffer()
+        {
+            if (data != nullptr) [[likely]]
+                sodium_memzero(data, size);
+        }
+
+        // Draws a fresh nonce and encrypts the payload in place. GetData()/GetSize() then hold the whole message.
+        void Encrypt(const unsigned char* Key, const unsigned char* AdditionalData = nullptr, size_t AdditionalDataSize = 0) noexcept
+        {
+            unsigned char* nonce = reinterpret_cast<unsigned char*>(data);
+            unsigned char* payload = nonce + NonceSize;
+            randombytes_buf(nonce, NonceSize);
+            crypto_aead_xchacha20poly1305_ietf_encrypt_detached(payload, payload + GetPayloadSize(), nullptr,
+                payload, GetPayloadSize(), AdditionalData, AdditionalDataSize, nullptr, nonce, Key);
+        }
+
+        [[nodiscard]] bool Decrypt(const unsigned char* Key, const unsigned char* AdditionalData = nullptr, size_t AdditionalDataSize = 0) noexcept
+        {
+            return Open(data, size, Key, AdditionalData, AdditionalDataSize);
+        }
+
+        // Verifies and decrypts a received message in place; on success the arguments start at Data + NonceSize.
+        // On failure libsodium wipes the payload rather than leave unverified plaintext behind.
+        [[nodiscard]] static bool Open(char* Data, size_t Size, const unsigned char* Key,
+            const unsigned char* AdditionalData = nullptr, size_t AdditionalDataSize = 0) noexcept
+        {
+            if (Size < Overhead) [[unlikely]]
+                return false;
+            unsigned char* nonce = reinterpret_cast<unsigned char*>(Data);
+            unsigned char* payload = nonce + NonceSize;
+            size_t payloadSize = Size - Overhead;
+            return crypto_aead_xchacha20poly1305_ietf_decrypt_detached(payload, nullptr, payload, payloadSize,
+                payload + payloadSize, AdditionalData, AdditionalDataSize, nonce, Key) == 0;
+        }
+
+        static void GenerateKey(unsigned char* Key) noexcept { crypto_aead_xchacha20poly1305_ietf_keygen(Key); }
+
+        [[nodiscard]] const char* GetPayload() const noexcept { return data + NonceSize; }
+        [[nodiscard]] size_t GetPayloadSize() const noexcept { return size - Overhead; }
+    };
+}
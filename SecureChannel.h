@@ -0,0 +1,272 @@
+#pragma once
+#include <algorithm>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <sodium.h>
+#include "Buffer.h"
+
+namespace Buffer
+{
+    // A one-way encrypted stream of Buffers over crypto_secretstream_xchacha20poly1305.
+    // Wire: [stream header] then records [ciphertext size:4, little endian][ciphertext], where a record's
+    // plaintext is a run of frames [size:4, little endian][Buffer bytes]. Frames are coalesced into one push
+    // until Flush(), or until CoalesceSize is reached; the stream is rekeyed every RekeyInterval records and
+    // ends with a FINAL record on Close(), so truncation is detected. A frame never spans records: a Buffer
+    // over MaxFrameSize can't be sent, and RekeyInterval must be at least 1.
+    class SecureChannel
+    {
+    public:
+        static constexpr size_t KeySize = crypto_secretstream_xchacha20poly1305_KEYBYTES;
+        static constexpr size_t HeaderSize = crypto_secretstream_xchacha20poly1305_HEADERBYTES;
+        static constexpr size_t RecordOverhead = 4 + crypto_secretstream_xchacha20poly1305_ABYTES;
+        static constexpr size_t FrameOverhead = 4;
+        static constexpr size_t DefaultCoalesceSize = 16 * 1024;
+        static constexpr size_t DefaultRekeyInterval = 1024;
+        static constexpr size_t MaxRecordSize = 16 * 1024 * 1024;
+        static constexpr size_t MaxFrameSize = MaxRecordSize - RecordOverhead - FrameOverhead;
+
+        static void GenerateKey(unsigned char* Key) noexcept { crypto_secretstream_xchacha20poly1305_keygen(Key); }
+
+        class Sender
+        {
+        public:
+            Sender(const unsigned char* Key, size_t CoalesceSize = DefaultCoalesceSize, size_t RekeyInterval = DefaultRekeyInterval)
+                : coalesceSize(CoalesceSize), rekeyInterval(RekeyInterval)
+            {
+                if (RekeyInterval == 0) [[unlikely]]
+                    throw std::invalid_argument("SecureChannel: a rekey interval of 0");
+                wire.resize(HeaderSize);
+                crypto_secretstream_xchacha20poly1305_init_push(&state, reinterpret_cast<unsigned char*>(wire.data()), Key);
+            }
+
+            Sender(const Sender&) = delete;
+            Sender& operator=(const Sender&) = delete;
+
+            ~Sender()
+            {
+                sodium_memzero(&state, sizeof state);
+                sodium_memzero(pending.data(), pending.size());
+            }
+
+            // Returns false, and pushes nothing, once closed or when Size is over MaxFrameSize.
+            bool Push(const char* Data, size_t Size)
+            {
+                if (closed || Size > MaxFrameSize) [[unlikely]]
+                    return false;
+                if (!pending.empty() && pending.size() + FrameOverhead + Size > MaxRecordSize - RecordOverhead) [[unlikely]]
+                    seal(crypto_secretstream_xchacha20poly1305_TAG_MESSAGE);
+
+                char frameSize[FrameOverhead] = {
+                    static_cast<char>(Size & 0xFF),
+                    static_cast<char>(Size >> 8 & 0xFF),
+                    static_cast<char>(Size >> 16 & 0xFF),
+                    static_cast<char>(Size >> 24 & 0xFF),
+                };
+                reserve(pending.size() + FrameOverhead + Size);
+                pending.append(frameSize, FrameOverhead);
+                pending.append(Data, Size);
+
+                if (pending.size() >= coalesceSize)
+                    seal(crypto_secretstream_xchacha20poly1305_TAG_MESSAGE);
+                return true;
+            }
+
+            bool Push(const Buffer& Buf) { return Push(Buf.GetData(), Buf.GetSize()); }
+
+            // Seals the pending frames and hands over every byte produced since the last call.
+            [[nodiscard]] std::string Flush()
+            {
+                if (!pending.empty())
+                    seal(crypto_secretstream_xchacha20poly1305_TAG_MESSAGE);
+                return std::exchange(wire, std::string());
+            }
+
+            // Seals the pending frames with the FINAL tag; nothing can be pushed afterwards.
+            [[nodiscard]] std::string Close()
+            {
+                if (!closed)
+                {
+                    seal(crypto_secretstream_xchacha20poly1305_TAG_FINAL);
+                    closed = true;
+                }
+                return std::exchange(wire, std::string());
+            }
+
+            [[nodiscard]] bool IsClosed() const noexcept { return closed; }
+
+        private:
+            // Grows pending by hand so the plaintext it held is wiped before its old storage is freed
+            void reserve(size_t Size)
+            {
+                if (Size <= pending.capacity())
+                    return;
+                std::string grown;
+                grown.reserve(std::max(Size, pending.capacity() * 2));
+                grown.append(pending);
+                sodium_memzero(pending.data(), pending.size());
+                pending.swap(grown);
+            }
+
+            void seal(unsigned char Tag)
+            {
+                if (Tag == crypto_secretstream_xchacha20poly1305_TAG_MESSAGE && ++records % rekeyInterval == 0)
+                    Tag = crypto_secretstream_xchacha20poly1305_TAG_REKEY;
+
+                size_t cipherSize = pending.size() + crypto_secretstream_xchacha20poly1305_ABYTES;
+                size_t at = wire.size();
+                wire.resize(at + 4 + cipherSize);
+                char* out = wire.data() + at;
+                out[0] = static_cast<char>(cipherSize & 0xFF);
+                out[1] = static_cast<char>(cipherSize >> 8 & 0xFF);
+                out[2] = static_cast<char>(cipherSize >> 16 & 0xFF);
+                out[3] = static_cast<char>(cipherSize >> 24 & 0xFF);
+                crypto_secretstream_xchacha20poly1305_push(&state, reinterpret_cast<unsigned char*>(out + 4), nullptr,
+                    reinterpret_cast<const unsigned char*>(pending.data()), pending.size(), nullptr, 0, Tag);
+                sodium_memzero(pending.data(), pending.size());
+                pending.clear();
+            }
+
+            crypto_secretstream_xchacha20poly1305_state state;
+            std::string pending;
+            std::string wire;
+            size_t coalesceSize;
+            size_t rekeyInterval;
+            size_t records{ 0 };
+            bool closed{ false };
+        };
+
+        class Receiver
+        {
+        public:
+            Receiver(const unsigned char* Key)
+            {
+                memcpy(key, Key, KeySize);
+            }
+
+            Receiver(const Receiver&) = delete;
+            Receiver& operator=(const Receiver&) = delete;
+
+            ~Receiver()
+            {
+                sodium_memzero(key, sizeof key);
+                sodium_memzero(&state, sizeof state);
+                sodium_memzero(plain.data(), plain.size());
+            }
+
+            // Accepts wire bytes in chunks of any size. Returns false, for good, once the stream is
+            // forged, reordered, malformed or continues past its FINAL record.
+            [[nodiscard]] bool Receive(const char* Data, size_t Size)
+            {
+                if (failed) [[unlikely]]
+                    return false;
+                input.append(Data, Size);
+
+                size_t cursor = 0;
+                if (!started)
+                {
+                    if (input.size() < HeaderSize)
+                        return true;
+                    if (crypto_secretstream_xchacha20poly1305_init_pull(&state, reinterpret_cast<const unsigned char*>(input.data()), key) != 0) [[unlikely]]
+                        return fail();
+                    sodium_memzero(key, sizeof key);
+                    started = true;
+                    cursor = HeaderSize;
+                }
+
+                while (input.size() - cursor >= 4)
+                {
+                    if (closed) [[unlikely]]
+                        return fail();
+
+                    const unsigned char* d = reinterpret_cast<const unsigned char*>(input.data() + cursor);
+                    size_t cipherSize = static_cast<size_t>(
+                        (static_cast<uint32_t>(d[3]) << 24) |
+                        (static_cast<uint32_t>(d[2]) << 16) |
+                        (static_cast<uint32_t>(d[1]) << 8) |
+                        (static_cast<uint32_t>(d[0])));
+                    if (cipherSize < crypto_secretstream_xchacha20poly1305_ABYTES || cipherSize > MaxRecordSize) [[unlikely]]
+                        return fail();
+                    if (input.size() - cursor - 4 < cipherSize)
+                        break;
+
+                    plain.resize(cipherSize - crypto_secretstream_xchacha20poly1305_ABYTES);
+                    unsigned char tag;
+                    if (crypto_secretstream_xchacha20poly1305_pull(&state, reinterpret_cast<unsigned char*>(plain.data()), nullptr, &tag,
+                        d + 4, cipherSize, nullptr, 0) != 0) [[unlikely]]
+                        return fail();
+                    cursor += 4 + cipherSize;
+                    bool framed = splitFrames();
+                    sodium_memzero(plain.data(), plain.size());
+                    if (!framed) [[unlikely]]
+                        return fail();
+                    closed = tag == crypto_secretstream_xchacha20poly1305_TAG_FINAL;
+                }
+                if (closed && cursor != input.size()) [[unlikely]]
+                    return fail();
+
+                input.erase(0, cursor);
+                return true;
+            }
+
+            [[nodiscard]] bool Receive(const std::string& Data) { return Receive(Data.data(), Data.size()); }
+
+            // The next received Buffer, in the order it was pushed
+            [[nodiscard]] std::optional<std::string> Pop()
+            {
+                if (messages.empty())
+                    return std::nullopt;
+                std::string message = std::move(messages.front());
+                messages.pop_front();
+                return message;
+            }
+
+            [[nodiscard]] size_t GetPendingCount() const noexcept { return messages.size(); }
+            [[nodiscard]] bool IsClosed() const noexcept { return closed; }
+
+        private:
+            bool fail()
+            {
+                failed = true;
+                input.clear();
+                sodium_memzero(plain.data(), plain.size());
+                return false;
+            }
+
+            bool splitFrames()
+            {
+                size_t cursor = 0;
+                while (cursor < plain.size())
+                {
+                    if (plain.size() - cursor < FrameOverhead) [[unlikely]]
+                        return false;
+                    const unsigned char* d = reinterpret_cast<const unsigned char*>(plain.data() + cursor);
+                    size_t frameSize = static_cast<size_t>(
+                        (static_cast<uint32_t>(d[3]) << 24) |
+                        (static_cast<uint32_t>(d[2]) << 16) |
+                        (static_cast<uint32_t>(d[1]) << 8) |
+                        (static_cast<uint32_t>(d[0])));
+                    cursor += FrameOverhead;
+                    if (plain.size() - cursor < frameSize) [[unlikely]]
+                        return false;
+                    messages.emplace_back(plain.data() + cursor, frameSize);
+                    cursor += frameSize;
+                }
+                return true;
+            }
+
+            crypto_secretstream_xchacha20poly1305_state state;
+            unsigned char key[KeySize];
+            std::string input;
+            std::string plain;
+            std::deque<std::string> messages;
+            bool started{ false };
+            bool closed{ false };
+            bool failed{ false };
+        };
+    };
+}
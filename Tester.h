@@ -5,6 +5,50 @@
 #include <functional>
 #include <tuple>
 #include <chrono>
+#include <atomic>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string_view>
+#include <new>
+#include <bit>
+#include <thread>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#if defined(__x86_64__)
+#include <csignal>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <ucontext.h>
+#define TESTER_HAS_PROFILER
+#endif
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace
 {
@@ -17,37 +61,1489 @@ namespace
         }
     };
 
+    // Clock used by the benchmark engine, in nanoseconds
+    struct steadyTimer
+    {
+        static int64_t Now() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    };
+
+    // Time stamp counter, converted to nanoseconds with a rate calibrated against steadyTimer on the first
+    // conversion, not at static initialization: the calibration spins for 10 ms.
+    // StartTicks() and StopTicks() are fenced so that neither the code before nor the code after the measured
+    // interval leaks into it. Usable() is false off x86 and when the counter isn't invariant, since it would
+    // then change rate with the CPU frequency or stop in deep sleep states.
+    struct tscClock
+    {
+        static bool Usable() noexcept { return features().invariant; }
+
+        static uint64_t Ticks() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            return __rdtsc();
+#else
+            return static_cast<uint64_t>(steadyTimer::Now());
+#endif
+        }
+
+        // lfence waits for the earlier instructions; the second one keeps the measured ones from starting early
+        static uint64_t StartTicks() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            _mm_lfence();
+            uint64_t ticks = __rdtsc();
+            _mm_lfence();
+            return ticks;
+#else
+            return Ticks();
+#endif
+        }
+
+        // rdtscp waits for the measured instructions; lfence keeps the following ones from starting early
+        static uint64_t StopTicks() noexcept
+        {
+#if defined(__x86_64__) || defined(__i386__)
+            uint64_t ticks;
+            if (features().rdtscp) [[likely]]
+            {
+                unsigned processor;
+                ticks = __rdtscp(&processor);
+            }
+            else
+            {
+                _mm_lfence();
+                ticks = __rdtsc();
+            }
+            _mm_lfence();
+            return ticks;
+#else
+            return Ticks();
+#endif
+        }
+
+        static int64_t ToNs(uint64_t Ticks) noexcept
+        {
+            const calibration& c = get();
+            return static_cast<int64_t>(static_cast<int64_t>(Ticks - c.baseTicks) * c.nsPerTick); // Ticks may predate the calibration
+        }
+
+        static int64_t Now() noexcept { return ToNs(StartTicks()); }
+        static double GHz() noexcept { return 1 / get().nsPerTick; }
+
+    private:
+        struct cpuFeatures
+        {
+            bool invariant;
+            bool rdtscp;
+        };
+
+        struct calibration
+        {
+            uint64_t baseTicks;
+            double nsPerTick;
+        };
+
+        static const cpuFeatures& features() noexcept
+        {
+            static const cpuFeatures f = []()
+            {
+#if defined(__x86_64__) || defined(__i386__)
+                unsigned eax, ebx, ecx, edx;
+                bool invariant = __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8));
+                bool rdtscp = __get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) && (edx & (1u << 27));
+                return cpuFeatures{ invariant, rdtscp };
+#else
+                return cpuFeatures{ false, false };
+#endif
+            }();
+            return f;
+        }
+
+        static const calibration& get() noexcept
+        {
+            static const calibration c = []()
+            {
+#if defined(__x86_64__) || defined(__i386__)
+                int64_t startNs = steadyTimer::Now(), endNs;
+                uint64_t start = __rdtsc();
+                while ((endNs = steadyTimer::Now()) - startNs < 10'000'000)
+                    ;
+                uint64_t end = __rdtsc();
+                return calibration{ start, static_cast<double>(endNs - startNs) / static_cast<double>(end - start) };
+#else
+                return calibration{ Ticks(), 1.0 };
+#endif
+            }();
+            return c;
+        }
+    };
+
+    // Clock of the benchmark engine, in nanoseconds: the fenced TSC when it is invariant, else steadyTimer;
+    // TESTER_CLOCK=steady forces the latter. Overhead() is the smallest time an empty Start()/Stop() pair
+    // measures, which the engine subtracts from every measurement.
+    struct benchClock
+    {
+        static bool UsesTsc() noexcept { return useTsc; }
+
+        static int64_t Start() noexcept { return useTsc ? tscClock::ToNs(tscClock::StartTicks()) : steadyTimer::Now(); }
+        static int64_t Stop() noexcept { return useTsc ? tscClock::ToNs(tscClock::StopTicks()) : steadyTimer::Now(); }
+
+        static int64_t Overhead() noexcept
+        {
+            static const int64_t overhead = []()
+            {
+                int64_t least = INT64_MAX;
+                for (int i = 0; i < 1000; i++)
+                {
+                    int64_t start = Start();
+                    least = std::min(least, Stop() - start);
+                }
+                return std::max<int64_t>(least, 0);
+            }();
+            return overhead;
+        }
+
+        // Elapsed time of a measurement, overhead removed
+        static int64_t Elapsed(int64_t Start, int64_t Stop) noexcept { return std::max<int64_t>(Stop - Start - Overhead(), 0); }
+
+    private:
+        inline static const bool useTsc = []()
+        {
+            const char* clock = std::getenv("TESTER_CLOCK");
+            return tscClock::Usable() && (clock == nullptr || std::string_view(clock) != "steady");
+        }();
+    };
+
+    // Log-linear histogram of nanosecond latencies, HDR style: each power of two is split into 128 linear
+    // sub-buckets, so any value is kept within 1/128 (0.8%) from 1 ns up to 2^40 ns (about 18 minutes).
+    struct latencyHistogram
+    {
+        static constexpr unsigned subBits = 8;
+        static constexpr uint64_t subCount = uint64_t(1) << subBits;
+        static constexpr uint64_t halfCount = subCount / 2;
+        static constexpr uint64_t maxValue = (uint64_t(1) << 40) - 1;
+        static constexpr size_t bucketCount = halfCount * (40 - subBits + 2);
+
+        std::vector<uint64_t> counts; // sized on the first Record()
+        uint64_t total = 0;
+        uint64_t max = 0;
+        double sum = 0;
+
+        static size_t indexOf(uint64_t Value) noexcept
+        {
+            if (Value < subCount)
+                return static_cast<size_t>(Value);
+            unsigned shift = static_cast<unsigned>(std::bit_width(Value)) - subBits;
+            return static_cast<size_t>(halfCount * shift + (Value >> shift));
+        }
+
+        // Highest value that lands in bucket Index
+        static uint64_t highestOf(size_t Index) noexcept
+        {
+            if (Index < subCount)
+                return Index;
+            uint64_t shift = Index / halfCount - 1;
+            return ((Index - halfCount * shift + 1) << shift) - 1;
+        }
+
+        void Record(int64_t Value, uint64_t Count = 1)
+        {
+            if (counts.empty()) [[unlikely]]
+                counts.resize(bucketCount);
+            uint64_t value = std::min<uint64_t>(static_cast<uint64_t>(std::max<int64_t>(Value, 0)), maxValue);
+            counts[indexOf(value)] += Count;
+            total += Count;
+            sum += static_cast<double>(value) * Count;
+            max = std::max(max, value);
+        }
+
+        void Merge(const latencyHistogram& Other)
+        {
+            if (Other.counts.empty())
+                return;
+            if (counts.empty())
+                counts.resize(bucketCount);
+            for (size_t i = 0; i < bucketCount; i++)
+                counts[i] += Other.counts[i];
+            total += Other.total;
+            sum += Other.sum;
+            max = std::max(max, Other.max);
+        }
+
+        void Clear()
+        {
+            std::fill(counts.begin(), counts.end(), 0);
+            total = 0;
+            max = 0;
+            sum = 0;
+        }
+
+        [[nodiscard]] uint64_t Count() const noexcept { return total; }
+        [[nodiscard]] double Mean() const noexcept { return total > 0 ? sum / total : 0; }
+
+        [[nodiscard]] uint64_t ValueAtPercentile(double Percentile) const noexcept
+        {
+            if (total == 0)
+                return 0;
+            uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(Percentile / 100 * total)));
+            uint64_t seen = 0;
+            for (size_t i = 0; i < counts.size(); i++)
+                if ((seen += counts[i]) >= target)
+                    return std::min(highestOf(i), max);
+            return max;
+        }
+    };
+
+    struct benchSettings
+    {
+        int64_t warmupNs = 100'000'000; // also spent calibrating the batch size
+        int64_t sampleNs = 10'000'000; // target duration of one timed batch
+        size_t sampleCount = 30;
+        bool perfCounters = false; // TESTER_PERF_COUNTERS=1
+        size_t maxThreads = std::max(1u, std::thread::hardware_concurrency()); // TESTER_THREADS=n
+        bool profile = false; // --profile
+    };
+    inline benchSettings settings;
+
+    // The threads of one BENCH_THREADS step. They start warming up together, start sampling together, and
+    // keep running the body once done until the last one is, so every sample is taken under full load.
+    struct threadGroup
+    {
+        size_t count;
+        std::atomic<size_t> started{ 0 };
+        std::atomic<size_t> sampling{ 0 };
+        std::atomic<size_t> finished{ 0 };
+
+        explicit threadGroup(size_t Count) noexcept : count(Count) {}
+
+        static void arriveAndWait(std::atomic<size_t>& Barrier, size_t Count) noexcept
+        {
+            Barrier.fetch_add(1, std::memory_order_acq_rel);
+            while (Barrier.load(std::memory_order_acquire) < Count)
+                std::this_thread::yield();
+        }
+
+        void Start() noexcept { arriveAndWait(started, count); }
+        void StartSampling() noexcept { arriveAndWait(sampling, count); }
+        void Finish() noexcept { finished.fetch_add(1, std::memory_order_acq_rel); }
+        [[nodiscard]] bool AllFinished() const noexcept { return finished.load(std::memory_order_acquire) >= count; }
+    };
+    inline thread_local threadGroup* currentGroup = nullptr;
+
+    // 1, 2, 4... below Max, then Max
+    inline std::vector<size_t> threadCounts(size_t Max)
+    {
+        std::vector<size_t> counts;
+        for (size_t n = 1; n < Max; n *= 2)
+            counts.push_back(n);
+        counts.push_back(std::max<size_t>(Max, 1));
+        return counts;
+    }
+
+    // Pins the calling thread to the Index-th CPU the process may run on, round robin
+    inline void pinThread(size_t Index) noexcept
+    {
+#if defined(__linux__)
+        cpu_set_t allowed;
+        if (sched_getaffinity(0, sizeof allowed, &allowed) != 0 || CPU_COUNT(&allowed) == 0)
+            return;
+        size_t target = Index % CPU_COUNT(&allowed);
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &allowed) && target-- == 0)
+            {
+                cpu_set_t one;
+                CPU_ZERO(&one);
+                CPU_SET(cpu, &one);
+                pthread_setaffinity_np(pthread_self(), sizeof one, &one);
+                return;
+            }
+#else
+        (void)Index;
+#endif
+    }
+
+    // Per-thread hardware and software counters through Linux perf_event_open. Every event is opened on its
+    // own so that one the host doesn't expose (typical in containers and VMs) only drops that event;
+    // multiplexed counts are scaled by their enabled/running time.
+    struct perfCounters
+    {
+        static constexpr size_t count = 6;
+        static constexpr const char* names[count] = { "cycles", "instructions", "branch-misses", "L1d-misses", "LLC-misses", "page-faults" };
+
+        int fds[count] = { -1, -1, -1, -1, -1, -1 };
+        std::string error;
+
+        perfCounters() = default;
+        perfCounters(const perfCounters&) = delete;
+        perfCounters& operator=(const perfCounters&) = delete;
+        ~perfCounters() { Close(); }
+
+        bool Open()
+        {
+#if defined(__linux__)
+            static constexpr std::pair<uint32_t, uint64_t> events[count] = {
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+                { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+                { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+                { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS },
+            };
+            bool any = false;
+            for (size_t i = 0; i < count; i++)
+            {
+                perf_event_attr attr;
+                memset(&attr, 0, sizeof attr);
+                attr.size = sizeof attr;
+                attr.type = events[i].first;
+                attr.config = events[i].second;
+                attr.disabled = 1;
+                attr.exclude_kernel = 1; // allowed with perf_event_paranoid <= 2
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                fds[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+                if (fds[i] < 0 && error.empty())
+                    error = std::string(names[i]) + ": " + strerror(errno);
+                any |= fds[i] >= 0;
+            }
+            return any;
+#else
+            error = "perf_event_open is Linux only";
+            return false;
+#endif
+        }
+
+        void Close() noexcept
+        {
+#if defined(__linux__)
+            for (int& fd : fds)
+                if (fd >= 0)
+                {
+                    close(fd);
+                    fd = -1;
+                }
+#endif
+        }
+
+        void Start() noexcept
+        {
+#if defined(__linux__)
+            for (int fd : fds)
+                if (fd >= 0)
+                {
+                    ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+                }
+#endif
+        }
+
+        void Stop() noexcept
+        {
+#if defined(__linux__)
+            for (int fd : fds)
+                if (fd >= 0)
+                    ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+#endif
+        }
+
+        // Counts since Start(); negative when the event is unavailable
+        void Read(double (&Values)[count]) const noexcept
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                Values[i] = -1;
+#if defined(__linux__)
+                uint64_t value[3]; // value, time enabled, time running
+                if (fds[i] >= 0 && read(fds[i], value, sizeof value) == sizeof value && value[2] > 0)
+                    Values[i] = static_cast<double>(value[0]) * value[1] / value[2];
+#endif
+            }
+        }
+    };
+    inline perfCounters counters;
+
+    // SIGPROF sampling profiler: while started, ITIMER_PROF interrupts the process every millisecond of CPU
+    // time and the handler copies the starting thread's stack into a preallocated buffer. It only reads
+    // registers and stack memory, which is async-signal-safe: the interrupted PC, then the return addresses
+    // along the frame pointer chain unless framePointers is off. Write() symbolizes the stacks once sampling
+    // has stopped and aggregates them in the collapsed "root;...;leaf count" format flamegraph.pl reads.
+    // Linux x86-64 only.
+    struct samplingProfiler
+    {
+        static constexpr size_t maxDepth = 64;
+        static constexpr size_t capacity = 8192; // samples, about 8 s of CPU time
+        static constexpr int intervalUs = 1000; // coarser on kernels with a slower tick
+
+        bool framePointers = true; // else the interrupted PC only, for builds without frame pointers
+        size_t dropped = 0;
+
+        samplingProfiler() = default;
+        samplingProfiler(const samplingProfiler&) = delete;
+        samplingProfiler& operator=(const samplingProfiler&) = delete;
+
+        [[nodiscard]] static constexpr bool Available() noexcept
+        {
+#if defined(TESTER_HAS_PROFILER)
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        [[nodiscard]] size_t Count() const noexcept { return std::min(next.load(std::memory_order_acquire), capacity); }
+
+        // Samples the calling thread until Stop(); samples accumulate until Clear()
+        void Start()
+        {
+#if defined(TESTER_HAS_PROFILER)
+            if (frames.empty())
+            {
+                frames.resize(capacity * maxDepth);
+                depths.resize(capacity);
+            }
+            pthread_attr_t attributes;
+            if (pthread_getattr_np(pthread_self(), &attributes) == 0)
+            {
+                void* low = nullptr;
+                size_t size = 0;
+                pthread_attr_getstack(&attributes, &low, &size);
+                stackLow = reinterpret_cast<uintptr_t>(low);
+                stackHigh = stackLow + size;
+                pthread_attr_destroy(&attributes);
+            }
+
+            active = this;
+            profiledThread = true;
+            struct sigaction action;
+            memset(&action, 0, sizeof action);
+            action.sa_sigaction = onSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            sigaction(SIGPROF, &action, &previous);
+            itimerval timer = { { 0, intervalUs }, { 0, intervalUs } };
+            setitimer(ITIMER_PROF, &timer, nullptr);
+#endif
+        }
+
+        void Stop() noexcept
+        {
+#if defined(TESTER_HAS_PROFILER)
+            itimerval timer = {};
+            setitimer(ITIMER_PROF, &timer, nullptr);
+            profiledThread = false;
+            active = nullptr;
+            sigaction(SIGPROF, &previous, nullptr);
+#endif
+        }
+
+        void Clear() noexcept
+        {
+            next.store(0, std::memory_order_release);
+            dropped = 0;
+        }
+
+        // Collapsed stacks, one "root;...;leaf count" line per distinct stack
+        void Write(std::ostream& Out) const
+        {
+#if defined(TESTER_HAS_PROFILER)
+            std::map<uintptr_t, std::string> names;
+            std::map<std::string, size_t> stacks;
+            for (size_t i = 0; i < Count(); i++)
+            {
+                std::string stack;
+                for (size_t k = depths[i]; k-- > 0;)
+                {
+                    uintptr_t address = frames[i * maxDepth + k];
+                    auto [name, added] = names.try_emplace(address);
+                    if (added)
+                        name->second = symbolize(k == 0 ? address : address - 1); // return addresses point past the call
+                    if (!stack.empty())
+                        stack += ';';
+                    stack += name->second;
+                }
+                if (!stack.empty())
+                    stacks[stack]++;
+            }
+            for (auto& [stack, count] : stacks)
+                Out << stack << ' ' << count << '\n';
+#else
+            (void)Out;
+#endif
+        }
+
+    private:
+        std::vector<uintptr_t> frames; // capacity stacks of maxDepth, leaf first
+        std::vector<uint32_t> depths;
+        std::atomic<size_t> next{ 0 };
+        uintptr_t stackLow = 0;
+        uintptr_t stackHigh = 0;
+#if defined(TESTER_HAS_PROFILER)
+        struct sigaction previous;
+
+        inline static samplingProfiler* active = nullptr;
+        inline static thread_local bool profiledThread = false;
+
+        static void onSignal(int, siginfo_t*, void* Context)
+        {
+            samplingProfiler* self = active;
+            if (self == nullptr || !profiledThread)
+                return;
+            int savedErrno = errno;
+            size_t slot = self->next.fetch_add(1, std::memory_order_acq_rel);
+            if (slot < capacity) [[likely]]
+            {
+                uintptr_t* stack = &self->frames[slot * maxDepth];
+                const ucontext_t* context = static_cast<const ucontext_t*>(Context);
+                stack[0] = static_cast<uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+                self->depths[slot] = static_cast<uint32_t>(self->framePointers ? self->unwindFramePointers(context, stack, maxDepth) : 1);
+            }
+            else
+            {
+                self->next.store(capacity, std::memory_order_release);
+                self->dropped++;
+            }
+            errno = savedErrno;
+        }
+
+        // Follows the saved frame pointer chain after the interrupted PC in Frames[0]; needs code built with
+        // frame pointers. Every read is bounded by the thread's stack, so a broken chain ends the walk.
+        size_t unwindFramePointers(const ucontext_t* Context, uintptr_t* Frames, size_t Max) const noexcept
+        {
+            size_t depth = 1;
+            uintptr_t fp = static_cast<uintptr_t>(Context->uc_mcontext.gregs[REG_RBP]);
+            while (depth < Max && fp >= stackLow && fp + 16 <= stackHigh && fp % sizeof(uintptr_t) == 0)
+            {
+                const uintptr_t* frame = reinterpret_cast<const uintptr_t*>(fp);
+                if (frame[1] == 0)
+                    break;
+                Frames[depth++] = frame[1];
+                if (frame[0] <= fp) // the stack grows down: callers live higher
+                    break;
+                fp = frame[0];
+            }
+            return depth;
+        }
+
+        static std::string symbolize(uintptr_t Address)
+        {
+            Dl_info info;
+            if (dladdr(reinterpret_cast<void*>(Address), &info) == 0)
+            {
+                char text[32];
+                snprintf(text, sizeof text, "0x%zx", static_cast<size_t>(Address));
+                return text;
+            }
+            std::string name;
+            if (info.dli_sname != nullptr)
+            {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                name = status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+                free(demangled);
+            }
+            else // not exported (internal linkage, or linked without -rdynamic): module+offset for addr2line
+            {
+                const char* module = info.dli_fname != nullptr ? info.dli_fname : "?";
+                if (const char* slash = strrchr(module, '/'))
+                    module = slash + 1;
+                char text[64];
+                snprintf(text, sizeof text, "+0x%zx", static_cast<size_t>(Address - reinterpret_cast<uintptr_t>(info.dli_fbase)));
+                name = module + std::string(text);
+            }
+            std::replace(name.begin(), name.end(), ';', ':');
+            return name;
+        }
+#endif
+    };
+    inline samplingProfiler profiler;
+
+    // Heap activity of the current thread, fed by the operator new/delete replacements that
+    // TESTER_COUNT_ALLOCATIONS enables. Live and peak bytes need malloc_usable_size (glibc).
+    struct allocationCounters
+    {
+        uint64_t allocations = 0;
+        uint64_t frees = 0;
+        uint64_t bytes = 0;
+        uint64_t live = 0;
+        uint64_t peak = 0;
+    };
+    inline thread_local allocationCounters allocationTally;
+#if defined(TESTER_COUNT_ALLOCATIONS)
+    inline constexpr bool countsAllocations = true;
+#else
+    inline constexpr bool countsAllocations = false;
+#endif
+
+    struct benchStats
+    {
+        double median = 0, mad = 0, mean = 0, stddev = 0, cv = 0, min = 0;
+
+        static double medianOf(std::vector<double> values)
+        {
+            if (values.empty())
+                return 0;
+            auto middle = values.begin() + values.size() / 2;
+            std::nth_element(values.begin(), middle, values.end());
+            if (values.size() % 2 == 1)
+                return *middle;
+            return (*middle + *std::max_element(values.begin(), middle)) / 2;
+        }
+
+        static benchStats Compute(const std::vector<double>& Samples)
+        {
+            benchStats stats;
+            if (Samples.empty())
+                return stats;
+            stats.median = medianOf(Samples);
+            std::vector<double> deviations;
+            deviations.reserve(Samples.size());
+            for (double sample : Samples)
+                deviations.push_back(std::abs(sample - stats.median));
+            stats.mad = medianOf(std::move(deviations));
+            for (double sample : Samples)
+                stats.mean += sample;
+            stats.mean /= Samples.size();
+            for (double sample : Samples)
+                stats.stddev += (sample - stats.mean) * (sample - stats.mean);
+            stats.stddev = Samples.size() > 1 ? std::sqrt(stats.stddev / (Samples.size() - 1)) : 0;
+            stats.cv = stats.mean > 0 ? stats.stddev / stats.mean : 0;
+            stats.min = *std::min_element(Samples.begin(), Samples.end());
+            return stats;
+        }
+    };
+
+    // Drives the START_BENCH/STOP_BENCH loop: the body runs in batches timed as a whole, so clock reads are
+    // amortized. Warmup grows the batch until one lasts sampleNs, then sampleCount batches are recorded as ns/op.
     struct benchRet
     {
-        int counter = 0;
+        int counter = 0; // benchmarks that don't use START_BENCH report their iterations per second here
+        size_t repetitions = 1;
+        std::vector<double> samples;
+        size_t batch = 1;
+        size_t range = 0; // current size of a BENCH_RANGE
+        size_t threadIndex = 0; // within a BENCH_THREADS step
+        size_t threadCount = 1;
+        double bytesPerOp = 0;
+        double itemsPerOp = 0;
+        double countersPerOp[perfCounters::count] = { -1, -1, -1, -1, -1, -1 }; // over the sampled batches
+        double allocationsPerOp = 0;
+        double bytesAllocatedPerOp = 0;
+        uint64_t peakLiveBytes = 0; // above the live bytes when sampling started
+        latencyHistogram latency; // filled by START_LATENCY
+        int64_t intervalNs = 0; // fixed-rate START_LATENCY when positive
+
+        void SetBytesProcessed(double Bytes) noexcept { bytesPerOp = Bytes; }
+        void SetItemsProcessed(double Items) noexcept { itemsPerOp = Items; }
+        // Folds in another repetition of the same benchmark: samples and latencies are pooled, counter is
+        // summed over repetitions, everything else stays as the first repetition measured it
+        void Merge(const benchRet& Other)
+        {
+            samples.insert(samples.end(), Other.samples.begin(), Other.samples.end());
+            latency.Merge(Other.latency);
+            counter += Other.counter;
+            repetitions += Other.repetitions;
+        }
+
+        // START_LATENCY then issues operations on a fixed schedule and measures each from the time it was
+        // due, not from when it started, so a stall also counts against the operations queued behind it.
+        void SetTargetRate(double OperationsPerSecond) noexcept
+        {
+            intervalNs = OperationsPerSecond > 0 ? static_cast<int64_t>(1e9 / OperationsPerSecond) : 0;
+        }
+
+        // Drives START_LATENCY/STOP_LATENCY: every batch of body runs (1 unless set before the loop) is timed
+        // on its own with the TSC and recorded per operation, for warmupNs then sampleCount * sampleNs.
+        bool NextOperation()
+        {
+            int64_t now = benchClock::Stop();
+            if (phase == idle) [[unlikely]]
+            {
+                phase = warmup;
+                phaseStart = now;
+                nextStart = now;
+                latency.Clear();
+            }
+            else
+            {
+                if (phase == sampling) [[likely]]
+                {
+                    latency.Record(benchClock::Elapsed(batchStart, now) / static_cast<int64_t>(batch), batch);
+                    if (now - phaseStart >= settings.sampleNs * static_cast<int64_t>(settings.sampleCount)) [[unlikely]]
+                    {
+                        if (settings.profile)
+                            profiler.Stop();
+                        phase = idle;
+                        return false;
+                    }
+                }
+                else if (now - phaseStart >= settings.warmupNs)
+                {
+                    if (settings.profile)
+                        profiler.Start();
+                    phase = sampling;
+                    phaseStart = now;
+                }
+            }
+            if (intervalNs > 0)
+            {
+                while (now < nextStart)
+                    now = benchClock::Start();
+                batchStart = nextStart;
+                nextStart += intervalNs;
+            }
+            else
+                batchStart = benchClock::Start();
+            return true;
+        }
+
+        bool NextBatch()
+        {
+            int64_t now = benchClock::Stop();
+            if (phase == idle) [[unlikely]]
+            {
+                phase = warmup;
+                phaseStart = now;
+            }
+            else
+            {
+                int64_t elapsed = benchClock::Elapsed(batchStart, now);
+                if (phase == warmup)
+                {
+                    calibrate(elapsed);
+                    if (now - phaseStart >= settings.warmupNs && elapsed * 2 >= settings.sampleNs)
+                    {
+                        if (group != nullptr)
+                            group->StartSampling();
+                        phase = sampling;
+                        samples.reserve(settings.sampleCount); // keep the engine's own allocations out of the count
+                        if (settings.profile && group == nullptr)
+                            profiler.Start();
+                        allocationStart = allocationTally;
+                        allocationTally.peak = allocationTally.live;
+                        if (settings.perfCounters && group == nullptr) // the counters follow the main thread
+                            counters.Start();
+                    }
+                }
+                else if (phase == sampling)
+                {
+                    samples.push_back(static_cast<double>(elapsed) / batch);
+                    if (samples.size() >= settings.sampleCount)
+                    {
+                        if (settings.profile && group == nullptr)
+                            profiler.Stop();
+                        if (settings.perfCounters && group == nullptr)
+                            readCounters();
+                        readAllocations();
+                        if (group == nullptr)
+                        {
+                            phase = idle;
+                            return false;
+                        }
+                        phase = draining;
+                        group->Finish();
+                    }
+                }
+                else if (group->AllFinished())
+                {
+                    phase = idle;
+                    return false;
+                }
+            }
+            batchStart = benchClock::Start();
+            return true;
+        }
+
+    private:
+        enum { idle, warmup, sampling, draining } phase = idle;
+        threadGroup* group = currentGroup;
+        int64_t phaseStart = 0;
+        int64_t batchStart = 0;
+        int64_t nextStart = 0;
+        allocationCounters allocationStart;
+
+        void readAllocations() noexcept
+        {
+            double iterations = static_cast<double>(samples.size() * batch);
+            allocationsPerOp = (allocationTally.allocations - allocationStart.allocations) / iterations;
+            bytesAllocatedPerOp = (allocationTally.bytes - allocationStart.bytes) / iterations;
+            peakLiveBytes = allocationTally.peak - allocationStart.live;
+            allocationTally.peak = std::max(allocationTally.peak, allocationStart.peak);
+        }
+
+        void readCounters() noexcept
+        {
+            counters.Stop();
+            counters.Read(countersPerOp);
+            for (double& value : countersPerOp)
+                if (value >= 0)
+                    value /= static_cast<double>(samples.size() * batch);
+        }
+
+        void calibrate(int64_t Elapsed)
+        {
+            double scale = Elapsed > 0 ? static_cast<double>(settings.sampleNs) / Elapsed : 10;
+            scale = std::clamp(scale, 0.5, 10.0); // move gradually: the first batches run cold
+            batch = std::max<size_t>(1, static_cast<size_t>(batch * scale));
+        }
+    };
+
+    // Least-squares fit of ns/op against the range of a BENCH_RANGE: time = coefficient * f(n) for the
+    // f among 1, log n, n, n log n and n^2 that leaves the smallest relative RMS error
+    struct complexityFit
+    {
+        const char* name = "O(1)";
+        double coefficient = 0;
+        double rms = 0;
+
+        static complexityFit Fit(const std::vector<std::pair<double, double>>& Points)
+        {
+            struct candidate { const char* name; double (*f)(double); };
+            static constexpr candidate candidates[] = {
+                { "O(1)", [](double) { return 1.0; } },
+                { "O(log n)", [](double n) { return std::log2(std::max(n, 2.0)); } },
+                { "O(n)", [](double n) { return n; } },
+                { "O(n log n)", [](double n) { return n * std::log2(std::max(n, 2.0)); } },
+                { "O(n^2)", [](double n) { return n * n; } },
+            };
+
+            complexityFit best;
+            best.rms = INFINITY;
+            double sumTime2 = 0;
+            for (auto& [n, time] : Points)
+                sumTime2 += time * time;
+            for (const candidate& c : candidates)
+            {
+                double sumFT = 0, sumF2 = 0;
+                for (auto& [n, time] : Points)
+                {
+                    sumFT += c.f(n) * time;
+                    sumF2 += c.f(n) * c.f(n);
+                }
+                double coefficient = sumF2 > 0 ? sumFT / sumF2 : 0;
+                double residual = 0;
+                for (auto& [n, time] : Points)
+                    residual += (time - coefficient * c.f(n)) * (time - coefficient * c.f(n));
+                double rms = sumTime2 > 0 ? std::sqrt(residual / sumTime2) : 0;
+                if (rms < best.rms)
+                    best = { c.name, coefficient, rms };
+            }
+            return best;
+        }
+    };
+
+    // Command line of Tester::Run
+    struct runOptions
+    {
+        std::string filter; // benchmarks whose "title - subtitle" matches, * and ? as wildcards
+        size_t repetitions = 1;
+        size_t jobs = std::max(1u, std::thread::hardware_concurrency()); // test threads, 1 runs them all serially
+        std::string jsonPath;
+        std::string csvPath;
+        std::string baselinePath; // JSON written by an earlier --json run
+        std::string profileDirectory; // one collapsed-stack file per benchmark
+        bool profileFramePointers = true;
+        double threshold = 5; // percent of median slowdown that fails the comparison
+        double alpha = 0.05; // significance level of the comparison
+
+        static constexpr const char* usage =
+            "Options:\n"
+            "  --filter=PATTERN     only run the benchmarks matching PATTERN (* and ? wildcards, else substring)\n"
+            "  --repetitions=N      run every benchmark N times and pool the samples\n"
+            "  --jobs=N             run the tests on N threads (default: one per CPU)\n"
+            "  --json=FILE          write the benchmark results as JSON, usable as a baseline\n"
+            "  --csv=FILE           write the benchmark results as CSV\n"
+            "  --baseline=FILE      compare with a JSON baseline and fail on significant regressions\n"
+            "  --threshold=PERCENT  slowdown of the median or throughput, or of p50 and p99, tolerated by --baseline (default 5)\n"
+            "  --alpha=P            significance level of --baseline (default 0.05)\n"
+            "  --profile=DIR        sample the benchmarks and write their collapsed stacks to DIR/<name>.folded\n"
+            "  --profile-unwind=U   fp (default), or pc for builds without frame pointers: the sampled function only\n";
+
+        // An error message when Argv can't be parsed
+        std::optional<std::string> Parse(int Argc, char** Argv)
+        {
+            for (int i = 1; i < Argc; i++)
+            {
+                std::string_view arg = Argv[i];
+                size_t equal = arg.find('=');
+                std::string_view name = arg.substr(0, equal);
+                std::string value(equal == std::string_view::npos ? std::string_view() : arg.substr(equal + 1));
+                char* end = nullptr;
+                if (name == "--filter")
+                    filter = value;
+                else if (name == "--repetitions" && (repetitions = std::strtoul(value.c_str(), &end, 10)) > 0 && *end == 0)
+                    ;
+                else if (name == "--jobs" && (jobs = std::strtoul(value.c_str(), &end, 10)) > 0 && *end == 0)
+                    ;
+                else if (name == "--json" && !value.empty())
+                    jsonPath = value;
+                else if (name == "--csv" && !value.empty())
+                    csvPath = value;
+                else if (name == "--baseline" && !value.empty())
+                    baselinePath = value;
+                else if (name == "--profile" && !value.empty())
+                    profileDirectory = value;
+                else if (name == "--profile-unwind" && (value == "fp" || value == "pc"))
+                    profileFramePointers = value == "fp";
+                else if (name == "--threshold" && (threshold = std::strtod(value.c_str(), &end)) >= 0 && *end == 0 && !value.empty())
+                    ;
+                else if (name == "--alpha" && (alpha = std::strtod(value.c_str(), &end)) > 0 && alpha < 1 && *end == 0)
+                    ;
+                else
+                    return "invalid option " + std::string(arg);
+            }
+            return std::nullopt;
+        }
+    };
+
+    // Whole-string match; without wildcards Pattern only needs to appear in Text
+    inline bool matchesFilter(std::string_view Pattern, std::string_view Text) noexcept
+    {
+        if (Pattern.find_first_of("*?") == std::string_view::npos)
+            return Text.find(Pattern) != std::string_view::npos;
+        size_t p = 0, t = 0, star = std::string_view::npos, resume = 0;
+        while (t < Text.size())
+        {
+            if (p < Pattern.size() && (Pattern[p] == '?' || Pattern[p] == Text[t]))
+            {
+                p++;
+                t++;
+            }
+            else if (p < Pattern.size() && Pattern[p] == '*')
+            {
+                star = p++;
+                resume = t;
+            }
+            else if (star != std::string_view::npos)
+            {
+                p = star + 1;
+                t = ++resume;
+            }
+            else
+                return false;
+        }
+        while (p < Pattern.size() && Pattern[p] == '*')
+            p++;
+        return p == Pattern.size();
+    }
+
+    // Mann-Whitney U test, normal approximation with tie correction: the two-sided p-value of Before and
+    // After coming from the same distribution
+    inline double mannWhitney(const std::vector<double>& Before, const std::vector<double>& After)
+    {
+        double n1 = static_cast<double>(Before.size()), n2 = static_cast<double>(After.size());
+        if (n1 == 0 || n2 == 0)
+            return 1;
+        std::vector<std::pair<double, bool>> all; // value, from After
+        all.reserve(Before.size() + After.size());
+        for (double value : Before)
+            all.push_back({ value, false });
+        for (double value : After)
+            all.push_back({ value, true });
+        std::sort(all.begin(), all.end());
+
+        double rankSum = 0, tieCorrection = 0;
+        for (size_t i = 0; i < all.size();)
+        {
+            size_t j = i;
+            while (j < all.size() && all[j].first == all[i].first)
+                j++;
+            double rank = (i + j + 1) / 2.0, ties = static_cast<double>(j - i);
+            for (size_t k = i; k < j; k++)
+                if (all[k].second)
+                    rankSum += rank;
+            tieCorrection += ties * ties * ties - ties;
+            i = j;
+        }
+        double u = rankSum - n2 * (n2 + 1) / 2;
+        double n = n1 + n2;
+        double variance = n1 * n2 / 12 * (n + 1 - tieCorrection / (n * (n - 1)));
+        if (variance <= 0)
+            return 1;
+        double z = (u - n1 * n2 / 2) / std::sqrt(variance);
+        return std::erfc(std::abs(z) / std::sqrt(2.0));
+    }
+
+    // Just enough JSON to read back the files --json writes
+    struct jsonValue
+    {
+        enum class kind { null, boolean, number, string, array, object } type = kind::null;
+        double number = 0;
+        std::string text;
+        std::vector<jsonValue> items;
+        std::vector<std::pair<std::string, jsonValue>> members;
+
+        [[nodiscard]] const jsonValue* Find(std::string_view Key) const noexcept
+        {
+            for (auto& [key, value] : members)
+                if (key == Key)
+                    return &value;
+            return nullptr;
+        }
+
+        [[nodiscard]] double NumberOr(std::string_view Key, double Default) const noexcept
+        {
+            const jsonValue* value = Find(Key);
+            return value != nullptr && value->type == kind::number ? value->number : Default;
+        }
+
+        static std::optional<jsonValue> Parse(std::string_view Text)
+        {
+            size_t at = 0;
+            std::optional<jsonValue> value = parseValue(Text, at, 0);
+            skipSpaces(Text, at);
+            if (!value || at != Text.size())
+                return std::nullopt;
+            return value;
+        }
+
+    private:
+        static void skipSpaces(std::string_view Text, size_t& At) noexcept
+        {
+            while (At < Text.size() && (Text[At] == ' ' || Text[At] == '\n' || Text[At] == '\r' || Text[At] == '\t'))
+                At++;
+        }
+
+        static std::optional<std::string> parseString(std::string_view Text, size_t& At)
+        {
+            if (At >= Text.size() || Text[At] != '"')
+                return std::nullopt;
+            std::string out;
+            for (At++; At < Text.size(); At++)
+            {
+                char c = Text[At];
+                if (c == '"')
+                {
+                    At++;
+                    return out;
+                }
+                if (c != '\\')
+                {
+                    out += c;
+                    continue;
+                }
+                if (++At >= Text.size())
+                    return std::nullopt;
+                switch (Text[At])
+                {
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u':
+                {
+                    if (At + 4 >= Text.size())
+                        return std::nullopt;
+                    unsigned code = static_cast<unsigned>(std::strtoul(std::string(Text.substr(At + 1, 4)).c_str(), nullptr, 16));
+                    At += 4;
+                    if (code < 0x80)
+                        out += static_cast<char>(code);
+                    else if (code < 0x800)
+                    {
+                        out += static_cast<char>(0xC0 | code >> 6);
+                        out += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    else
+                    {
+                        out += static_cast<char>(0xE0 | code >> 12);
+                        out += static_cast<char>(0x80 | (code >> 6 & 0x3F));
+                        out += static_cast<char>(0x80 | (code & 0x3F));
+                    }
+                    break;
+                }
+                default: return std::nullopt;
+                }
+            }
+            return std::nullopt;
+        }
+
+        static std::optional<jsonValue> parseValue(std::string_view Text, size_t& At, int Depth)
+        {
+            skipSpaces(Text, At);
+            if (At >= Text.size() || Depth > 64)
+                return std::nullopt;
+            jsonValue value;
+            char c = Text[At];
+            if (c == '{' || c == '[')
+            {
+                bool object = c == '{';
+                value.type = object ? kind::object : kind::array;
+                At++;
+                skipSpaces(Text, At);
+                if (At < Text.size() && Text[At] == (object ? '}' : ']'))
+                {
+                    At++;
+                    return value;
+                }
+                while (true)
+                {
+                    std::string key;
+                    if (object)
+                    {
+                        skipSpaces(Text, At);
+                        std::optional<std::string> name = parseString(Text, At);
+                        skipSpaces(Text, At);
+                        if (!name || At >= Text.size() || Text[At++] != ':')
+                            return std::nullopt;
+                        key = std::move(*name);
+                    }
+                    std::optional<jsonValue> item = parseValue(Text, At, Depth + 1);
+                    if (!item)
+                        return std::nullopt;
+                    if (object)
+                        value.members.push_back({ std::move(key), std::move(*item) });
+                    else
+                        value.items.push_back(std::move(*item));
+                    skipSpaces(Text, At);
+                    if (At >= Text.size())
+                        return std::nullopt;
+                    char separator = Text[At++];
+                    if (separator == (object ? '}' : ']'))
+                        return value;
+                    if (separator != ',')
+                        return std::nullopt;
+                }
+            }
+            if (c == '"')
+            {
+                std::optional<std::string> text = parseString(Text, At);
+                if (!text)
+                    return std::nullopt;
+                value.type = kind::string;
+                value.text = std::move(*text);
+                return value;
+            }
+            for (std::string_view word : { "true", "false", "null" })
+                if (Text.substr(At, word.size()) == word)
+                {
+                    At += word.size();
+                    value.type = word == "null" ? kind::null : kind::boolean;
+                    value.number = word == "true";
+                    return value;
+                }
+            std::string number(Text.substr(At, std::min<size_t>(Text.size() - At, 64)));
+            char* end = nullptr;
+            value.number = std::strtod(number.c_str(), &end);
+            if (end == number.c_str())
+                return std::nullopt;
+            value.type = kind::number;
+            At += static_cast<size_t>(end - number.c_str());
+            return value;
+        }
+    };
+
+    // One measured configuration of a benchmark, as written to --json/--csv and read from --baseline
+    struct benchResult
+    {
+        std::string name; // "title - subtitle"
+        size_t range = 0; // BENCH_RANGE size, 0 otherwise
+        size_t threads = 0; // BENCH_THREADS step, 0 otherwise
+        benchStats stats; // of samples, in ns/op
+        double iterationsPerSecond = 0;
+        double itemsPerSecond = 0; // SetItemsProcessed() benchmarks only
+        double bytesPerSecond = 0; // SetBytesProcessed() benchmarks only
+        std::vector<double> samples;
+        uint64_t latency[5] = {}; // p50, p90, p99, p99.9 and max in ns, START_LATENCY only
+
+        static constexpr const char* latencyNames[5] = { "p50_ns", "p90_ns", "p99_ns", "p999_ns", "max_ns" };
+
+        [[nodiscard]] std::string Label() const
+        {
+            std::string label = name;
+            if (range != 0)
+                label += " [n=" + std::to_string(range) + ']';
+            if (threads != 0)
+                label += " [threads=" + std::to_string(threads) + ']';
+            return label;
+        }
+
+        static void writeString(std::ostream& Out, std::string_view Text)
+        {
+            Out << '"';
+            for (char c : Text)
+            {
+                if (c == '"' || c == '\\')
+                    Out << '\\' << c;
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escaped[8];
+                    snprintf(escaped, sizeof escaped, "\\u%04x", c);
+                    Out << escaped;
+                }
+                else
+                    Out << c;
+            }
+            Out << '"';
+        }
+
+        static std::string number(double Value)
+        {
+            char text[32];
+            snprintf(text, sizeof text, "%.10g", std::isfinite(Value) ? Value : 0.0);
+            return text;
+        }
+
+        static void WriteJson(std::ostream& Out, const std::vector<benchResult>& Results)
+        {
+            Out << "{\n  \"benchmarks\": [";
+            for (size_t i = 0; i < Results.size(); i++)
+            {
+                const benchResult& result = Results[i];
+                Out << (i == 0 ? "\n" : ",\n") << "    { \"name\": ";
+                writeString(Out, result.name);
+                Out << ", \"range\": " << result.range << ", \"threads\": " << result.threads
+                    << ", \"median_ns\": " << number(result.stats.median) << ", \"mad_ns\": " << number(result.stats.mad)
+                    << ", \"mean_ns\": " << number(result.stats.mean) << ", \"stddev_ns\": " << number(result.stats.stddev)
+                    << ", \"cv\": " << number(result.stats.cv) << ", \"min_ns\": " << number(result.stats.min)
+                    << ", \"iterations_per_second\": " << number(result.iterationsPerSecond)
+                    << ", \"items_per_second\": " << number(result.itemsPerSecond)
+                    << ", \"bytes_per_second\": " << number(result.bytesPerSecond);
+                for (size_t k = 0; k < 5; k++)
+                    Out << ", \"" << latencyNames[k] << "\": " << result.latency[k];
+                Out << ", \"samples\": [";
+                for (size_t k = 0; k < result.samples.size(); k++)
+                    Out << (k == 0 ? "" : ", ") << number(result.samples[k]);
+                Out << "] }";
+            }
+            Out << "\n  ]\n}\n";
+        }
+
+        static void WriteCsv(std::ostream& Out, const std::vector<benchResult>& Results)
+        {
+            Out << "name,range,threads,median_ns,mad_ns,mean_ns,stddev_ns,cv,min_ns,iterations_per_second,items_per_second,bytes_per_second,"
+                "p50_ns,p90_ns,p99_ns,p999_ns,max_ns,samples\n";
+            for (const benchResult& result : Results)
+            {
+                Out << '"';
+                for (char c : result.name)
+                    Out << (c == '"' ? "\"\"" : std::string(1, c));
+                Out << "\"," << result.range << ',' << result.threads << ',' << number(result.stats.median) << ',' << number(result.stats.mad)
+                    << ',' << number(result.stats.mean) << ',' << number(result.stats.stddev) << ',' << number(result.stats.cv)
+                    << ',' << number(result.stats.min) << ',' << number(result.iterationsPerSecond) << ',' << number(result.itemsPerSecond)
+                    << ',' << number(result.bytesPerSecond);
+                for (uint64_t value : result.latency)
+                    Out << ',' << value;
+                Out << ',' << result.samples.size() << '\n';
+            }
+        }
+
+        static std::optional<std::vector<benchResult>> ReadJson(std::string_view Text)
+        {
+            std::optional<jsonValue> root = jsonValue::Parse(Text);
+            const jsonValue* list = root ? root->Find("benchmarks") : nullptr;
+            if (list == nullptr || list->type != jsonValue::kind::array)
+                return std::nullopt;
+            std::vector<benchResult> results;
+            for (const jsonValue& item : list->items)
+            {
+                const jsonValue* name = item.Find("name");
+                if (item.type != jsonValue::kind::object || name == nullptr || name->type != jsonValue::kind::string)
+                    return std::nullopt;
+                benchResult result;
+                result.name = name->text;
+                result.range = static_cast<size_t>(item.NumberOr("range", 0));
+                result.threads = static_cast<size_t>(item.NumberOr("threads", 0));
+                result.stats.median = item.NumberOr("median_ns", 0);
+                result.stats.mad = item.NumberOr("mad_ns", 0);
+                result.stats.mean = item.NumberOr("mean_ns", 0);
+                result.stats.stddev = item.NumberOr("stddev_ns", 0);
+                result.stats.cv = item.NumberOr("cv", 0);
+                result.stats.min = item.NumberOr("min_ns", 0);
+                result.iterationsPerSecond = item.NumberOr("iterations_per_second", 0);
+                result.itemsPerSecond = item.NumberOr("items_per_second", 0);
+                result.bytesPerSecond = item.NumberOr("bytes_per_second", 0);
+                for (size_t k = 0; k < 5; k++)
+                    result.latency[k] = static_cast<uint64_t>(item.NumberOr(latencyNames[k], 0));
+                if (const jsonValue* samples = item.Find("samples"); samples != nullptr)
+                    for (const jsonValue& sample : samples->items)
+                        result.samples.push_back(sample.number);
+                results.push_back(std::move(result));
+            }
+            return results;
+        }
+    };
+
+    // A benchmark regresses when its median slows down by more than Threshold percent and the samples
+    // differ significantly; the reverse counts as an improvement. When both runs report a throughput,
+    // items/s or else bytes/s, its drop is measured instead of the median's rise, which also gates the
+    // aggregate throughput of BENCH_THREADS. START_LATENCY results keep no samples: they regress when
+    // p50 or p99 slows down by more than Threshold percent, and improve when both speed up.
+    struct benchComparison
+    {
+        enum { unchanged, regressed, improved, incomparable } verdict = incomparable;
+        double change = 0; // relative slowdown: of the median, of the time per item or byte, or of the slower of p50 and p99
+        double p = 1; // 0 for latency results, which have no test
+        bool latency = false;
+        bool throughput = false;
+
+        // Items/s when both runs count items, else bytes/s when both count bytes, else { 0, 0 }
+        [[nodiscard]] static std::pair<double, double> Throughputs(const benchResult& Baseline, const benchResult& Current) noexcept
+        {
+            if (Baseline.itemsPerSecond > 0 && Current.itemsPerSecond > 0)
+                return { Baseline.itemsPerSecond, Current.itemsPerSecond };
+            if (Baseline.bytesPerSecond > 0 && Current.bytesPerSecond > 0)
+                return { Baseline.bytesPerSecond, Current.bytesPerSecond };
+            return { 0, 0 };
+        }
+
+        static benchComparison Compare(const benchResult& Baseline, const benchResult& Current, double Threshold, double Alpha)
+        {
+            benchComparison comparison;
+            if (Baseline.samples.empty() && Current.samples.empty())
+                return compareLatency(Baseline, Current, Threshold);
+            if (Baseline.samples.empty() || Current.samples.empty() || Baseline.stats.median <= 0)
+                return comparison;
+            auto [before, after] = Throughputs(Baseline, Current);
+            comparison.throughput = before > 0;
+            comparison.change = comparison.throughput ? before / after - 1 : Current.stats.median / Baseline.stats.median - 1;
+            comparison.p = mannWhitney(Baseline.samples, Current.samples);
+            comparison.verdict = unchanged;
+            if (comparison.p < Alpha && std::abs(comparison.change) * 100 > Threshold)
+                comparison.verdict = comparison.change > 0 ? regressed : improved;
+            return comparison;
+        }
+
+    private:
+        static benchComparison compareLatency(const benchResult& Baseline, const benchResult& Current, double Threshold)
+        {
+            benchComparison comparison;
+            if (Baseline.latency[0] == 0 || Baseline.latency[2] == 0 || Current.latency[0] == 0 || Current.latency[2] == 0)
+                return comparison;
+            double p50 = static_cast<double>(Current.latency[0]) / Baseline.latency[0] - 1;
+            double p99 = static_cast<double>(Current.latency[2]) / Baseline.latency[2] - 1;
+            comparison.latency = true;
+            comparison.p = 0;
+            comparison.change = std::max(p50, p99);
+            comparison.verdict = unchanged;
+            if (comparison.change * 100 > Threshold)
+                comparison.verdict = regressed;
+            else if (-comparison.change * 100 > Threshold)
+                comparison.verdict = improved;
+            return comparison;
+        }
     };
 
     struct registrar {
         struct testEntity {
             std::string title, subTitle;
             std::function<testRet()> func;
-            testEntity(std::string Title, std::string SubTitle, std::function<testRet()> Func)
-                : title(std::move(Title)), subTitle(std::move(SubTitle)), func(Func)
+            bool serial = false; // TEST_SERIAL: runs alone, once the parallel tests are done
+            testEntity(std::string Title, std::string SubTitle, std::function<testRet()> Func, bool Serial = false)
+                : title(std::move(Title)), subTitle(std::move(SubTitle)), func(Func), serial(Serial)
             {}
         };
+        struct serialTag {};
         struct benchEntity {
             std::string title, subTitle;
-            std::function<benchRet()> func;
-            benchEntity(std::string Title, std::string SubTitle, std::function<benchRet()> Func)
-                : title(std::move(Title)), subTitle(std::move(SubTitle)), func(Func)
+            std::function<benchRet(size_t)> func;
+            std::vector<size_t> ranges; // empty unless registered with BENCH_RANGE
+            bool threaded = false; // BENCH_THREADS: func takes the thread index
+            benchEntity(std::string Title, std::string SubTitle, std::function<benchRet(size_t)> Func, std::vector<size_t> Ranges = {}, bool Threaded = false)
+                : title(std::move(Title)), subTitle(std::move(SubTitle)), func(Func), ranges(std::move(Ranges)), threaded(Threaded)
             {}
         };
+        struct threadsTag {};
 
         inline static std::vector<testEntity> testers;
         registrar(std::string Title, std::string SubTitle, std::function<testRet()> Func) {
             testers.push_back(testEntity(std::move(Title), std::move(SubTitle), Func));
         }
+        registrar(std::string Title, std::string SubTitle, serialTag, std::function<testRet()> Func) {
+            testers.push_back(testEntity(std::move(Title), std::move(SubTitle), Func, true));
+        }
         inline static std::vector<benchEntity> benchers;
-        registrar(std::string Title, std::string SubTitle, std::function<benchRet()> Func) {
+        registrar(std::string Title, std::string SubTitle, std::function<benchRet(size_t)> Func) {
             benchers.push_back(benchEntity(std::move(Title), std::move(SubTitle), Func));
         }
+        // Runs Func for Low, Low * Multiplier, Low * Multiplier^2... up to and including High
+        registrar(std::string Title, std::string SubTitle, size_t Low, size_t High, size_t Multiplier, std::function<benchRet(size_t)> Func) {
+            std::vector<size_t> ranges;
+            for (size_t n = Low; n < High; n *= Multiplier)
+                ranges.push_back(n);
+            ranges.push_back(High);
+            benchers.push_back(benchEntity(std::move(Title), std::move(SubTitle), Func, std::move(ranges)));
+        }
+        // Runs Func on 1, 2, 4... up to settings.maxThreads threads at once
+        registrar(std::string Title, std::string SubTitle, threadsTag, std::function<benchRet(size_t)> Func) {
+            benchers.push_back(benchEntity(std::move(Title), std::move(SubTitle), Func, {}, true));
+        }
     };
 
+    // Runs Func on every task over Threads workers. Each worker starts with a contiguous share of the tasks,
+    // takes from the front of its own deque and, once that is empty, steals from the back of the others'.
+    inline void runWorkStealing(const std::vector<size_t>& Tasks, size_t Threads, const std::function<void(size_t)>& Func)
+    {
+        struct workerQueue
+        {
+            std::mutex lock;
+            std::deque<size_t> tasks;
+        };
+        Threads = std::max<size_t>(1, std::min(Threads, Tasks.size()));
+        std::vector<workerQueue> queues(Threads);
+        for (size_t i = 0; i < Tasks.size(); i++)
+            queues[i * Threads / Tasks.size()].tasks.push_back(Tasks[i]);
+
+        auto work = [&](size_t Self)
+        {
+            while (true)
+            {
+                std::optional<size_t> task;
+                for (size_t k = 0; k < Threads && !task; k++)
+                {
+                    workerQueue& queue = queues[(Self + k) % Threads];
+                    std::lock_guard<std::mutex> guard(queue.lock);
+                    if (queue.tasks.empty())
+                        continue;
+                    if (k == 0)
+                    {
+                        task = queue.tasks.front();
+                        queue.tasks.pop_front();
+                    }
+                    else
+                    {
+                        task = queue.tasks.back();
+                        queue.tasks.pop_back();
+                    }
+                }
+                if (!task) // no task is ever added, so every queue stays empty from here
+                    return;
+                Func(*task);
+            }
+        };
+        std::vector<std::thread> workers;
+        for (size_t i = 1; i < Threads; i++)
+            workers.emplace_back(work, i);
+        work(0);
+        for (std::thread& worker : workers)
+            worker.join();
+    }
+
+    // One BENCH_THREADS step: Threads pinned threads run Func behind a start barrier, results by thread index
+    inline std::vector<benchRet> runThreads(const std::function<benchRet(size_t)>& Func, size_t Threads)
+    {
+        threadGroup group(Threads);
+        std::vector<benchRet> results(Threads);
+        std::vector<std::thread> workers;
+        workers.reserve(Threads);
+        for (size_t i = 0; i < Threads; i++)
+            workers.emplace_back([&, i]()
+            {
+                pinThread(i);
+                currentGroup = &group;
+                group.Start();
+                results[i] = Func(i);
+                currentGroup = nullptr;
+            });
+        for (std::thread& worker : workers)
+            worker.join();
+        return results;
+    }
+
 #define GET_LOCATION __FILE__ + std::string(":") + std::to_string(__LINE__)
 
 #define CONCAT(a, b) CONCAT_INNER(a, b)
@@ -55,45 +1551,194 @@ namespace
 #define UNIQUE_NAME(base) CONCAT(base, __COUNTER__)
 
 #define TESTER(name, message, func) registrar UNIQUE_NAME(t)(name, message, []() -> testRet { testRet r; func return r; });
-#define BENCHER(name, message, func) registrar UNIQUE_NAME(b)(name, message, []() -> benchRet { benchRet r; func return r; });
+#define TESTER_SERIAL(name, message, func) registrar UNIQUE_NAME(t)(name, message, registrar::serialTag{}, []() -> testRet { testRet r; func return r; });
+#define BENCHER(name, message, func) registrar UNIQUE_NAME(b)(name, message, [](size_t) -> benchRet { benchRet r; func return r; });
+#define BENCH_RANGER(name, message, low, high, multiplier, func) registrar UNIQUE_NAME(b)(name, message, low, high, multiplier, [](size_t Range) -> benchRet { benchRet r; r.range = Range; func return r; });
+#define BENCH_THREADER(name, message, func) registrar UNIQUE_NAME(b)(name, message, registrar::threadsTag{}, [](size_t Index) -> benchRet { benchRet r; r.threadIndex = Index; r.threadCount = currentGroup->count; func return r; });
 #define EXPECTER(title, statement) r.AddStatement(std::string("[EXPECT] ")+title, statement, GET_LOCATION);
-#define ASSERTER(title, statement) r.AddStatement(std::string("[ASSERT] ")+title, statement, GET_LOCATION); if (statement == false) return r;
+#define ASSERTER(title, statement) r.AddStatement(std::string("[ASSERT] ")+title, statement, GET_LOCATION); if (!(statement)) return r;
 }
 
 #define TEST(...) TESTER(__VA_ARGS__)
+#define TEST_SERIAL(...) TESTER_SERIAL(__VA_ARGS__)
 #define BENCH(...) BENCHER(__VA_ARGS__)
+#define BENCH_RANGE(...) BENCH_RANGER(__VA_ARGS__)
+#define BENCH_THREADS(...) BENCH_THREADER(__VA_ARGS__)
 #define EXPECT(...) EXPECTER(__VA_ARGS__)
 #define ASSERT(...) ASSERTER(__VA_ARGS__)
 
 #define START_BENCH \
-    auto t1 = std::chrono::high_resolution_clock::now(); \
-    auto t2 = std::chrono::high_resolution_clock::now(); \
-    while (duration_cast<std::chrono::milliseconds>(t2-t1).count() < 1000) [[unlikely]] {
+    while (r.NextBatch()) [[likely]] \
+        for (size_t benchIteration = r.batch; benchIteration != 0; --benchIteration) {
 
 #define STOP_BENCH \
-        t2 = std::chrono::high_resolution_clock::now(); \
-        r.counter++; \
+        Tester::ClobberMemory(); \
     }
 
+#define START_LATENCY \
+    while (r.NextOperation()) [[likely]] \
+        for (size_t benchIteration = r.batch; benchIteration != 0; --benchIteration) {
+
+#define STOP_LATENCY STOP_BENCH
+
 namespace Tester
 {
-    int Run()
+    struct AllocationStats
+    {
+        uint64_t Allocations = 0;
+        uint64_t Frees = 0;
+        uint64_t Bytes = 0;
+        uint64_t PeakLiveBytes = 0; // above the live bytes when the scope started
+    };
+
+    // Counts the current thread's heap allocations from construction on. Needs TESTER_COUNT_ALLOCATIONS,
+    // without which every figure stays 0.
+    class AllocationScope
+    {
+    public:
+        AllocationScope() noexcept
+            : allocations(allocationTally.allocations), frees(allocationTally.frees), bytes(allocationTally.bytes),
+            live(allocationTally.live), outerPeak(allocationTally.peak)
+        {
+            allocationTally.peak = allocationTally.live;
+        }
+
+        ~AllocationScope() { allocationTally.peak = std::max(allocationTally.peak, outerPeak); }
+
+        [[nodiscard]] AllocationStats Get() const noexcept
+        {
+            return {
+                allocationTally.allocations - allocations,
+                allocationTally.frees - frees,
+                allocationTally.bytes - bytes,
+                allocationTally.peak > live ? allocationTally.peak - live : 0,
+            };
+        }
+
+    private:
+        uint64_t allocations;
+        uint64_t frees;
+        uint64_t bytes;
+        uint64_t live;
+        uint64_t outerPeak;
+    };
+
+    template<typename F>
+    AllocationStats CountAllocations(F&& Func)
+    {
+        AllocationScope scope;
+        Func();
+        return scope.Get();
+    }
+
+    inline constexpr bool CountsAllocations = countsAllocations;
+
+    // Keeps Value, and every write it depends on, from being optimized away
+    template<typename T>
+    inline void DoNotOptimize(const T& Value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : "r,m"(Value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &Value;
+#endif
+    }
+
+    template<typename T>
+    inline void DoNotOptimize(T& Value)
+    {
+#if defined(__GNUC__)
+        asm volatile("" : "+r,m"(Value) : : "memory");
+#else
+        static volatile void* sink;
+        sink = &Value;
+#endif
+    }
+
+    // Forces pending writes to memory
+    inline void ClobberMemory()
+    {
+#if defined(__GNUC__)
+        asm volatile("" : : : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    // Takes the options listed in runOptions::usage. Returns minus the number of failed statements and of
+    // benchmarks regressed against --baseline.
+    int Run(int Argc = 0, char** Argv = nullptr)
     {
         static bool hasRan = false;
         if (hasRan) return -1;
         hasRan = true;
 
+        runOptions options;
+        if (std::optional<std::string> error = options.Parse(Argc, Argv))
+        {
+            std::cout << *error << '\n' << runOptions::usage;
+            return -1;
+        }
+
         int nbTestFailed = 0, nbTestPassed = 0;
         int nbBigTestFailed = 0;
 
         std::cout << "Starting tests..." << std::endl;
 
-        for (auto fn : registrar::testers)
+        // Tests run on a work-stealing pool while this thread prints their buffered statements in registration
+        // order; a TEST_SERIAL waits for the pool to drain and runs here, alone.
+        struct testOutcome
         {
+            testRet r;
+            int64_t durationNs = 0;
+            AllocationStats allocated;
+            bool done = false;
+        };
+        std::vector<testOutcome> outcomes(registrar::testers.size());
+        std::mutex outcomesLock;
+        std::condition_variable outcomeDone;
+        auto runTest = [&](size_t Index)
+        {
+            testOutcome outcome;
+            AllocationScope allocations;
+            int64_t start = steadyTimer::Now();
+            outcome.r = registrar::testers[Index].func();
+            outcome.durationNs = steadyTimer::Now() - start;
+            outcome.allocated = allocations.Get();
+            outcome.done = true;
+            std::lock_guard<std::mutex> guard(outcomesLock);
+            outcomes[Index] = std::move(outcome);
+            outcomeDone.notify_all();
+        };
+
+        std::vector<size_t> parallel;
+        for (size_t i = 0; i < registrar::testers.size(); i++)
+            if (!registrar::testers[i].serial)
+                parallel.push_back(i);
+        int64_t testsStart = steadyTimer::Now();
+        std::thread pool([&]() { runWorkStealing(parallel, options.jobs, runTest); });
+
+        int64_t testsBusyNs = 0;
+        for (size_t i = 0; i < registrar::testers.size(); i++)
+        {
+            const registrar::testEntity& fn = registrar::testers[i];
+            if (fn.serial)
+            {
+                if (pool.joinable())
+                    pool.join();
+                runTest(i);
+            }
+            std::unique_lock<std::mutex> guard(outcomesLock);
+            outcomeDone.wait(guard, [&]() { return outcomes[i].done; });
+            guard.unlock();
+            const testOutcome& outcome = outcomes[i];
+            const testRet& r = outcome.r;
+            const AllocationStats& allocated = outcome.allocated;
+            testsBusyNs += outcome.durationNs;
+
             bool success = true;
             std::cout << "Starting to test: " << fn.title << " - " << fn.subTitle << std::endl;
-            testRet r = fn.func();
-
             for (auto& test : r.statements)
             {
                 auto [subTitle, status, location] = test;
@@ -111,23 +1756,387 @@ namespace Tester
             }
 
             nbBigTestFailed += !success;
+            char took[64];
+            snprintf(took, sizeof took, "    Took %.2f ms", outcome.durationNs / 1e6);
+            std::cout << took << std::endl;
+            if constexpr (CountsAllocations)
+                std::cout << "    Allocations: " << allocated.Allocations << " (" << allocated.Bytes << " bytes), peak "
+                    << allocated.PeakLiveBytes << " bytes live" << std::endl;
         }
 
+        if (pool.joinable())
+            pool.join();
+
+        char timing[128];
+        snprintf(timing, sizeof timing, "%.1f ms on %zu thread%s, %.1f ms of test time", (steadyTimer::Now() - testsStart) / 1e6,
+            options.jobs, options.jobs > 1 ? "s" : "", testsBusyNs / 1e6);
         std::cout << "Tests executed:\t\t" << registrar::testers.size()
             << " (Passed: " << registrar::testers.size() - nbBigTestFailed << ", Failed: " << nbBigTestFailed << ')'
             << "\nStatements executed:\t" << nbTestFailed + nbTestPassed
-            << " (Passed: " << nbTestPassed << ", Failed: " << nbTestFailed << ')' << std::endl;
+            << " (Passed: " << nbTestPassed << ", Failed: " << nbTestFailed << ')'
+            << "\nTests took:\t\t" << timing << std::endl;
 
         std::cout << "\nStarting benchs..." << std::endl;
+        {
+            char timer[128];
+            if (benchClock::UsesTsc())
+                snprintf(timer, sizeof timer, "Timer: invariant TSC at %.3f GHz, %lld ns overhead subtracted", tscClock::GHz(),
+                    static_cast<long long>(benchClock::Overhead()));
+            else
+                snprintf(timer, sizeof timer, "Timer: steady_clock%s, %lld ns overhead subtracted", tscClock::Usable() ? "" : " (no invariant TSC)",
+                    static_cast<long long>(benchClock::Overhead()));
+            std::cout << timer << std::endl;
+        }
+
+        if (const char* perf = std::getenv("TESTER_PERF_COUNTERS"); perf != nullptr && perf[0] == '1')
+        {
+            settings.perfCounters = counters.Open();
+            if (!counters.error.empty())
+                std::cout << "Some performance counters are unavailable (" << counters.error << ")"
+                    << (settings.perfCounters ? ", continuing with the others" : ", continuing without them") << std::endl;
+        }
+
+        if (const char* threads = std::getenv("TESTER_THREADS"); threads != nullptr && std::atoi(threads) > 0)
+            settings.maxThreads = static_cast<size_t>(std::atoi(threads));
+
+        if (!options.profileDirectory.empty())
+        {
+            settings.profile = samplingProfiler::Available();
+            profiler.framePointers = options.profileFramePointers;
+#if defined(TESTER_HAS_PROFILER)
+            mkdir(options.profileDirectory.c_str(), 0755);
+#endif
+            if (!settings.profile)
+                std::cout << "The sampling profiler needs Linux on x86-64, continuing without it" << std::endl;
+        }
+        // Collapsed stacks of the benchmark that just ran, named after its label
+        auto writeProfile = [&options](const std::string& Label)
+        {
+            std::string file;
+            for (char c : Label)
+                file += std::isalnum(static_cast<unsigned char>(c)) || c == '-' ? c : '_';
+            std::string path = options.profileDirectory + '/' + file + ".folded";
+            std::ofstream out(path);
+            profiler.Write(out);
+            std::cout << "    Profile: " << profiler.Count() << " samples";
+            if (profiler.dropped > 0)
+                std::cout << " (" << profiler.dropped << " dropped)";
+            std::cout << (out ? " written to " : " could not be written to ") << path << std::endl;
+            profiler.Clear();
+        };
+
+        std::vector<benchResult> results;
+
+        auto runBench = [&](const registrar::benchEntity& fn, size_t Range) -> benchRet
+        {
+            std::cout << "Starting to benchmark: " << fn.title << " - " << fn.subTitle;
+            if (!fn.ranges.empty())
+                std::cout << " [n=" << Range << ']';
+            std::cout << "...\t" << std::flush;
+            benchRet r = fn.func(Range);
+            for (size_t i = 1; i < options.repetitions; i++)
+                r.Merge(fn.func(Range));
+
+            benchResult& result = results.emplace_back();
+            result.name = fn.title + " - " + fn.subTitle;
+            result.range = Range;
+            result.samples = r.samples;
+            result.stats = benchStats::Compute(r.samples);
+            result.iterationsPerSecond = result.stats.median > 0 ? 1e9 / result.stats.median : static_cast<double>(r.counter) / r.repetitions;
+            result.itemsPerSecond = r.itemsPerOp * result.iterationsPerSecond;
+            result.bytesPerSecond = r.bytesPerOp * result.iterationsPerSecond;
+
+            if (r.latency.Count() > 0)
+            {
+                auto format = [](double Ns)
+                {
+                    char text[32];
+                    if (Ns < 1e3)
+                        snprintf(text, sizeof text, "%.0f ns", Ns);
+                    else if (Ns < 1e6)
+                        snprintf(text, sizeof text, "%.1f us", Ns / 1e3);
+                    else
+                        snprintf(text, sizeof text, "%.1f ms", Ns / 1e6);
+                    return std::string(text);
+                };
+                const latencyHistogram& h = r.latency;
+                result.latency[0] = h.ValueAtPercentile(50);
+                result.latency[1] = h.ValueAtPercentile(90);
+                result.latency[2] = h.ValueAtPercentile(99);
+                result.latency[3] = h.ValueAtPercentile(99.9);
+                result.latency[4] = h.max;
+                result.iterationsPerSecond = h.Mean() > 0 ? 1e9 / h.Mean() : 0;
+                std::cout << "p50 " << format(h.ValueAtPercentile(50)) << ", p90 " << format(h.ValueAtPercentile(90))
+                    << ", p99 " << format(h.ValueAtPercentile(99)) << ", p99.9 " << format(h.ValueAtPercentile(99.9))
+                    << ", max " << format(h.max) << " (mean " << format(h.Mean()) << ", " << h.Count() << " operations";
+                if (r.intervalNs > 0)
+                    std::cout << " at " << 1e9 / r.intervalNs << " op/s";
+                std::cout << ')' << std::endl;
+                return r;
+            }
+            if (r.samples.empty())
+            {
+                std::cout << r.counter / static_cast<int>(r.repetitions) << " iteration/s" << std::endl;
+                return r;
+            }
+            const benchStats& stats = result.stats;
+            char line[256];
+            int length = snprintf(line, sizeof line, "%.2f ns/op (MAD %.2f ns, CV %.1f%%, %zu samples), %.0f iteration/s",
+                stats.median, stats.mad, stats.cv * 100, r.samples.size(), stats.median > 0 ? 1e9 / stats.median : 0.0);
+            if (r.bytesPerOp > 0 && stats.median > 0)
+                length += snprintf(line + length, sizeof line - length, ", %.1f MB/s", r.bytesPerOp * 1e3 / stats.median);
+            if (r.itemsPerOp > 0 && stats.median > 0)
+                length += snprintf(line + length, sizeof line - length, ", %.3g items/s", r.itemsPerOp * 1e9 / stats.median);
+            std::cout << line << std::endl;
+
+            if constexpr (CountsAllocations)
+            {
+                snprintf(line, sizeof line, "    Allocations per op: %.3g (%.3g bytes), peak %llu bytes live",
+                    r.allocationsPerOp, r.bytesAllocatedPerOp, static_cast<unsigned long long>(r.peakLiveBytes));
+                std::cout << line << std::endl;
+            }
+
+            if (settings.perfCounters)
+            {
+                std::string report;
+                for (size_t i = 0; i < perfCounters::count; i++)
+                    if (r.countersPerOp[i] >= 0)
+                    {
+                        snprintf(line, sizeof line, "%s%.3g %s", report.empty() ? "" : ", ", r.countersPerOp[i], perfCounters::names[i]);
+                        report += line;
+                        if (i == 1 && r.countersPerOp[0] > 0)
+                        {
+                            snprintf(line, sizeof line, ", IPC %.2f", r.countersPerOp[1] / r.countersPerOp[0]);
+                            report += line;
+                        }
+                    }
+                if (!report.empty())
+                    std::cout << "    Counters per op: " << report << std::endl;
+            }
+            return r;
+        };
+
+        // Aggregate throughput sums every thread's; efficiency compares it with Threads times one thread alone
+        auto runThreaded = [&](const registrar::benchEntity& fn)
+        {
+            double single = 0;
+            std::string curve;
+            for (size_t threads : threadCounts(settings.maxThreads))
+            {
+                std::cout << "Starting to benchmark: " << fn.title << " - " << fn.subTitle << " [threads=" << threads << "]...\t" << std::flush;
+                std::vector<benchRet> perThread = runThreads(fn.func, threads);
+                for (size_t i = 1; i < options.repetitions; i++)
+                {
+                    std::vector<benchRet> more = runThreads(fn.func, threads);
+                    for (size_t k = 0; k < threads; k++)
+                        perThread[k].Merge(more[k]);
+                }
+                double aggregate = 0, slowest = INFINITY, fastest = 0;
+                std::vector<double> medians;
+                benchResult& result = results.emplace_back();
+                result.name = fn.title + " - " + fn.subTitle;
+                result.threads = threads;
+                for (const benchRet& r : perThread)
+                {
+                    result.samples.insert(result.samples.end(), r.samples.begin(), r.samples.end());
+                    double median = benchStats::Compute(r.samples).median;
+                    double throughput = median > 0 ? 1e9 / median : 0;
+                    medians.push_back(median);
+                    aggregate += throughput;
+                    slowest = std::min(slowest, throughput);
+                    fastest = std::max(fastest, throughput);
+                }
+                if (threads == 1)
+                    single = aggregate;
+                double efficiency = single > 0 ? aggregate / (single * threads) : 0;
+                result.stats = benchStats::Compute(result.samples);
+                result.iterationsPerSecond = aggregate;
+                result.itemsPerSecond = perThread[0].itemsPerOp * aggregate;
+                result.bytesPerSecond = perThread[0].bytesPerOp * aggregate;
+                char line[256];
+                int length = snprintf(line, sizeof line, "%.2f ns/op per thread, %.0f iteration/s aggregate, %.0f per thread (%.0f to %.0f), efficiency %.0f%%",
+                    benchStats::medianOf(medians), aggregate, aggregate / threads, slowest, fastest, efficiency * 100);
+                if (result.bytesPerSecond > 0)
+                    length += snprintf(line + length, sizeof line - length, ", %.1f MB/s aggregate", result.bytesPerSecond / 1e6);
+                std::cout << line << std::endl;
+                snprintf(line, sizeof line, "%s%zu: %.0f%%", curve.empty() ? "" : ", ", threads, efficiency * 100);
+                curve += line;
+            }
+            std::cout << "    Scaling efficiency: " << curve << std::endl;
+        };
 
         for (auto& fn : registrar::benchers)
         {
-            std::cout << "Starting to benchmark: " << fn.title << " - " << fn.subTitle << "...\t";
-            benchRet r = fn.func();
-            std::cout << r.counter << " iteration/s" << std::endl;
+            if (!options.filter.empty() && !matchesFilter(options.filter, fn.title + " - " + fn.subTitle))
+                continue;
+            if (fn.threaded)
+            {
+                runThreaded(fn);
+                continue;
+            }
+            if (fn.ranges.empty())
+            {
+                runBench(fn, 0);
+                if (settings.profile)
+                    writeProfile(results.back().Label());
+                continue;
+            }
+            std::vector<std::pair<double, double>> points;
+            for (size_t range : fn.ranges)
+            {
+                benchRet r = runBench(fn, range);
+                if (settings.profile)
+                    writeProfile(results.back().Label());
+                if (!r.samples.empty())
+                    points.push_back({ static_cast<double>(range), benchStats::Compute(r.samples).median });
+            }
+            if (points.size() < 2)
+                continue;
+            complexityFit fit = complexityFit::Fit(points);
+            char line[160];
+            snprintf(line, sizeof line, "    Complexity: %s, %.3g ns per unit (RMS %.1f%%)", fit.name, fit.coefficient, fit.rms * 100);
+            std::cout << line << std::endl;
+        }
+
+        std::cout << "Benchs executed" << std::endl;
+
+        auto write = [&results](const std::string& Path, void (*Writer)(std::ostream&, const std::vector<benchResult>&))
+        {
+            std::ofstream file(Path);
+            Writer(file, results);
+            std::cout << (file ? "Results written to " : "Could not write the results to ") << Path << std::endl;
+        };
+        if (!options.jsonPath.empty())
+            write(options.jsonPath, benchResult::WriteJson);
+        if (!options.csvPath.empty())
+            write(options.csvPath, benchResult::WriteCsv);
+
+        int nbRegressed = 0;
+        if (!options.baselinePath.empty())
+        {
+            std::ifstream file(options.baselinePath);
+            std::stringstream text;
+            text << file.rdbuf();
+            std::optional<std::vector<benchResult>> baseline = benchResult::ReadJson(text.str());
+            if (!file || !baseline)
+            {
+                std::cout << "Could not read the baseline " << options.baselinePath << std::endl;
+                nbRegressed++;
+            }
+            else
+            {
+                std::map<std::string, const benchResult*> previous;
+                for (const benchResult& result : *baseline)
+                    previous[result.Label()] = &result;
+                int nbImproved = 0, nbUnchanged = 0, nbIncomparable = 0;
+                std::cout << "\nComparing with " << options.baselinePath << " (threshold " << options.threshold << "%, alpha " << options.alpha << ")" << std::endl;
+                for (const benchResult& result : results)
+                {
+                    auto found = previous.find(result.Label());
+                    if (found == previous.end())
+                    {
+                        nbIncomparable++;
+                        continue;
+                    }
+                    benchComparison comparison = benchComparison::Compare(*found->second, result, options.threshold, options.alpha);
+                    nbUnchanged += comparison.verdict == benchComparison::unchanged;
+                    nbIncomparable += comparison.verdict == benchComparison::incomparable;
+                    if (comparison.verdict != benchComparison::regressed && comparison.verdict != benchComparison::improved)
+                        continue;
+                    bool regressed = comparison.verdict == benchComparison::regressed;
+                    nbRegressed += regressed;
+                    nbImproved += !regressed;
+                    char line[160];
+                    if (comparison.latency)
+                        snprintf(line, sizeof line, ": p50 %llu ns -> %llu ns, p99 %llu ns -> %llu ns (%+.1f%%)",
+                            static_cast<unsigned long long>(found->second->latency[0]), static_cast<unsigned long long>(result.latency[0]),
+                            static_cast<unsigned long long>(found->second->latency[2]), static_cast<unsigned long long>(result.latency[2]),
+                            comparison.change * 100);
+                    else if (comparison.throughput)
+                    {
+                        auto [before, after] = benchComparison::Throughputs(*found->second, result);
+                        const char* unit = result.itemsPerSecond > 0 && found->second->itemsPerSecond > 0 ? "items/s" : "bytes/s";
+                        snprintf(line, sizeof line, ": %.3g -> %.3g %s (%+.1f%%, p=%.2g)",
+                            before, after, unit, (after / before - 1) * 100, comparison.p);
+                    }
+                    else
+                        snprintf(line, sizeof line, ": %.2f ns -> %.2f ns (%+.1f%%, p=%.2g)",
+                            found->second->stats.median, result.stats.median, comparison.change * 100, comparison.p);
+                    std::cout << (regressed ? "    \033[31mRegressed:\033[0m " : "    \033[36mImproved:\033[0m ") << result.Label() << line << std::endl;
+                }
+                std::cout << "Benchs compared:\t" << results.size() << " (Regressed: " << nbRegressed << ", Improved: " << nbImproved
+                    << ", Unchanged: " << nbUnchanged << ", Not compared: " << nbIncomparable << ')' << std::endl;
+            }
+        }
+
+        std::cout << "\nEvery tasks are finished" << std::endl;
+        return -(nbTestFailed + nbRegressed);
+    }
+}
+
+#if defined(TESTER_COUNT_ALLOCATIONS)
+// Replacement allocation functions, off by default: build with -DTESTER_COUNT_ALLOCATIONS (make COUNT_ALLOCATIONS=1)
+// and, with several translation units, define it in only the one that includes Tester.h.
+namespace
+{
+    inline void* testerAllocate(size_t Size, size_t Alignment) noexcept
+    {
+        if (Size == 0)
+            Size = 1;
+        void* p = Alignment <= alignof(std::max_align_t) ? malloc(Size) : aligned_alloc(Alignment, (Size + Alignment - 1) / Alignment * Alignment);
+        if (p != nullptr) [[likely]]
+        {
+            allocationCounters& tally = allocationTally;
+            tally.allocations++;
+            tally.bytes += Size;
+#if defined(__GLIBC__)
+            tally.live += malloc_usable_size(p);
+            tally.peak = std::max(tally.peak, tally.live);
+#endif
         }
+        return p;
+    }
 
-        std::cout << "Benchs executed\n\nEvery tasks are finished" << std::endl;
-        return -nbTestFailed;
+    inline void testerFree(void* P) noexcept
+    {
+        if (P == nullptr)
+            return;
+        allocationCounters& tally = allocationTally;
+        tally.frees++;
+#if defined(__GLIBC__)
+        size_t usable = malloc_usable_size(P);
+        tally.live = tally.live > usable ? tally.live - usable : 0; // blocks from other threads can overshoot
+#endif
+        free(P);
     }
-}
\ No newline at end of file
+
+    inline void* testerAllocateOrThrow(size_t Size, size_t Alignment)
+    {
+        void* p = testerAllocate(Size, Alignment);
+        if (p == nullptr) [[unlikely]]
+            throw std::bad_alloc();
+        return p;
+    }
+}
+
+void* operator new(size_t Size) { return testerAllocateOrThrow(Size, 0); }
+void* operator new[](size_t Size) { return testerAllocateOrThrow(Size, 0); }
+void* operator new(size_t Size, std::align_val_t Alignment) { return testerAllocateOrThrow(Size, static_cast<size_t>(Alignment)); }
+void* operator new[](size_t Size, std::align_val_t Alignment) { return testerAllocateOrThrow(Size, static_cast<size_t>(Alignment)); }
+void* operator new(size_t Size, const std::nothrow_t&) noexcept { return testerAllocate(Size, 0); }
+void* operator new[](size_t Size, const std::nothrow_t&) noexcept { return testerAllocate(Size, 0); }
+void* operator new(size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return testerAllocate(Size, static_cast<size_t>(Alignment)); }
+void* operator new[](size_t Size, std::align_val_t Alignment, const std::nothrow_t&) noexcept { return testerAllocate(Size, static_cast<size_t>(Alignment)); }
+void operator delete(void* P) noexcept { testerFree(P); }
+void operator delete[](void* P) noexcept { testerFree(P); }
+void operator delete(void* P, size_t) noexcept { testerFree(P); }
+void operator delete[](void* P, size_t) noexcept { testerFree(P); }
+void operator delete(void* P, std::align_val_t) noexcept { testerFree(P); }
+void operator delete[](void* P, std::align_val_t) noexcept { testerFree(P); }
+void operator delete(void* P, size_t, std::align_val_t) noexcept { testerFree(P); }
+void operator delete[](void* P, size_t, std::align_val_t) noexcept { testerFree(P); }
+void operator delete(void* P, const std::nothrow_t&) noexcept { testerFree(P); }
+void operator delete[](void* P, const std::nothrow_t&) noexcept { testerFree(P); }
+void operator delete(void* P, std::align_val_t, const std::nothrow_t&) noexcept { testerFree(P); }
+void operator delete[](void* P, std::align_val_t, const std::nothrow_t&) noexcept { testerFree(P); }
+#endif
@@ -19,6 +19,36 @@ crypto_core_ristretto255_is_valid_point(const unsigned char *p)
     return 1;
 }
 
+#define RISTRETTO255_VALIDATE_BATCH 16U
+
+int
+crypto_core_ristretto255_is_valid_point_batch(const unsigned char *p,
+                                              size_t count, int *results)
+{
+    ge25519_p3 p_p3[RISTRETTO255_VALIDATE_BATCH];
+    int        r[RISTRETTO255_VALIDATE_BATCH];
+    size_t     i;
+    size_t     k;
+    size_t     m;
+    int        ret = 1;
+
+    for (i = 0; i < count; i += m) {
+        m = count - i;
+        if (m > RISTRETTO255_VALIDATE_BATCH) {
+            m = RISTRETTO255_VALIDATE_BATCH;
+        }
+        if (ristretto255_frombytes_batch(p_p3, &p[i * 32], m, r) != 0) {
+            ret = 0;
+        }
+        if (results != NULL) {
+            for (k = 0; k < m; k++) {
+                results[i + k] = r[k] + 1;
+            }
+        }
+    }
+    return ret;
+}
+
 int
 crypto_core_ristretto255_add(unsigned char *r,
                              const unsigned char *p, const unsigned char *q)
@@ -0,0 +1,103 @@
+#! /usr/bin/env python3
+
+# Generates the fixed-base table of ge25519_cmov16_base_wide():
+# base[i][j] = (j+1)*1024^i*B for i in 0..25 and j in 0..15, as
+# (y+x, y-x, 2*d*x*y) in the field element format of fe_51 or fe_25_5.
+#
+#   python3 base_wide.py 51   > fe_51/base_wide.h
+#   python3 base_wide.py 25_5 > fe_25_5/base_wide.h
+
+import sys
+
+ROWS = 26
+COLS = 16
+STEP = 1024
+
+p = 2**255 - 19
+d = -121665 * pow(121666, p - 2, p) % p
+
+
+def inv(x):
+    return pow(x, p - 2, p)
+
+
+def base_point():
+    y = 4 * inv(5) % p
+    xx = (y * y - 1) * inv(d * y * y + 1) % p
+    x = pow(xx, (p + 3) // 8, p)
+    if (x * x - xx) % p != 0:
+        x = x * pow(2, (p - 1) // 4, p) % p
+    if x & 1:
+        x = p - x
+    return (x, y)
+
+
+def add(P, Q):
+    (x1, y1), (x2, y2) = P, Q
+    t = d * x1 * x2 * y1 * y2 % p
+    x3 = (x1 * y2 + y1 * x2) * inv(1 + t) % p
+    y3 = (y1 * y2 + x1 * x2) * inv(1 - t) % p
+    return (x3, y3)
+
+
+def limbs_51(v):
+    return [(v >> (51 * i)) & (2**51 - 1) for i in range(5)]
+
+
+# Same limbs as fe25519_frombytes() in fe_25_5/fe.h
+def limbs_25_5(v):
+    s = v.to_bytes(32, "little")
+
+    def load(off, n):
+        return int.from_bytes(s[off:off + n], "little")
+
+    h = [
+        load(0, 4),
+        load(4, 3) << 6,
+        load(7, 3) << 5,
+        load(10, 3) << 3,
+        load(13, 3) << 2,
+        load(16, 4),
+        load(20, 3) << 7,
+        load(23, 3) << 5,
+        load(26, 3) << 4,
+        (load(29, 3) & 8388607) << 2,
+    ]
+    for i in (9, 1, 3, 5, 7, 0, 2, 4, 6, 8):
+        bits = 26 if i % 2 == 0 else 25
+        carry = (h[i] + (1 << (bits - 1))) >> bits
+        if i == 9:
+            h[0] += carry * 19
+        else:
+            h[i + 1] += carry
+        h[i] -= carry << bits
+    return h
+
+
+def main():
+    if len(sys.argv) != 2 or sys.argv[1] not in ("51", "25_5"):
+        sys.exit("usage: base_wide.py 51|25_5")
+    limbs = limbs_51 if sys.argv[1] == "51" else limbs_25_5
+    out = []
+    row = base_point()
+    for i in range(ROWS):
+        out.append("{ /* %d/%d */" % (i, ROWS - 1))
+        P = row
+        for j in range(COLS):
+            x, y = P
+            fes = ((y + x) % p, (y - x) % p, 2 * d * x * y % p)
+            out.append("  {")
+            for k, v in enumerate(fes):
+                out.append("    { %s }%s" % (", ".join(str(l) for l in limbs(v)),
+                                             "," if k < 2 else ""))
+            out.append("  }%s" % ("," if j < COLS - 1 else ""))
+            if j < COLS - 1:
+                P = add(P, row)
+        out.append("}%s" % ("," if i < ROWS - 1 else ""))
+        for _ in range(STEP.bit_length() - 1):
+            row = add(row, row)
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
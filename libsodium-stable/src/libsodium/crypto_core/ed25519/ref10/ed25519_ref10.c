@@ -8,6 +8,10 @@
 #include "private/ed25519_ref10.h"
 #include "utils.h"
 
+#if defined(HAVE_EMMINTRIN_H) && defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
 static inline uint64_t
 load_3(const unsigned char *in)
 {
@@ -158,6 +162,84 @@ fe25519_pow22523(fe25519 out, const fe25519 z)
     fe25519_mul(out, t0, z);
 }
 
+/*
+ fe25519_pow22523() for 4 independent elements, interleaved so that the
+ squarings of different elements can execute in parallel
+ */
+
+static inline void
+fe25519_sq_4(fe25519 h[4], const fe25519 f[4])
+{
+    int k;
+
+    for (k = 0; k < 4; k++) {
+        fe25519_sq(h[k], f[k]);
+    }
+}
+
+static inline void
+fe25519_mul_4(fe25519 h[4], const fe25519 f[4], const fe25519 g[4])
+{
+    int k;
+
+    for (k = 0; k < 4; k++) {
+        fe25519_mul(h[k], f[k], g[k]);
+    }
+}
+
+static void
+fe25519_pow22523_4(fe25519 out[4], const fe25519 z[4])
+{
+    fe25519 t0[4];
+    fe25519 t1[4];
+    fe25519 t2[4];
+    int     i;
+
+    fe25519_sq_4(t0, z);
+    fe25519_sq_4(t1, t0);
+    fe25519_sq_4(t1, t1);
+    fe25519_mul_4(t1, z, t1);
+    fe25519_mul_4(t0, t0, t1);
+    fe25519_sq_4(t0, t0);
+    fe25519_mul_4(t0, t1, t0);
+    fe25519_sq_4(t1, t0);
+    for (i = 1; i < 5; ++i) {
+        fe25519_sq_4(t1, t1);
+    }
+    fe25519_mul_4(t0, t1, t0);
+    fe25519_sq_4(t1, t0);
+    for (i = 1; i < 10; ++i) {
+        fe25519_sq_4(t1, t1);
+    }
+    fe25519_mul_4(t1, t1, t0);
+    fe25519_sq_4(t2, t1);
+    for (i = 1; i < 20; ++i) {
+        fe25519_sq_4(t2, t2);
+    }
+    fe25519_mul_4(t1, t2, t1);
+    for (i = 1; i < 11; ++i) {
+        fe25519_sq_4(t1, t1);
+    }
+    fe25519_mul_4(t0, t1, t0);
+    fe25519_sq_4(t1, t0);
+    for (i = 1; i < 50; ++i) {
+        fe25519_sq_4(t1, t1);
+    }
+    fe25519_mul_4(t1, t1, t0);
+    fe25519_sq_4(t2, t1);
+    for (i = 1; i < 100; ++i) {
+        fe25519_sq_4(t2, t2);
+    }
+    fe25519_mul_4(t1, t2, t1);
+    for (i = 1; i < 51; ++i) {
+        fe25519_sq_4(t1, t1);
+    }
+    fe25519_mul_4(t0, t1, t0);
+    fe25519_sq_4(t0, t0);
+    fe25519_sq_4(t0, t0);
+    fe25519_mul_4(out, t0, z);
+}
+
 static inline void
 fe25519_cneg(fe25519 h, const fe25519 f, unsigned int b)
 {
@@ -288,17 +370,15 @@ slide_vartime(signed char *r, const unsigned char *a)
     }
 }
 
-int
-ge25519_frombytes(ge25519_p3 *h, const unsigned char *s)
-{
-    fe25519 u;
-    fe25519 v;
-    fe25519 vxx;
-    fe25519 m_root_check, p_root_check;
-    fe25519 negx;
-    fe25519 x_sqrtm1;
-    int     has_m_root, has_p_root;
+/*
+ Decoding is split around the exponentiation, so that the exponentiations
+ of several points can be interleaved by ge25519_frombytes_batch()
+ */
 
+static void
+ge25519_frombytes_start(ge25519_p3 *h, fe25519 u, fe25519 v,
+                        const unsigned char *s)
+{
     fe25519_frombytes(h->Y, s);
     fe25519_1(h->Z);
     fe25519_sq(u, h->Y);
@@ -306,8 +386,19 @@ ge25519_frombytes(ge25519_p3 *h, const unsigned char *s)
     fe25519_sub(u, u, h->Z); /* u = y^2-1 */
     fe25519_add(v, v, h->Z); /* v = dy^2+1 */
 
-    fe25519_mul(h->X, u, v);
-    fe25519_pow22523(h->X, h->X);
+    fe25519_mul(h->X, u, v); /* uv, to be raised to the power of (q-5)/8 */
+}
+
+static int
+ge25519_frombytes_finish(ge25519_p3 *h, const fe25519 u, const fe25519 v,
+                         const unsigned char *s)
+{
+    fe25519 vxx;
+    fe25519 m_root_check, p_root_check;
+    fe25519 negx;
+    fe25519 x_sqrtm1;
+    int     has_m_root, has_p_root;
+
     fe25519_mul(h->X, u, h->X); /* u((uv)^((q-5)/8)) */
 
     fe25519_sq(vxx, h->X);
@@ -326,6 +417,60 @@ ge25519_frombytes(ge25519_p3 *h, const unsigned char *s)
     return (has_m_root | has_p_root) - 1;
 }
 
+int
+ge25519_frombytes(ge25519_p3 *h, const unsigned char *s)
+{
+    fe25519 u;
+    fe25519 v;
+
+    ge25519_frombytes_start(h, u, v, s);
+    fe25519_pow22523(h->X, h->X);
+
+    return ge25519_frombytes_finish(h, u, v, s);
+}
+
+/*
+ h[i] = ge25519_frombytes(s + 32 * i) for i < n, 4 points at a time.
+ If results is not NULL, results[i] is set to the return value for the
+ i-th point. Returns -1 if any point couldn't be decoded.
+ */
+
+int
+ge25519_frombytes_batch(ge25519_p3 *h, const unsigned char *s, size_t n,
+                        int *results)
+{
+    fe25519 u[4];
+    fe25519 v[4];
+    fe25519 x[4];
+    size_t  i;
+    size_t  k;
+    size_t  m;
+    int     ret = 0;
+    int     r;
+
+    for (i = 0; i < n; i += m) {
+        m = n - i < 4U ? n - i : 4U;
+        for (k = 0; k < 4U; k++) {
+            if (k < m) {
+                ge25519_frombytes_start(&h[i + k], u[k], v[k], &s[(i + k) * 32]);
+                fe25519_copy(x[k], h[i + k].X);
+            } else {
+                fe25519_1(x[k]);
+            }
+        }
+        fe25519_pow22523_4(x, x);
+        for (k = 0; k < m; k++) {
+            fe25519_copy(h[i + k].X, x[k]);
+            r = ge25519_frombytes_finish(&h[i + k], u[k], v[k], &s[(i + k) * 32]);
+            if (results != NULL) {
+                results[i + k] = r;
+            }
+            ret |= r;
+        }
+    }
+    return ret;
+}
+
 int
 ge25519_frombytes_negate_vartime(ge25519_p3 *h, const unsigned char *s)
 {
@@ -540,6 +685,47 @@ ge25519_p3_tobytes(unsigned char *s, const ge25519_p3 *h)
     s[31] ^= fe25519_isnegative(x) << 7;
 }
 
+/*
+ s[32 * i] = ge25519_p3_tobytes(h[i]) for i < n, with one inversion per
+ GE25519_TOBYTES_BATCH points (Montgomery's trick)
+ */
+
+#define GE25519_TOBYTES_BATCH 64U
+
+void
+ge25519_p3_tobytes_batch(unsigned char *s, const ge25519_p3 *h, size_t n)
+{
+    fe25519 acc[GE25519_TOBYTES_BATCH];
+    fe25519 recip;
+    fe25519 zinv;
+    fe25519 x;
+    fe25519 y;
+    size_t  i;
+    size_t  k;
+    size_t  m;
+
+    for (i = 0; i < n; i += m) {
+        m = n - i < GE25519_TOBYTES_BATCH ? n - i : GE25519_TOBYTES_BATCH;
+        fe25519_copy(acc[0], h[i].Z);
+        for (k = 1; k < m; k++) {
+            fe25519_mul(acc[k], acc[k - 1], h[i + k].Z); /* Z_0*...*Z_k */
+        }
+        fe25519_invert(recip, acc[m - 1]);
+        for (k = m - 1; k > 0; k--) {
+            fe25519_mul(zinv, recip, acc[k - 1]);        /* 1/Z_k */
+            fe25519_mul(recip, recip, h[i + k].Z);       /* 1/(Z_0*...*Z_k-1) */
+            fe25519_mul(x, h[i + k].X, zinv);
+            fe25519_mul(y, h[i + k].Y, zinv);
+            fe25519_tobytes(&s[(i + k) * 32], y);
+            s[(i + k) * 32 + 31] ^= fe25519_isnegative(x) << 7;
+        }
+        fe25519_mul(x, h[i].X, recip);
+        fe25519_mul(y, h[i].Y, recip);
+        fe25519_tobytes(&s[i * 32], y);
+        s[i * 32 + 31] ^= fe25519_isnegative(x) << 7;
+    }
+}
+
 /*
  r = 2 * p
  */
@@ -602,6 +788,85 @@ ge25519_cmov_cached(ge25519_cached *t, const ge25519_cached *u, unsigned char b)
     fe25519_cmov(t->T2d, u->T2d, b);
 }
 
+#if defined(HAVE_EMMINTRIN_H) && defined(__SSE2__)
+
+/*
+ Same as ge25519_cmov8_base() below for 5-bit digits, with 16 multiples
+ per position (26*16 entries, 49920 bytes instead of 30720).
+ Every entry is read, 16 bytes at a time; a mask computed from the digit
+ decides which one is kept.
+ */
+
+# define LOADU(p, i) _mm_loadu_si128((const __m128i *) (const void *) ((p) + 16 * (i)))
+# define STOREU(p, i, v) _mm_storeu_si128((__m128i *) (void *) ((p) + 16 * (i)), (v))
+# define SELECT(acc, m, v) _mm_or_si128((acc), _mm_and_si128((m), (v)))
+
+static void
+ge25519_cmov16_base_wide(ge25519_precomp *t, const int pos, const signed char b)
+{
+    /* base[i][j] = (j+1)*1024^i*B, generated by base_wide.py */
+    static const ge25519_precomp base[26][16] = {
+# ifdef HAVE_TI_MODE
+#  include "fe_51/base_wide.h"
+# else
+#  include "fe_25_5/base_wide.h"
+# endif
+    };
+    ge25519_precomp     minust;
+    const unsigned char bnegative = negative(b);
+    const unsigned char babs      = b - (((-bnegative) & b) * ((signed char) 1 << 1));
+    const __m128i       vbabs     = _mm_set1_epi32((int) babs);
+    const unsigned char *u;
+    unsigned char       *o;
+    __m128i             m;
+    __m128i             t0, t1, t2, t3, t4, t5, t6, t7;
+    int                 j;
+
+    COMPILER_ASSERT(sizeof(ge25519_precomp) == 120U);
+    ge25519_precomp_0(t);
+    u  = (const unsigned char *) (const void *) t;
+    m  = _mm_cmpeq_epi32(vbabs, _mm_setzero_si128());
+    t0 = _mm_and_si128(m, LOADU(u, 0));
+    t1 = _mm_and_si128(m, LOADU(u, 1));
+    t2 = _mm_and_si128(m, LOADU(u, 2));
+    t3 = _mm_and_si128(m, LOADU(u, 3));
+    t4 = _mm_and_si128(m, LOADU(u, 4));
+    t5 = _mm_and_si128(m, LOADU(u, 5));
+    t6 = _mm_and_si128(m, LOADU(u, 6));
+    t7 = _mm_and_si128(m, _mm_loadl_epi64((const __m128i *) (const void *) (u + 112)));
+    for (j = 0; j < 16; j++) {
+        u  = (const unsigned char *) (const void *) &base[pos][j];
+        m  = _mm_cmpeq_epi32(vbabs, _mm_set1_epi32(j + 1));
+        t0 = SELECT(t0, m, LOADU(u, 0));
+        t1 = SELECT(t1, m, LOADU(u, 1));
+        t2 = SELECT(t2, m, LOADU(u, 2));
+        t3 = SELECT(t3, m, LOADU(u, 3));
+        t4 = SELECT(t4, m, LOADU(u, 4));
+        t5 = SELECT(t5, m, LOADU(u, 5));
+        t6 = SELECT(t6, m, LOADU(u, 6));
+        t7 = SELECT(t7, m, _mm_loadl_epi64((const __m128i *) (const void *) (u + 112)));
+    }
+    o = (unsigned char *) (void *) t;
+    STOREU(o, 0, t0);
+    STOREU(o, 1, t1);
+    STOREU(o, 2, t2);
+    STOREU(o, 3, t3);
+    STOREU(o, 4, t4);
+    STOREU(o, 5, t5);
+    STOREU(o, 6, t6);
+    _mm_storel_epi64((__m128i *) (void *) (o + 112), t7);
+    fe25519_copy(minust.yplusx, t->yminusx);
+    fe25519_copy(minust.yminusx, t->yplusx);
+    fe25519_neg(minust.xy2d, t->xy2d);
+    ge25519_cmov(t, &minust, bnegative);
+}
+
+# undef LOADU
+# undef STOREU
+# undef SELECT
+
+#else
+
 static void
 ge25519_cmov8(ge25519_precomp *t, const ge25519_precomp precomp[8], const signed char b)
 {
@@ -637,6 +902,8 @@ ge25519_cmov8_base(ge25519_precomp *t, const int pos, const signed char b)
     ge25519_cmov8(t, base[pos], b);
 }
 
+#endif
+
 static void
 ge25519_cmov8_cached(ge25519_cached *t, const ge25519_cached cached[8], const signed char b)
 {
@@ -696,18 +963,45 @@ ge25519_tobytes(unsigned char *s, const ge25519_p2 *h)
     s[31] ^= fe25519_isnegative(x) << 7;
 }
 
+/*
+ Ai = A, 3A, 5A, 7A, 9A, 11A, 13A, 15A
+ */
+
+void
+ge25519_odd_multiples(ge25519_cached Ai[8], const ge25519_p3 *A)
+{
+    ge25519_p1p1 t;
+    ge25519_p3   u;
+    ge25519_p3   A2;
+    int          i;
+
+    ge25519_p3_to_cached(&Ai[0], A);
+
+    ge25519_p3_dbl(&t, A);
+    ge25519_p1p1_to_p3(&A2, &t);
+
+    for (i = 1; i < 8; i++) {
+        ge25519_add(&t, &A2, &Ai[i - 1]);
+        ge25519_p1p1_to_p3(&u, &t);
+        ge25519_p3_to_cached(&Ai[i], &u);
+    }
+}
+
 /*
  r = a * A + b * B
  where a = a[0]+256*a[1]+...+256^31 a[31].
  and b = b[0]+256*b[1]+...+256^31 b[31].
+ Ai are the odd multiples of A, from ge25519_odd_multiples().
  B is the Ed25519 base point (x,4/5) with x positive.
 
  Only used for signatures verification.
  */
 
 void
-ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
-                                  const ge25519_p3 *A, const unsigned char *b)
+ge25519_double_scalarmult_vartime_precomp(ge25519_p2 *r,
+                                          const unsigned char *a,
+                                          const ge25519_cached Ai[8],
+                                          const unsigned char *b)
 {
     static const ge25519_precomp Bi[8] = {
 #ifdef HAVE_TI_MODE
@@ -716,50 +1010,15 @@ ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
 # include "fe_25_5/base2.h"
 #endif
     };
-    signed char    aslide[256];
-    signed char    bslide[256];
-    ge25519_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
-    ge25519_p1p1   t;
-    ge25519_p3     u;
-    ge25519_p3     A2;
-    int            i;
+    signed char  aslide[256];
+    signed char  bslide[256];
+    ge25519_p1p1 t;
+    ge25519_p3   u;
+    int          i;
 
     slide_vartime(aslide, a);
     slide_vartime(bslide, b);
 
-    ge25519_p3_to_cached(&Ai[0], A);
-
-    ge25519_p3_dbl(&t, A);
-    ge25519_p1p1_to_p3(&A2, &t);
-
-    ge25519_add(&t, &A2, &Ai[0]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[1], &u);
-
-    ge25519_add(&t, &A2, &Ai[1]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[2], &u);
-
-    ge25519_add(&t, &A2, &Ai[2]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[3], &u);
-
-    ge25519_add(&t, &A2, &Ai[3]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[4], &u);
-
-    ge25519_add(&t, &A2, &Ai[4]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[5], &u);
-
-    ge25519_add(&t, &A2, &Ai[5]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[6], &u);
-
-    ge25519_add(&t, &A2, &Ai[6]);
-    ge25519_p1p1_to_p3(&u, &t);
-    ge25519_p3_to_cached(&Ai[7], &u);
-
     ge25519_p2_0(r);
 
     for (i = 255; i >= 0; --i) {
@@ -792,27 +1051,297 @@ ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
 }
 
 /*
- h = a * p
- where a = a[0]+256*a[1]+...+256^31 a[31]
-
- Preconditions:
- a[31] <= 127
-
- p is public
+ r = a * A + b * B
+ where a = a[0]+256*a[1]+...+256^31 a[31].
+ and b = b[0]+256*b[1]+...+256^31 b[31].
+ B is the Ed25519 base point (x,4/5) with x positive.
+
+ Only used for signatures verification.
+ */
+
+void
+ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
+                                  const ge25519_p3 *A, const unsigned char *b)
+{
+    ge25519_cached Ai[8]; /* A,3A,5A,7A,9A,11A,13A,15A */
+
+    ge25519_odd_multiples(Ai, A);
+    ge25519_double_scalarmult_vartime_precomp(r, a, Ai, b);
+}
+
+/*
+ Pippenger's bucket method: window width for n points, with radix 2^w
+ signed digits and 2^(w-1) buckets per window
+ */
+
+#define GE25519_MSM_MAX_WINDOW 11U
+
+static unsigned int
+ge25519_msm_window(size_t n)
+{
+    size_t       cost;
+    size_t       best_cost = SIZE_MAX;
+    unsigned int best_w    = 2U;
+    unsigned int w;
+
+    for (w = 2U; w <= GE25519_MSM_MAX_WINDOW; w++) {
+        if (n > (SIZE_MAX >> (w + 1U)) / ((256U + w) / w)) {
+            break;
+        }
+        cost = ((256U + w) / w) * (n + ((size_t) 1U << w));
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_w    = w;
+        }
+    }
+    return best_w;
+}
+
+static unsigned int
+sc25519_window(const unsigned char a[32], size_t pos, unsigned int w)
+{
+    size_t       i = pos >> 3;
+    unsigned int v = 0U;
+
+    if (i < 32U) {
+        v = a[i];
+    }
+    if (i + 1U < 32U) {
+        v |= (unsigned int) a[i + 1U] << 8;
+    }
+    if (i + 2U < 32U) {
+        v |= (unsigned int) a[i + 2U] << 16;
+    }
+    return (v >> (pos & 7U)) & ((1U << w) - 1U);
+}
+
+/*
+ Straus' method: sliding windows of every scalar, sharing the doublings.
+ Faster than buckets for a few points.
+
+ Preconditions:
+ a[32 * i + 31] <= 127
+ */
+
+#define GE25519_STRAUS_MAX_POINTS 64U
+
+static int
+ge25519_straus_vartime(ge25519_p3 *h, const unsigned char *a,
+                       const ge25519_p3 *A, size_t n)
+{
+    ge25519_cached (*Ai)[8];
+    signed char    (*slides)[256];
+    ge25519_p1p1     t;
+    ge25519_p2       s;
+    size_t           i;
+    int              top = -1;
+    int              j;
+    int              d;
+
+    Ai     = (ge25519_cached (*)[8]) malloc(n * sizeof *Ai);
+    slides = (signed char (*)[256]) malloc(n * sizeof *slides);
+    if (Ai == NULL || slides == NULL) {
+        /* LCOV_EXCL_START */
+        free(Ai);
+        free(slides);
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+    for (i = 0; i < n; i++) {
+        ge25519_odd_multiples(Ai[i], &A[i]);
+        slide_vartime(slides[i], &a[i * 32]);
+        for (j = 255; j > top; j--) {
+            if (slides[i][j] != 0) {
+                top = j;
+                break;
+            }
+        }
+    }
+    for (j = top; j >= 0; j--) {
+        if (j != top) {
+            ge25519_p3_to_p2(&s, h);
+            ge25519_p2_dbl(&t, &s);
+            ge25519_p1p1_to_p3(h, &t);
+        }
+        for (i = 0; i < n; i++) {
+            d = slides[i][j];
+            if (d > 0) {
+                ge25519_add(&t, h, &Ai[i][d / 2]);
+                ge25519_p1p1_to_p3(h, &t);
+            } else if (d < 0) {
+                ge25519_sub(&t, h, &Ai[i][(-d) / 2]);
+                ge25519_p1p1_to_p3(h, &t);
+            }
+        }
+    }
+    free(Ai);
+    free(slides);
+
+    return 0;
+}
+
+/*
+ h = a[0] * A[0] + a[1] * A[1] + ... + a[n-1] * A[n-1]
+ where each scalar a[i] is 32 bytes, little endian
+
+ Variable time: scalars and points must be public.
+ Returns -1 if the scratch space could not be allocated.
+ */
+
+int
+ge25519_multi_scalarmult_vartime(ge25519_p3 *h, const unsigned char *a,
+                                 const ge25519_p3 *A, size_t n)
+{
+    ge25519_cached *Ai;
+    ge25519_p3     *buckets;
+    int16_t        *digits;
+    unsigned char  *used;
+    ge25519_cached  c;
+    ge25519_p1p1    t;
+    ge25519_p2      s;
+    ge25519_p3      running;
+    ge25519_p3      sum;
+    size_t          i;
+    size_t          nbuckets;
+    size_t          windows;
+    size_t          j;
+    size_t          b;
+    unsigned int    w;
+    unsigned int    k;
+    unsigned int    v;
+    unsigned int    carry;
+    int             have_running;
+    int             have_sum;
+    int             d;
+
+    ge25519_p3_0(h);
+    if (n == 0U) {
+        return 0;
+    }
+    if (n <= GE25519_STRAUS_MAX_POINTS) {
+        for (i = 0; i < n; i++) {
+            if (a[i * 32 + 31] > 127) {
+                break;
+            }
+        }
+        if (i == n) {
+            return ge25519_straus_vartime(h, a, A, n);
+        }
+    }
+    w        = ge25519_msm_window(n);
+    windows  = (256U + w) / w; /* room for the last carry */
+    nbuckets = (size_t) 1U << (w - 1U);
+    if (n > SIZE_MAX / windows / sizeof *digits ||
+        n > SIZE_MAX / sizeof *Ai) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    Ai      = (ge25519_cached *) malloc(n * sizeof *Ai);
+    digits  = (int16_t *) malloc(n * windows * sizeof *digits);
+    buckets = (ge25519_p3 *) malloc(nbuckets * sizeof *buckets);
+    used    = (unsigned char *) malloc(nbuckets);
+    if (Ai == NULL || digits == NULL || buckets == NULL || used == NULL) {
+        /* LCOV_EXCL_START */
+        free(Ai);
+        free(digits);
+        free(buckets);
+        free(used);
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+    for (i = 0; i < n; i++) {
+        ge25519_p3_to_cached(&Ai[i], &A[i]);
+        carry = 0U;
+        for (j = 0; j < windows; j++) {
+            v     = sc25519_window(&a[i * 32], j * w, w) + carry;
+            carry = (v >> (w - 1U)) & 1U;
+            carry |= v >> w;
+            digits[j * n + i] = (int16_t) ((int) v - (int) (carry << w));
+        }
+    }
+    /* each digit is between -2^(w-1) and 2^(w-1) */
+
+    j = windows;
+    while (j-- > 0U) {
+        if (j != windows - 1U) {
+            ge25519_p3_to_p2(&s, h);
+            for (k = 1U; k < w; k++) {
+                ge25519_p2_dbl(&t, &s);
+                ge25519_p1p1_to_p2(&s, &t);
+            }
+            ge25519_p2_dbl(&t, &s);
+            ge25519_p1p1_to_p3(h, &t);
+        }
+        memset(used, 0, nbuckets);
+        for (i = 0; i < n; i++) {
+            d = digits[j * n + i];
+            if (d == 0) {
+                continue;
+            }
+            b = (size_t) (d > 0 ? d : -d) - 1U;
+            if (used[b] == 0U) {
+                buckets[b] = A[i];
+                if (d < 0) {
+                    fe25519_neg(buckets[b].X, buckets[b].X);
+                    fe25519_neg(buckets[b].T, buckets[b].T);
+                }
+                used[b] = 1U;
+            } else {
+                if (d > 0) {
+                    ge25519_add(&t, &buckets[b], &Ai[i]);
+                } else {
+                    ge25519_sub(&t, &buckets[b], &Ai[i]);
+                }
+                ge25519_p1p1_to_p3(&buckets[b], &t);
+            }
+        }
+        /* sum of (b + 1) * buckets[b] = running sums of the buckets, from the top */
+        have_running = have_sum = 0;
+        b = nbuckets;
+        while (b-- > 0U) {
+            if (used[b] != 0U) {
+                if (have_running) {
+                    ge25519_p3_to_cached(&c, &buckets[b]);
+                    ge25519_add(&t, &running, &c);
+                    ge25519_p1p1_to_p3(&running, &t);
+                } else {
+                    running      = buckets[b];
+                    have_running = 1;
+                }
+            }
+            if (have_running) {
+                if (have_sum) {
+                    ge25519_p3_to_cached(&c, &running);
+                    ge25519_add(&t, &sum, &c);
+                    ge25519_p1p1_to_p3(&sum, &t);
+                } else {
+                    sum      = running;
+                    have_sum = 1;
+                }
+            }
+        }
+        if (have_sum) {
+            ge25519_p3_to_cached(&c, &sum);
+            ge25519_add(&t, h, &c);
+            ge25519_p1p1_to_p3(h, &t);
+        }
+    }
+    free(Ai);
+    free(digits);
+    free(buckets);
+    free(used);
+
+    return 0;
+}
+
+/*
+ pi = p, 2p, 3p, 4p, 5p, 6p, 7p, 8p
  */
 
-void
-ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a, const ge25519_p3 *p)
+static void
+ge25519_multiples(ge25519_cached pi[8], const ge25519_p3 *p)
 {
-    signed char     e[64];
-    signed char     carry;
-    ge25519_p1p1    r;
-    ge25519_p2      s;
-    ge25519_p1p1    t2, t3, t4, t5, t6, t7, t8;
-    ge25519_p3      p2, p3, p4, p5, p6, p7, p8;
-    ge25519_cached  pi[8];
-    ge25519_cached  t;
-    int             i;
+    ge25519_p1p1 t2, t3, t4, t5, t6, t7, t8;
+    ge25519_p3   p2, p3, p4, p5, p6, p7, p8;
 
     ge25519_p3_to_cached(&pi[1 - 1], p);   /* p */
 
@@ -843,6 +1372,20 @@ ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a, const ge25519_p3 *p)
     ge25519_p3_dbl(&t8, &p4);
     ge25519_p1p1_to_p3(&p8, &t8);
     ge25519_p3_to_cached(&pi[8 - 1], &p8); /* 8p = 2*4p */
+}
+
+/*
+ e = a as 64 signed radix-16 digits, each between -8 and 8
+
+ Preconditions:
+ a[31] <= 127
+ */
+
+static void
+sc25519_radix16(signed char e[64], const unsigned char *a)
+{
+    signed char carry;
+    int         i;
 
     for (i = 0; i < 32; ++i) {
         e[2 * i + 0] = (a[i] >> 0) & 15;
@@ -860,6 +1403,30 @@ ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a, const ge25519_p3 *p)
     }
     e[63] += carry;
     /* each e[i] is between -8 and 8 */
+}
+
+/*
+ h = a * p
+ where a = a[0]+256*a[1]+...+256^31 a[31]
+
+ Preconditions:
+ a[31] <= 127
+
+ p is public
+ */
+
+void
+ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a, const ge25519_p3 *p)
+{
+    signed char     e[64];
+    ge25519_p1p1    r;
+    ge25519_p2      s;
+    ge25519_cached  pi[8];
+    ge25519_cached  t;
+    int             i;
+
+    ge25519_multiples(pi, p);
+    sc25519_radix16(e, a);
 
     ge25519_p3_0(h);
 
@@ -884,6 +1451,75 @@ ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a, const ge25519_p3 *p)
     ge25519_p1p1_to_p3(h, &r);
 }
 
+/*
+ h = a[0] * A[0] + a[1] * A[1] + ... + a[n-1] * A[n-1]
+ where each scalar a[i] is 32 bytes, little endian
+
+ Preconditions:
+ a[32 * i + 31] <= 127
+
+ Same as ge25519_scalarmult() for every point, sharing the doublings.
+ The scalars are secret, the points and n are public.
+ Returns -1 if the scratch space could not be allocated.
+ */
+
+int
+ge25519_multi_scalarmult(ge25519_p3 *h, const unsigned char *a,
+                         const ge25519_p3 *A, size_t n)
+{
+    ge25519_cached (*pi)[8];
+    signed char    (*e)[64];
+    ge25519_p1p1     r;
+    ge25519_p2       s;
+    ge25519_cached   t;
+    size_t           i;
+    int              j;
+
+    ge25519_p3_0(h);
+    if (n == 0U) {
+        return 0;
+    }
+    if (n > SIZE_MAX / sizeof *pi) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    pi = (ge25519_cached (*)[8]) malloc(n * sizeof *pi);
+    e  = (signed char (*)[64]) malloc(n * sizeof *e);
+    if (pi == NULL || e == NULL) {
+        /* LCOV_EXCL_START */
+        free(pi);
+        free(e);
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+    for (i = 0; i < n; i++) {
+        ge25519_multiples(pi[i], &A[i]);
+        sc25519_radix16(e[i], &a[i * 32]);
+    }
+    for (j = 63; j >= 0; j--) {
+        if (j != 63) {
+            ge25519_p3_to_p2(&s, h);
+            ge25519_p2_dbl(&r, &s);
+            ge25519_p1p1_to_p2(&s, &r);
+            ge25519_p2_dbl(&r, &s);
+            ge25519_p1p1_to_p2(&s, &r);
+            ge25519_p2_dbl(&r, &s);
+            ge25519_p1p1_to_p2(&s, &r);
+            ge25519_p2_dbl(&r, &s);
+            ge25519_p1p1_to_p3(h, &r);  /* *16 */
+        }
+        for (i = 0; i < n; i++) {
+            ge25519_cmov8_cached(&t, pi[i], e[i][j]);
+            ge25519_add(&r, h, &t);
+            ge25519_p1p1_to_p3(h, &r);
+        }
+    }
+    sodium_memzero(e, n * sizeof *e);
+    free(pi);
+    free(e);
+
+    return 0;
+}
+
 /*
  h = a * B (with precomputation)
  where a = a[0]+256*a[1]+...+256^31 a[31]
@@ -894,6 +1530,62 @@ ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a, const ge25519_p3 *p)
  a[31] <= 127
  */
 
+#if defined(HAVE_EMMINTRIN_H) && defined(__SSE2__)
+
+void
+ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
+{
+    signed char     e[52];
+    signed char     carry;
+    ge25519_p1p1    r;
+    ge25519_p2      s;
+    ge25519_precomp t;
+    int             i;
+
+    for (i = 0; i < 52; ++i) {
+        e[i] = (signed char) sc25519_window(a, (size_t) i * 5U, 5U);
+    }
+    /* each e[i] is between 0 and 31 */
+    /* e[51] is 0 */
+
+    carry = 0;
+    for (i = 0; i < 51; ++i) {
+        e[i] += carry;
+        carry = e[i] + 16;
+        carry >>= 5;
+        e[i] -= carry * ((signed char) 1 << 5);
+    }
+    e[51] += carry;
+    /* each e[i] is between -16 and 16 */
+
+    ge25519_p3_0(h);
+
+    for (i = 1; i < 52; i += 2) {
+        ge25519_cmov16_base_wide(&t, i / 2, e[i]);
+        ge25519_madd(&r, h, &t);
+        ge25519_p1p1_to_p3(h, &r);
+    }
+
+    ge25519_p3_dbl(&r, h);
+    ge25519_p1p1_to_p2(&s, &r);
+    ge25519_p2_dbl(&r, &s);
+    ge25519_p1p1_to_p2(&s, &r);
+    ge25519_p2_dbl(&r, &s);
+    ge25519_p1p1_to_p2(&s, &r);
+    ge25519_p2_dbl(&r, &s);
+    ge25519_p1p1_to_p2(&s, &r);
+    ge25519_p2_dbl(&r, &s);
+    ge25519_p1p1_to_p3(h, &r);
+
+    for (i = 0; i < 52; i += 2) {
+        ge25519_cmov16_base_wide(&t, i / 2, e[i]);
+        ge25519_madd(&r, h, &t);
+        ge25519_p1p1_to_p3(h, &r);
+    }
+}
+
+#else
+
 void
 ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
 {
@@ -945,6 +1637,8 @@ ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a)
     }
 }
 
+#endif
+
 /* multiply by the order of the main subgroup l = 2^252+27742317777372353535851937790883648493 */
 static void
 ge25519_mul_l(ge25519_p3 *r, const ge25519_p3 *A)
@@ -2618,22 +3312,31 @@ ge25519_from_hash(unsigned char s[32], const unsigned char h[64])
 
 /* Ristretto group */
 
-static int
-ristretto255_sqrt_ratio_m1(fe25519 x, const fe25519 u, const fe25519 v)
-{
-    fe25519 v3;
-    fe25519 vxx;
-    fe25519 m_root_check, p_root_check, f_root_check;
-    fe25519 x_sqrtm1;
-    int     has_m_root, has_p_root, has_f_root;
+/*
+ Like decoding, ristretto255_sqrt_ratio_m1() is split around the
+ exponentiation, so that it can be computed for 4 elements at once
+ */
 
+static void
+ristretto255_sqrt_ratio_m1_start(fe25519 x, fe25519 v3,
+                                 const fe25519 u, const fe25519 v)
+{
     fe25519_sq(v3, v);
     fe25519_mul(v3, v3, v); /* v3 = v^3 */
     fe25519_sq(x, v3);
     fe25519_mul(x, x, v);
     fe25519_mul(x, x, u); /* x = uv^7 */
+}
+
+static int
+ristretto255_sqrt_ratio_m1_finish(fe25519 x, const fe25519 v3,
+                                  const fe25519 u, const fe25519 v)
+{
+    fe25519 vxx;
+    fe25519 m_root_check, p_root_check, f_root_check;
+    fe25519 x_sqrtm1;
+    int     has_m_root, has_p_root, has_f_root;
 
-    fe25519_pow22523(x, x); /* x = (uv^7)^((q-5)/8) */
     fe25519_mul(x, x, v3);
     fe25519_mul(x, x, u); /* x = uv^3(uv^7)^((q-5)/8) */
 
@@ -2654,6 +3357,33 @@ ristretto255_sqrt_ratio_m1(fe25519 x, const fe25519 u, const fe25519 v)
     return has_m_root | has_p_root;
 }
 
+static int
+ristretto255_sqrt_ratio_m1(fe25519 x, const fe25519 u, const fe25519 v)
+{
+    fe25519 v3;
+
+    ristretto255_sqrt_ratio_m1_start(x, v3, u, v);
+    fe25519_pow22523(x, x); /* x = (uv^7)^((q-5)/8) */
+
+    return ristretto255_sqrt_ratio_m1_finish(x, v3, u, v);
+}
+
+static void
+ristretto255_sqrt_ratio_m1_4(fe25519 x[4], int was_square[4],
+                             const fe25519 u[4], const fe25519 v[4])
+{
+    fe25519 v3[4];
+    int     k;
+
+    for (k = 0; k < 4; k++) {
+        ristretto255_sqrt_ratio_m1_start(x[k], v3[k], u[k], v[k]);
+    }
+    fe25519_pow22523_4(x, x);
+    for (k = 0; k < 4; k++) {
+        was_square[k] = ristretto255_sqrt_ratio_m1_finish(x[k], v3[k], u[k], v[k]);
+    }
+}
+
 static int
 ristretto255_is_canonical(const unsigned char *s)
 {
@@ -2673,22 +3403,13 @@ ristretto255_is_canonical(const unsigned char *s)
     return 1 - (((c & d) | e | s[0]) & 1);
 }
 
-int
-ristretto255_frombytes(ge25519_p3 *h, const unsigned char *s)
+static void
+ristretto255_frombytes_start(fe25519 s_, fe25519 u1, fe25519 u2, fe25519 v,
+                             fe25519 v_u2u2, const unsigned char *s)
 {
-    fe25519 inv_sqrt;
-    fe25519 one;
-    fe25519 s_;
     fe25519 ss;
-    fe25519 u1, u2;
     fe25519 u1u1, u2u2;
-    fe25519 v;
-    fe25519 v_u2u2;
-    int     was_square;
 
-    if (ristretto255_is_canonical(s) == 0) {
-        return -1;
-    }
     fe25519_frombytes(s_, s);
     fe25519_sq(ss, s_);                /* ss = s^2 */
 
@@ -2705,9 +3426,14 @@ ristretto255_frombytes(ge25519_p3 *h, const unsigned char *s)
     fe25519_sub(v, v, u2u2);           /* v = -(d*u1^2)-u2^2 */
 
     fe25519_mul(v_u2u2, v, u2u2);      /* v_u2u2 = v*u2^2 */
+}
 
-    fe25519_1(one);
-    was_square = ristretto255_sqrt_ratio_m1(inv_sqrt, one, v_u2u2);
+static int
+ristretto255_frombytes_finish(ge25519_p3 *h, const fe25519 inv_sqrt,
+                              int was_square, const fe25519 s_,
+                              const fe25519 u1, const fe25519 u2,
+                              const fe25519 v)
+{
     fe25519_mul(h->X, inv_sqrt, u2);
     fe25519_mul(h->Y, inv_sqrt, h->X);
     fe25519_mul(h->Y, h->Y, v);
@@ -2723,24 +3449,85 @@ ristretto255_frombytes(ge25519_p3 *h, const unsigned char *s)
               fe25519_isnegative(h->T) | fe25519_iszero(h->Y));
 }
 
-void
-ristretto255_p3_tobytes(unsigned char *s, const ge25519_p3 *h)
+int
+ristretto255_frombytes(ge25519_p3 *h, const unsigned char *s)
 {
-    fe25519 den1, den2;
-    fe25519 den_inv;
-    fe25519 eden;
     fe25519 inv_sqrt;
-    fe25519 ix, iy;
     fe25519 one;
     fe25519 s_;
-    fe25519 t_z_inv;
     fe25519 u1, u2;
-    fe25519 u1_u2u2;
-    fe25519 x_, y_;
-    fe25519 x_z_inv;
-    fe25519 z_inv;
+    fe25519 v;
+    fe25519 v_u2u2;
+    int     was_square;
+
+    if (ristretto255_is_canonical(s) == 0) {
+        return -1;
+    }
+    ristretto255_frombytes_start(s_, u1, u2, v, v_u2u2, s);
+
+    fe25519_1(one);
+    was_square = ristretto255_sqrt_ratio_m1(inv_sqrt, one, v_u2u2);
+
+    return ristretto255_frombytes_finish(h, inv_sqrt, was_square,
+                                         s_, u1, u2, v);
+}
+
+/*
+ h[i] = ristretto255_frombytes(s + 32 * i) for i < n, 4 points at a time.
+ If results is not NULL, results[i] is set to the return value for the
+ i-th point. Returns -1 if any point couldn't be decoded.
+ */
+
+int
+ristretto255_frombytes_batch(ge25519_p3 *h, const unsigned char *s, size_t n,
+                             int *results)
+{
+    fe25519 inv_sqrt[4];
+    fe25519 one[4];
+    fe25519 s_[4];
+    fe25519 u1[4], u2[4];
+    fe25519 v[4];
+    fe25519 v_u2u2[4];
+    int     was_square[4];
+    size_t  i;
+    size_t  k;
+    size_t  m;
+    int     ret = 0;
+    int     r;
+
+    for (k = 0; k < 4U; k++) {
+        fe25519_1(one[k]);
+    }
+    for (i = 0; i < n; i += m) {
+        m = n - i < 4U ? n - i : 4U;
+        for (k = 0; k < 4U; k++) {
+            if (k < m) {
+                ristretto255_frombytes_start(s_[k], u1[k], u2[k], v[k],
+                                             v_u2u2[k], &s[(i + k) * 32]);
+            } else {
+                fe25519_1(v_u2u2[k]);
+            }
+        }
+        ristretto255_sqrt_ratio_m1_4(inv_sqrt, was_square, one, v_u2u2);
+        for (k = 0; k < m; k++) {
+            r = ristretto255_frombytes_finish(&h[i + k], inv_sqrt[k],
+                                              was_square[k], s_[k],
+                                              u1[k], u2[k], v[k]);
+            r |= ristretto255_is_canonical(&s[(i + k) * 32]) - 1;
+            if (results != NULL) {
+                results[i + k] = r;
+            }
+            ret |= r;
+        }
+    }
+    return ret;
+}
+
+static void
+ristretto255_p3_tobytes_start(fe25519 u1, fe25519 u2, fe25519 u1_u2u2,
+                              const ge25519_p3 *h)
+{
     fe25519 zmy;
-    int     rotate;
 
     fe25519_add(u1, h->Z, h->Y);       /* u1 = Z+Y */
     fe25519_sub(zmy, h->Z, h->Y);      /* zmy = Z-Y */
@@ -2749,9 +3536,24 @@ ristretto255_p3_tobytes(unsigned char *s, const ge25519_p3 *h)
 
     fe25519_sq(u1_u2u2, u2);           /* u1_u2u2 = u2^2 */
     fe25519_mul(u1_u2u2, u1, u1_u2u2); /* u1_u2u2 = u1*u2^2 */
+}
+
+static void
+ristretto255_p3_tobytes_finish(unsigned char *s, const ge25519_p3 *h,
+                               const fe25519 inv_sqrt,
+                               const fe25519 u1, const fe25519 u2)
+{
+    fe25519 den1, den2;
+    fe25519 den_inv;
+    fe25519 eden;
+    fe25519 ix, iy;
+    fe25519 s_;
+    fe25519 t_z_inv;
+    fe25519 x_, y_;
+    fe25519 x_z_inv;
+    fe25519 z_inv;
+    int     rotate;
 
-    fe25519_1(one);
-    (void) ristretto255_sqrt_ratio_m1(inv_sqrt, one, u1_u2u2);
     fe25519_mul(den1, inv_sqrt, u1);   /* den1 = inv_sqrt*u1 */
     fe25519_mul(den2, inv_sqrt, u2);   /* den2 = inv_sqrt*u2 */
     fe25519_mul(z_inv, den1, den2);    /* z_inv = den1*den2 */
@@ -2781,6 +3583,58 @@ ristretto255_p3_tobytes(unsigned char *s, const ge25519_p3 *h)
     fe25519_tobytes(s, s_);
 }
 
+void
+ristretto255_p3_tobytes(unsigned char *s, const ge25519_p3 *h)
+{
+    fe25519 inv_sqrt;
+    fe25519 one;
+    fe25519 u1, u2;
+    fe25519 u1_u2u2;
+
+    ristretto255_p3_tobytes_start(u1, u2, u1_u2u2, h);
+
+    fe25519_1(one);
+    (void) ristretto255_sqrt_ratio_m1(inv_sqrt, one, u1_u2u2);
+
+    ristretto255_p3_tobytes_finish(s, h, inv_sqrt, u1, u2);
+}
+
+/*
+ s[32 * i] = ristretto255_p3_tobytes(h[i]) for i < n, 4 points at a time
+ */
+
+void
+ristretto255_p3_tobytes_batch(unsigned char *s, const ge25519_p3 *h, size_t n)
+{
+    fe25519 inv_sqrt[4];
+    fe25519 one[4];
+    fe25519 u1[4], u2[4];
+    fe25519 u1_u2u2[4];
+    int     was_square[4];
+    size_t  i;
+    size_t  k;
+    size_t  m;
+
+    for (k = 0; k < 4U; k++) {
+        fe25519_1(one[k]);
+    }
+    for (i = 0; i < n; i += m) {
+        m = n - i < 4U ? n - i : 4U;
+        for (k = 0; k < 4U; k++) {
+            if (k < m) {
+                ristretto255_p3_tobytes_start(u1[k], u2[k], u1_u2u2[k], &h[i + k]);
+            } else {
+                fe25519_1(u1_u2u2[k]);
+            }
+        }
+        ristretto255_sqrt_ratio_m1_4(inv_sqrt, was_square, one, u1_u2u2);
+        for (k = 0; k < m; k++) {
+            ristretto255_p3_tobytes_finish(&s[(i + k) * 32], &h[i + k],
+                                           inv_sqrt[k], u1[k], u2[k]);
+        }
+    }
+}
+
 static void
 ristretto255_elligator(ge25519_p3 *p, const fe25519 t)
 {
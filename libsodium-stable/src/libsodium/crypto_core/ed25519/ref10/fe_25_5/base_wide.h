@@ -0,0 +1,2132 @@
+{ /* 0/25 */
+  {
+    { 25967493, -14356035, 29566456, 3660896, -12694345, 4014787, 27544626, -11754271, -6079156, 2047605 },
+    { -12545711, 934262, -2722910, 3049990, -727428, 9406986, 12720692, 5043384, 19500929, -15469378 },
+    { -8738181, 4489570, 9688441, -14785194, 10184609, -12363380, 29287919, 11864899, -24514362, -4438546 }
+  },
+  {
+    { -12815894, -12976347, -21581243, 11784320, -25355658, -2750717, -11717903, -3814571, -358445, -10211303 },
+    { -21703237, 6903825, 27185491, 6451973, -29577724, -9554005, -15616551, 11189268, -26829678, -5319081 },
+    { 26966642, 11152617, 32442495, 15396054, 14353839, -12752335, -3128826, -9541118, -15472047, -4166697 }
+  },
+  {
+    { 15636291, -9688557, 24204773, -7912398, 616977, -16685262, 27787600, -14772189, 28944400, -1550024 },
+    { 16568933, 4717097, -11556148, -1102322, 15682896, -11807043, 16354577, -11775962, 7689662, 11199574 },
+    { 30464156, -5976125, -11779434, -15670865, 23220365, 15915852, 7512774, 10017326, -17749093, -9920357 }
+  },
+  {
+    { -17036878, 13921892, 10945806, -6033431, 27105052, -16084379, -28926210, 15006023, 3284568, -6276540 },
+    { 23599295, -8306047, -11193664, -7687416, 13236774, 10506355, 7464579, 9656445, 13059162, 10374397 },
+    { 7798556, 16710257, 3033922, 2874086, 28997861, 2835604, 32406664, -3839045, -641708, -101325 }
+  },
+  {
+    { 10861363, 11473154, 27284546, 1981175, -30064349, 12577861, 32867885, 14515107, -15438304, 10819380 },
+    { 4708026, 6336745, 20377586, 9066809, -11272109, 6594696, -25653668, 12483688, -12668491, 5581306 },
+    { 19563160, 16186464, -29386857, 4097519, 10237984, -4348115, 28542350, 13850243, -23678021, -15815942 }
+  },
+  {
+    { -15371964, -12862754, 32573250, 4720197, -26436522, 5875511, -19188627, -15224819, -9818940, -12085777 },
+    { -8549212, 109983, 15149363, 2178705, 22900618, 4543417, 3044240, -15689887, 1762328, 14866737 },
+    { -18199695, -15951423, -10473290, 1707278, -17185920, 3916101, -28236412, 3959421, 27914454, 4383652 }
+  },
+  {
+    { 5153746, 9909285, 1723747, -2777874, 30523605, 5516873, 19480852, 5230134, -23952439, -15175766 },
+    { -30269007, -3463509, 7665486, 10083793, 28475525, 1649722, 20654025, 16520125, 30598449, 7715701 },
+    { 28881845, 14381568, 9657904, 3680757, -20181635, 7843316, -31400660, 1370708, 29794553, -1409300 }
+  },
+  {
+    { 14499471, -2729599, -33191113, -4254652, 28494862, 14271267, 30290735, 10876454, -33154098, 2381726 },
+    { -7195431, -2655363, -14730155, 462251, -27724326, 3941372, -6236617, 3696005, -32300832, 15351955 },
+    { 27431194, 8222322, 16448760, -3907995, -18707002, 11938355, -32961401, -2970515, 29551813, 10109425 }
+  },
+  {
+    { -22518993, -6692182, 14201702, -8745502, -23510406, 8844726, 18474211, -1361450, -13062696, 13821877 },
+    { -6455177, -7839871, 3374702, -4740862, -27098617, -10571707, 31655028, -7212327, 18853322, -14220951 },
+    { 4566830, -12963868, -28974889, -12240689, -7602672, -2830569, -8514358, -10431137, 2207753, -3209784 }
+  },
+  {
+    { -10455903, -10160979, 720868, 10531007, 18339027, -11188666, -25054770, 4039083, -24465831, -15814183 },
+    { -26181155, 13984649, -33165634, -5034672, 1302625, -2344616, 30122747, 14700686, -20671221, 871949 },
+    { -3082024, -11880191, 6822408, 6201219, 7614579, -13519607, -11565132, -6488093, -12121099, 3872940 }
+  },
+  {
+    { -25154831, -4185821, 29681144, 7868801, -6854661, -9423865, -12437364, -663000, -31111463, -16132436 },
+    { 25576264, -2703214, 7349804, -11814844, 16472782, 9300885, 3844789, 15725684, 171356, 6466918 },
+    { 23103977, 13316479, 9739013, -16149481, 817875, -15038942, 8965339, -14088058, -30714912, 16193877 }
+  },
+  {
+    { -14781127, -10481494, -30065593, 12501415, -31229705, 1732500, -26306760, -5568322, 32035790, 1977023 },
+    { 20796620, -2040467, -10186578, 8807827, 9358078, 14015453, -16926933, 6140170, -30890494, -1745996 },
+    { -7060141, -10144224, -16679467, -14871951, -2509975, 9921634, 28069242, 1630201, 22136893, 14621332 }
+  },
+  {
+    { -33521811, 3180713, -2394130, 14003687, -16903474, -16270840, 17238398, 4729455, -18074513, 9256800 },
+    { -25182317, -4174131, 32336398, 5036987, -21236817, 11360617, 22616405, 9761698, -19827198, 630305 },
+    { -13720693, 2639453, -24237460, -7406481, 9494427, -5774029, -6554551, -15960994, -2449256, -14291300 }
+  },
+  {
+    { -14598651, 1850128, 19981535, 180093, -33513985, 8502742, -5897708, 12976969, -14392111, -4539005 },
+    { 1512064, 14848309, 6700027, 8313829, -12998968, 15484842, -13928265, 1720870, -20597816, 12043177 },
+    { -31581310, 7430623, -1404204, -9628338, -4157856, 13310891, -1066977, -7179388, -3306582, 9633273 }
+  },
+  {
+    { -3151181, -5046075, 9282714, 6866145, -31907062, -863023, -18940575, 15033784, 25105118, -7894876 },
+    { -24326370, 15950226, -31801215, -14592823, -11662737, -5090925, 1573892, -2625887, 2198790, -15804619 },
+    { -3099351, 10324967, -2241613, 7453183, -5446979, -2735503, -13812022, -16236442, -32461234, -12290683 }
+  },
+  {
+    { 26223094, -12506805, -817594, -6574538, -18413955, 13765386, 18686369, -3396849, -7690672, 5303412 },
+    { 20852230, 1340053, -15306791, 6107716, -23311853, 8966632, -17691495, -15696681, -20600407, -13383612 },
+    { -24458581, -6348954, 15021041, 7419977, 24989846, 1575285, -1464843, 14432789, -30182382, 8836379 }
+  }
+},
+{ /* 1/25 */
+  {
+    { -26088264, -4011052, -17013699, -3537628, -6726793, 1920897, -22321305, -9447443, 4535768, 1569007 },
+    { -2255422, 14606630, -21692440, -8039818, 28430649, 8775819, -30494562, 3044290, 31848280, 12543772 },
+    { -22028579, 2943893, -31857513, 6777306, 13784462, -4292203, -27377195, -2062731, 7718482, 14474653 }
+  },
+  {
+    { 2379352, 11839345, -4110402, -5988665, 11274298, 794957, 212801, -14594663, 23527084, -16458268 },
+    { 33431127, -11130478, -17838966, -15626900, 8909499, 8376530, -32625340, 4087881, -15188911, -14416214 },
+    { 1767683, 7197987, -13205226, -2022635, -13091350, 448826, 5799055, 4357868, -4774191, -16323038 }
+  },
+  {
+    { -10879818, 11147915, 25025096, -188642, -25807629, 4805283, -26572268, 5858744, -29739747, -14318028 },
+    { 29249999, 1587251, 8425330, 14672795, 21823829, 4482432, -25758594, -6020393, 31066466, -14893670 },
+    { 2068553, -502519, 19176914, 5065616, -12365598, 25867, 12956327, -12067126, -29725911, 13902655 }
+  },
+  {
+    { -29755419, 6305835, -22834437, 1218102, 14106849, -3320406, 33180036, 7098280, 16480428, -10816293 },
+    { -25409045, -2090218, -3321267, 6706121, 1684499, -3393205, -5561614, -6662956, 6948745, -9283878 },
+    { 18131284, -12160957, -11401895, -5986896, -5516845, -492965, -4079275, 1219798, -15173186, 3647927 }
+  },
+  {
+    { -27580085, 3590082, -26936008, -11432116, -9296840, 3149719, -5501468, -1151429, 12822193, -2227426 },
+    { -18987436, 3002438, 20098016, -12242403, 13392443, -9855045, -20364211, 15543406, 26453399, 14854884 },
+    { 6764305, 7047422, -29893622, -12919448, 21921618, -7057340, -7455479, -9729523, -14115001, 3183103 }
+  },
+  {
+    { 1523420, 10679202, 9635317, -15851024, 28859785, -12786361, -24155424, -4145839, -9301569, -9425859 },
+    { -19738691, -16507562, 5247887, 13042635, -27496796, 14584524, -13999115, -11262217, 8479559, -6787305 },
+    { 16146780, 10277822, -626749, -16422649, -7166447, 516564, 16825489, 14881655, 13218624, -13374208 }
+  },
+  {
+    { -5932237, -2168516, -681669, 3767204, -7138641, 14757636, -7970699, 4524991, 12715145, 8916839 },
+    { -33368147, -7733513, 8002537, -4666348, 618845, -15992581, 24524264, -8687385, 32662893, -8480454 },
+    { -29940530, -13914854, 27576384, -2384063, -2022165, -1788456, 20995247, 16295875, 29283517, 9949342 }
+  },
+  {
+    { -22513286, 12246326, -18464073, -7350751, 33281396, 9110981, 1027358, -6331104, 7679661, 2842418 },
+    { -12261954, -5253859, 6370637, 4487386, -9942686, -11121872, -1484289, 3910609, 8734779, -9653790 },
+    { 20187343, -12265314, -5076413, 1625266, -5489572, 4035687, 31030596, -7400186, -25735164, 2419199 }
+  },
+  {
+    { 19147792, 6164570, 20688326, 10417915, -27729753, 10594950, -22153678, 19370, -27191450, 12402326 },
+    { 161954, 8426605, -7530599, 11200950, -20911759, -16368119, -27050361, 7142381, -12257552, 16606068 },
+    { 21164120, 14190972, 23904952, -1694215, 12358955, -9609917, -30203209, 2487295, 31896676, 10697451 }
+  },
+  {
+    { -23589264, 7731365, 13267315, 10305203, 12254267, 15803904, -12743384, 6378291, 12010309, -3242795 },
+    { -1432035, -2908739, -2118816, 15594986, -18175543, 14667394, 22853746, 14404375, -12409250, -7242666 },
+    { 30311170, -3959860, 11001050, -12177515, 22768237, 14406656, 29392430, 7486720, -764509, 15889556 }
+  },
+  {
+    { 28638931, 10166894, -12992197, 4589030, 3165861, -14217271, -16247107, 968790, -6088870, 16388647 },
+    { 25741468, -6320606, -28514596, 15578857, -7100230, -3752896, -8583145, -817244, 7714769, 10883471 },
+    { -23700357, -9360936, 6283266, 15122367, -16167596, 12989553, -6987064, 12127926, 16384980, 7563646 }
+  },
+  {
+    { 11080345, 5771544, -25438435, 2341831, 33357664, -7709139, 989408, 10996986, 7088054, -1307096 },
+    { -32057391, 2062735, -27657054, 14997402, -24256513, 747392, -18904030, 8416795, 26888753, -5729108 },
+    { -9858810, 4617589, -12692517, -2172298, 21515963, 12161333, 7668390, -3483423, -581023, -10257578 }
+  },
+  {
+    { -32796164, 10187568, -31872432, 14145307, 17312899, -1951449, -29949768, 6621865, 16463832, 5769668 },
+    { 10182958, 9614238, 10360629, 8382591, 10453695, 2327364, 1656995, -243318, -23929904, 4071234 },
+    { -12468744, -16053502, -25289967, -7914194, -27866112, -11794047, 2716328, -15161697, -450966, 154112 }
+  },
+  {
+    { 24420748, 9481110, 19972966, -15722536, -18334731, -10546401, -16761253, 5816652, 25059298, -1457221 },
+    { 20240252, -9121168, -30639459, -8966118, -27558520, -8882088, -779313, 11039021, 22207789, 9842208 },
+    { 3160704, 1780284, -11785238, 4574308, 2863317, -7441694, -28914973, 5800492, 9511713, 10675239 }
+  },
+  {
+    { -8686081, 9238460, 21639710, 7557139, 22891556, -12778705, 2288825, 3175568, -15158933, 6381981 },
+    { -20011738, -15393207, -24078111, 3086937, 18287597, 7626983, 2486164, -9897901, 33024195, 16532810 },
+    { 6496670, 14757337, 12645948, -1193134, -26799955, 1098560, -29634103, -8158936, -2691296, -6987207 }
+  },
+  {
+    { -15739746, -11220585, 19995470, -7561731, -31096311, -2785751, 23370033, 2652913, -19683896, -1586607 },
+    { 21052810, -1610886, 13610781, 11319631, -3579929, -8738841, 29919090, 7572283, 29080032, -5602195 },
+    { -20410884, 9161070, 2962171, -11180144, 9727648, -11619100, -30948360, -4939465, 29083304, -638292 }
+  }
+},
+{ /* 2/25 */
+  {
+    { 19274469, -5125445, 2025249, 13387528, -26551745, -13237864, 8572282, -5701955, -7605577, 3755890 },
+    { -1003765, -3998347, -29431273, 5708148, 20949970, -10765004, 2582995, 4041757, 28570893, 242978 },
+    { 24217466, 683998, 12990241, -14980929, 24711442, 2582675, -18704628, -10573407, 27632805, 10325174 }
+  },
+  {
+    { -1376293, 10581090, 17601840, -2177403, -23669777, 2515960, 7946113, 5265099, -30565938, 15659181 },
+    { 11690190, -256939, -28435932, 7575499, -10373362, 8175929, -1669485, -6706172, -29188463, 11378246 },
+    { 3934827, -895850, 14579491, -4161754, 26542055, 14629900, -19665954, 12702562, -9783987, -15825989 }
+  },
+  {
+    { -7905285, -7567146, 24242009, -9981986, -10005548, 2864673, -12432996, -290370, -32192614, -12380245 },
+    { 21648538, 5875995, -25737427, 5595486, -2079098, 2667116, -30134869, -9286435, 2742570, -4025892 },
+    { -17630385, -4775178, -17556574, -12786114, 22223083, 9281306, 25269654, 16741825, 7733910, -4295804 }
+  },
+  {
+    { 18931912, -5979763, 8372851, -1816752, 17694526, -3581508, -27130390, -2408709, 18843966, -5880493 },
+    { 31572541, 1387635, -27527774, 1197914, -15555676, 13484267, -12740138, 13093864, 20957081, -3614436 },
+    { 11695417, -11068051, -11229652, -9956937, -13423087, 6286991, 6574490, -8543138, -31992930, -3252886 }
+  },
+  {
+    { 4406854, -203587, 23268839, -16188749, 3696359, -3025310, -2374384, -14048190, 25835549, 14199049 },
+    { -9053661, 9666137, 17702016, 13681030, 31673492, -7546596, 25994291, 7426565, 11705204, -499004 },
+    { -9704638, 7750859, 4780558, -9879028, 3972007, -1273251, 9397471, 6020439, 9390255, -13657745 }
+  },
+  {
+    { -4038073, 4122774, 15819690, -2689661, 32461321, 5475061, 7223123, 15194198, 6509018, -10905669 },
+    { -9539544, 2095849, 29789961, 61126, 24968268, -13581175, -2582874, -12225942, 13866993, 1421457 },
+    { -4214256, -4717999, 22567784, 3736576, 19253254, -4356505, 28225722, -14220075, 2798085, 8570919 }
+  },
+  {
+    { -21155172, -14003898, 8717306, -11400688, 17970583, 10837346, 31185163, -6616264, 6612499, -14261069 },
+    { 8368990, -7533904, -5084524, 4262330, 745608, 13759847, -15288234, 15767429, -2114388, -1422552 },
+    { 16253406, -12125540, 5328056, 520783, 7323359, -5067190, 25388761, -12503796, 13788611, 15592195 }
+  },
+  {
+    { -18007641, -11299895, -22979045, 15904833, -24466524, -2430858, 14251255, -13476220, 30848991, 13037900 },
+    { 113900, 16486627, 15167557, -13760546, 21770965, -6995991, 13113953, -1349366, -31585887, 10056458 },
+    { 25229681, -12266646, 5569512, 8982737, 32063203, -5581096, -1437669, 4966335, 13017505, 11031479 }
+  },
+  {
+    { -26294597, 4730095, -16544977, -10929219, -3421623, 15165497, 4724359, 1955409, 14977778, -49192 },
+    { -2727118, -981409, -10085422, 116685, -18506519, 1791136, -19312178, -9617812, -19311299, -10601958 },
+    { 27565335, 5595909, -17787629, 13778296, 31190745, -3069030, 21213892, 11418028, -19541047, 15939744 }
+  },
+  {
+    { 16850169, -8996436, -4481538, 12016857, -27101114, -8680430, -6266309, -10352967, -18614135, -5821359 },
+    { -14512851, -1017831, -24762516, 6426576, -12480815, -13493287, 30360378, -1597860, 11572277, -8359034 },
+    { -5134594, -13393844, 1488762, 9424355, -17254797, 1267019, 20571831, -5952862, 32433560, -10171027 }
+  },
+  {
+    { -10111520, -16015270, 14650912, -12469556, -21341610, -7882094, 12466540, 14608749, 6229290, -9338061 },
+    { 1493628, 7316591, -8235485, -14211380, 30393151, 1473282, -10718407, 11315570, -4171135, -13796380 },
+    { 23256211, 7123862, -19477794, 9285235, 32045282, 13188552, -2661327, 1753847, -33306116, 1624329 }
+  },
+  {
+    { 11891931, -11545996, -30888798, 1033462, 22381147, 10994015, -23405517, -16299913, -15918279, -2815226 },
+    { 19835770, 14555215, -28862036, -12190709, 19878816, -9591938, -31046389, -5528839, 24184435, -13427156 },
+    { 11364751, -13739623, -3404619, 689249, 31972255, 5569569, -13722890, -4749785, 5354749, 6408875 }
+  },
+  {
+    { -16249467, 3451746, 2364097, -13229053, -14492667, 9039454, -21150741, -1734589, -12907138, 8884888 },
+    { -30077295, -6481710, -32382800, -8162903, 21366547, -11608322, 9100928, -2474596, -27332631, -3742390 },
+    { -14174879, 133507, -28969940, -7208802, -29150037, -1404085, -5821703, 4352362, -11442165, 4927022 }
+  },
+  {
+    { -32887459, -8479002, -30236479, 5955623, -24527345, 14384943, -12755770, -5086009, -3588923, -9050202 },
+    { -23489464, 9319502, -16716390, 15978717, 8028184, 2087422, 20612946, 8183027, -23941448, 1851955 },
+    { -16755540, 14544707, 11429239, -4453879, -2192969, 14145566, -6887014, -11313067, -27492893, 15063904 }
+  },
+  {
+    { -31082173, 10610270, -4305948, 16546898, 14492886, 1768266, 18492514, -2986103, 10922399, -3770948 },
+    { -7370282, -7408695, -16364285, -2030071, -10387640, 12760971, 21969852, -16447264, 25017654, -12698683 },
+    { -10203005, 9377171, 17137137, -11434997, 761568, -15215715, -9365568, -10256943, 12145272, -12317906 }
+  },
+  {
+    { 7881532, 10687937, 7578723, 7738378, -18951012, -2553952, 21820786, 8076149, -27868496, 11538389 },
+    { -19935666, 3899861, 18283497, -6801568, -15728660, -11249211, 8754525, 7446702, -5676054, 5797016 },
+    { -11295600, -3793569, -15782110, -7964573, 12708869, -8456199, 2014099, -9050574, -2369172, -5877341 }
+  }
+},
+{ /* 3/25 */
+  {
+    { 7654660, 7028247, -28691608, 540979, -19280698, -5394104, 9795209, 8516409, 13848267, -1499300 },
+    { 30465487, -13875670, 357144, -6273628, -4648327, 10924293, 4789084, 2863329, 27548793, -6193966 },
+    { 4433141, 3224307, -2806764, 5354430, 31289755, -461331, 22067864, -4713425, 2154528, 4684644 }
+  },
+  {
+    { 13874816, -13376467, 30152726, -13956199, -23325064, 13021371, -24134600, 14450792, 13790612, -10418809 },
+    { 18487466, 935344, -33484627, -8443849, 11904660, 6601985, -7750533, 16303926, -15507119, -6926203 },
+    { -19759966, 11298845, 14718846, 13623030, -16980751, 6469663, -19011727, 11615538, 11731611, 768756 }
+  },
+  {
+    { 7412304, 6136424, -10222376, -2174735, -1330527, -10545240, -7378832, -13628712, 33375168, 8266486 },
+    { 26433354, -12312941, 6562825, 12902180, 27135363, 3213284, 7040880, -2107596, -24019488, -15463872 },
+    { -9280122, -3211043, -22976686, -5794441, 1136543, -1924810, -26128016, 6375111, 19323228, 4342228 }
+  },
+  {
+    { -8010264, -9590817, -11120403, 6196038, 29344158, -13430885, 7585295, -3176626, 18549497, 15302069 },
+    { -32658337, -6171222, -7672793, -11051681, 6258878, 13504381, 10458790, -6418461, -8872242, 8424746 },
+    { 24687205, 8613276, -30667046, -3233545, 1863892, -1830544, 19206234, 7134917, -11284482, -828919 }
+  },
+  {
+    { -183856, 7253880, -9729217, -4426510, -9604158, 8929434, -11880237, 11398065, -30953095, 16679086 },
+    { 28663812, 13673569, -3261921, -3738579, -15306941, 999305, -14749383, 4021623, -9959381, 11833053 },
+    { 6422792, -8825252, -24714630, -16254302, 2241289, 1726479, 11414623, 10754927, -3268217, 8249867 }
+  },
+  {
+    { -10702335, 3317731, -30313478, -15012290, -16477779, 3877467, -26316042, 11185581, -25922590, -12440520 },
+    { -5346748, 14583773, -17737243, 9857100, -19569058, 13765643, 25667707, 6333629, -27496517, -16254087 },
+    { 23508527, -2974387, -18892984, -8662945, -19683935, -13212212, 30378340, 4786462, 18434702, -9356530 }
+  },
+  {
+    { -18143090, 11421526, 33171776, 2769327, 11473713, 9278914, 33413959, -12733299, -5271062, -12638207 },
+    { 13092958, -958948, -4034161, -10191082, 18688819, -11348829, -20979749, -15236783, -28894503, -9289995 },
+    { -23414889, -8707427, -22310171, -11701512, 8019208, -3880757, 9831298, -14423348, 23496782, 14171864 }
+  },
+  {
+    { 11334899, -9218022, 8025293, 12707519, 17523892, -10476071, 10243738, -14685461, -5066034, 16498837 },
+    { 8911542, 6887158, -9584260, -6958590, 11145641, -9543680, 17303925, -14124238, 6536641, 10543906 },
+    { -28946384, 15479763, -17466835, 568876, -1497683, 11223454, -2669190, -16625574, -27235709, 8876771 }
+  },
+  {
+    { 4980929, -15981616, 5986258, -1739171, 19735389, -14019607, 22873617, 15476713, -6649846, -12725189 },
+    { 30881955, 2643915, 29506573, 8452620, -22484260, 5562652, 12683917, 11341547, 18919380, -2965740 },
+    { -14069010, 4905618, -15888044, 7970553, 20469839, -16746609, -27600414, -15635408, -29730810, -1479823 }
+  },
+  {
+    { 13959286, -2228995, -10874380, -6152087, 15323191, 3749276, 11219370, 4335378, 4843384, -6008891 },
+    { -18484516, 11138640, -12961547, 14219019, 21273775, 7900507, 8188084, -13396131, -28976531, -13298926 },
+    { 11930052, 11115893, -18311029, -1030810, -32648981, 13849959, 22930654, -4811060, 25399588, 98655 }
+  },
+  {
+    { -180937, -14672787, 26925304, 2340664, -13404042, -12168310, 15661986, 4975785, 1486389, -1411020 },
+    { -22780918, 808092, -18973409, -10480813, 20104436, -11158130, 23371527, -12941756, 10772114, -2301828 },
+    { -821154, -6112357, 29268884, 5393644, -24013625, -15215458, -32675913, -5658819, 33062948, -6725796 }
+  },
+  {
+    { -25742899, -12566864, -15649966, -846607, -33026686, -796288, -33481822, 15824474, -604426, -9039817 },
+    { 10330056, 70051, 7957388, -9002667, 9764902, 15609756, 27698697, -4890037, 1657394, 3084098 },
+    { 10477963, -7470260, 12119566, -13250805, 29016247, -5365589, 31280319, 14396151, -30233575, 15272409 }
+  },
+  {
+    { 7002873, -7390759, 12805954, 14721563, -28766931, -3068011, 17720489, 8883576, 2473738, 8797873 },
+    { 27437967, -11442011, 1772381, -8237281, -7599905, 14113154, 16088777, 3107068, -9565273, 13145052 },
+    { -3431032, 9985685, -23977715, -5103358, 24104018, 2378458, 6203237, 6021787, -10326221, 15187406 }
+  },
+  {
+    { -33017465, 6886659, 11378792, -4119015, -16344191, -3122927, 3733352, -78741, 13706760, 10736894 },
+    { 3452270, 11131577, -998551, 4945333, 1203700, 2858523, 13620307, -5889702, -15672065, -4354715 },
+    { -4166734, -1690867, 22640957, -2775134, 29005212, -11816751, 10249401, -15313265, 22844490, 9390774 }
+  },
+  {
+    { -1384602, 1788034, 32732921, -13975284, -8580962, -15167752, 1980395, -16070620, -8560363, 15751230 },
+    { 31298277, -7825875, -8280290, 7459461, 1118630, -6926251, 23035008, -13765092, 26233151, -10977524 },
+    { -28518081, 12593259, 4379388, 8139854, 24335121, 15694043, -27443151, -9749442, 8958968, -13863389 }
+  },
+  {
+    { -12288309, 3169463, 28813183, 16658753, 25116432, -5630466, -25173957, -12636138, -25014757, 1950504 },
+    { -26180358, 9489187, 11053416, -14746161, -31053720, 5825630, -8384306, -8767532, 15341279, 8373727 },
+    { 28685821, 7759505, -14378516, -12002860, -31971820, 4079242, 298136, -10232602, -2878207, 15190420 }
+  }
+},
+{ /* 4/25 */
+  {
+    { 11433042, -13228665, 8239631, -5279517, -1985436, -725718, -18698764, 2167544, -6921301, -13440182 },
+    { -31436171, 15575146, 30436815, 12192228, -22463353, 9395379, -9917708, -8638997, 12215110, 12028277 },
+    { 14098400, 6555944, 23007258, 5757252, -15427832, -12950502, 30123440, 4617780, -16900089, -655628 }
+  },
+  {
+    { -4026201, -15240835, 11893168, 13718664, -14809462, 1847385, -15819999, 10154009, 23973261, -12684474 },
+    { -26531820, -3695990, -1908898, 2534301, -31870557, -16550355, 18341390, -11419951, 32013174, -10103539 },
+    { -25479301, 10876443, -11771086, -14625140, -12369567, 1838104, 21911214, 6354752, 4425632, -837822 }
+  },
+  {
+    { -10433389, -14612966, 22229858, -3091047, -13191166, 776729, -17415375, -12020462, 4725005, 14044970 },
+    { 19268650, -7304421, 1555349, 8692754, -21474059, -9910664, 6347390, -1411784, -19522291, -16109756 },
+    { -24864089, 12986008, -10898878, -5558584, -11312371, -148526, 19541418, 8180106, 9282262, 10282508 }
+  },
+  {
+    { -26205082, 4428547, -8661196, -13194263, 4098402, -14165257, 15522535, 8372215, 5542595, -10702683 },
+    { -10562541, 14895633, 26814552, -16673850, -17480754, -2489360, -2781891, 6993761, -18093885, 10114655 },
+    { -20107055, -929418, 31422704, 10427861, -7110749, 6150669, -29091755, -11529146, 25953725, -106158 }
+  },
+  {
+    { -4234397, -8039292, -9119125, 3046000, 2101609, -12607294, 19390020, 6094296, -3315279, 12831125 },
+    { -15998678, 7578152, 5310217, 14408357, -33548620, -224739, 31575954, 6326196, 7381791, -2421839 },
+    { -20902779, 3296811, 24736065, -16328389, 18374254, 7318640, 6295303, 8082724, -15362489, 12339664 }
+  },
+  {
+    { 27724736, 2291157, 6088201, -14184798, 1792727, 5857634, 13848414, 15768922, 25091167, 14856294 },
+    { -18866652, 8331043, 24373479, 8541013, -701998, -9269457, 12927300, -12695493, -22182473, -9012899 },
+    { -11423429, -5421590, 11632845, 3405020, 30536730, -11674039, -27260765, 13866390, 30146206, 9142070 }
+  },
+  {
+    { 3924129, -15307516, -13817122, -10054960, 12291820, -668366, -27702774, 9326384, -8237858, 4171294 },
+    { -15921940, 16037937, 6713787, 16606682, -21612135, 2790944, 26396185, 3731949, 345228, -5462949 },
+    { -21327538, 13448259, 25284571, 1143661, 20614966, -8849387, 2031539, -12391231, -16253183, -13582083 }
+  },
+  {
+    { 31016211, -16722429, 26371392, -14451233, -5027349, 14854137, 17477601, 3842657, 28012650, -16405420 },
+    { -5075835, 9368966, -8562079, -4600902, -15249953, 6970560, -9189873, 16292057, -8867157, 3507940 },
+    { 29439664, 3537914, 23333589, 6997794, -17555561, -11018068, -15209202, -15051267, -9164929, 6580396 }
+  },
+  {
+    { 856458, 3818719, 19448662, 10894052, 24532667, -8031290, -6942843, -7633185, -20504466, -5941086 },
+    { -30220592, 11364139, 28139985, 13630081, 23278065, -5126183, -11001460, 14617861, 3452554, -7356773 },
+    { -19973575, 69174, 15544046, -13972864, 18820029, -9403539, -3375150, 6617236, -22637687, 1134508 }
+  },
+  {
+    { -30028495, -7964067, 31993424, 13321794, -12801509, -5180085, 1677203, -8247573, 26977120, -50251 },
+    { 21872900, 9897841, 14833249, 13506487, -30547264, -10341040, 17421990, 4028982, 28852918, -10808122 },
+    { 6939750, -13339768, -25162737, -12102673, -17744091, 13119947, -11774232, 6355519, 27675614, 15562793 }
+  },
+  {
+    { 29797683, -12232491, -14920905, -4710610, -797900, 13686371, 18727326, 9301801, 24541936, -9768206 },
+    { -11921938, -10078045, -22125373, 14413208, 13717843, -3990871, -30378941, 13837922, -15357751, 2546028 },
+    { 22216023, -11433582, 5618616, 5123301, -6069233, 15898516, 5099169, -10085817, 22765821, 13338888 }
+  },
+  {
+    { -20150988, -865229, -18660994, 207765, -3075731, 8192686, 11781798, -10104784, -28536052, -501200 },
+    { 7996366, -1776054, 16521724, 4691545, -14103069, -3354999, -30324745, -15597732, -3273750, -3200677 },
+    { 6576267, 1876189, -9872120, 13538299, -5233551, 3787823, -21401029, -6109718, -2276078, -6330663 }
+  },
+  {
+    { -15037747, -15397877, 22340307, -15339259, 16125685, -5275034, 16770516, 837447, 30436868, 4152028 },
+    { -4019522, -7268057, 23604078, 12973879, 14998860, 3813301, -14669398, -15923951, 23079978, -16288198 },
+    { -23958459, -13407802, -23599070, -15280460, 31979801, -6213648, 9862895, 2562035, -24612330, -14889250 }
+  },
+  {
+    { 12646175, 4012004, -20935122, -8022761, -7897068, 12054158, -24566701, -352326, 21837927, 323704 },
+    { -572913, -1664246, -18383902, -16570886, 6499418, 15036444, 220935, -6107028, 2001703, -4018257 },
+    { -203017, 14812141, 27524763, -12759929, 15360611, -7961311, -29468762, 965309, 22587766, -11320028 }
+  },
+  {
+    { 14039917, 9054809, -17804633, 5081345, 4662378, 11343506, -17780862, -2203524, -33307319, 6514132 },
+    { 19843098, -104724, 13314184, -9204699, -9697260, -5040369, 2767428, 1275735, -10321323, 11109603 },
+    { 832007, 10232264, -30501712, -16725515, 2721888, -13268993, -12071669, 12135364, -14690044, -4371445 }
+  },
+  {
+    { -2057689, -13794612, -24133317, -8462964, -15854653, 11926895, 24462524, -10400996, -8692214, -12157994 },
+    { -9483899, 153323, 31677098, 14319101, 1299253, 816448, -15243115, 5297074, 4923922, 11471160 },
+    { 19188924, 16119364, -32390388, 2999380, 32178693, -9424395, -21396285, -10705542, -18306160, -7811606 }
+  }
+},
+{ /* 5/25 */
+  {
+    { -18603066, 4762990, -926250, 8885304, -28412480, -3187315, 9781647, -10350059, 32779359, 5095274 },
+    { -33008130, -5214506, -32264887, -3685216, 9460461, -9327423, -24601656, 14506724, 21639561, -2630236 },
+    { -16400943, -13112215, 25239338, 15531969, 3987758, -4499318, -1289502, -6863535, 17874574, 558605 }
+  },
+  {
+    { 8139927, -6546497, 32257646, -5890546, 30375719, 1886181, -21175108, 15441252, 28826358, -4123029 },
+    { 6267086, 9695052, 7709135, -16603597, -32869068, -1886135, 14795160, -7840124, 13746021, -1742048 },
+    { 28584902, 7787108, -6732942, -15050729, 22846041, -7571236, -3181936, -363524, 4771362, -8419958 }
+  },
+  {
+    { -8032364, -704247, -17388100, 13277582, 20710629, 2976906, 4853429, 14192122, -24983990, 9472291 },
+    { -18806633, -796710, -4645136, 8279527, 8049298, 7141207, -11239422, -5134155, 21942737, -3177373 },
+    { -19365807, 7606373, -10151095, 6931475, -16979831, -3414477, 287903, -5523370, -22802976, 473055 }
+  },
+  {
+    { 17912732, -16092699, -23476692, 3944828, -10517612, -7179213, 20648131, 3965321, 25469530, -3442254 },
+    { 17267796, 4369299, 20216911, -7939165, -30519798, 12392099, -15110587, -9548329, -20275099, -3661740 },
+    { -9788656, 11359472, 29586899, -11795605, 1321283, -44743, 28967383, 3240535, -10200090, 938826 }
+  },
+  {
+    { 19995698, -14869473, 21733780, 7271087, -33526056, 1567729, 11559245, 4285709, 8919020, 8211320 },
+    { -31342735, 7157393, 5623109, 8163183, -26777730, 15033496, 28918132, 3421559, 31066108, -952030 },
+    { 73735, 5703762, 4816505, 5621744, 95696, -3536840, 21741868, -6856250, -19370432, -5862324 }
+  },
+  {
+    { 19718727, -11665483, -33419035, 14383875, -1245457, -13328500, 5183654, 6759460, -9315996, 411019 },
+    { 2635071, -6949286, -24784123, -8329913, 19005633, -3301363, -11733424, 9556722, 6227827, -10823066 },
+    { 20722760, 2199673, -20915574, 11183975, 19329394, 3226336, -19102126, 6685912, -7476329, 9930534 }
+  },
+  {
+    { 11053003, 3841192, 27964335, 366696, 20767752, -10781921, -23709973, -3618570, -26398794, -7229948 },
+    { 28381678, 15778838, 11760291, 1241910, -3674382, -6711404, -11610164, 1704824, -18641853, 10572510 },
+    { -32373313, -5625516, -5983304, -9317260, 12767625, 2257463, 11956135, 6783612, 16163175, 10524266 }
+  },
+  {
+    { -30063177, 5835117, -28123481, -735266, 5676682, -9446010, -30843342, 10343790, -24897229, -1612201 },
+    { 25095668, -3632031, -25646677, 15666421, -7485125, -8818634, 10553094, 15233358, -9930050, 15528461 },
+    { 26598792, 10725764, 17168817, -12521779, -23850141, -10978889, -18530094, -11449726, -29909881, -8162213 }
+  },
+  {
+    { -8318532, -12636760, 21717015, -2580894, 21804605, -13841243, 11927129, -10199743, 16973957, -16071123 },
+    { -21264868, 14313902, 12180126, 10524394, 17275998, -15237935, 11420153, -10625466, 9690397, -3483465 },
+    { 846469, -816241, 19449665, -12586366, -24674030, 15047448, -18210608, 1065907, -18273302, -5298951 }
+  },
+  {
+    { -15442323, -8255517, 8206149, -10900137, 29502183, 11643472, 14694065, -6830475, 24747084, -1270704 },
+    { 28288790, 8433161, -9525037, -1975094, 26136821, -12164176, -18923543, 4506800, 2485564, 255830 },
+    { -10519690, 2450006, 1645019, 9012042, -7219985, -5339359, -24945065, 14039789, 28007951, -4738037 }
+  },
+  {
+    { 19968753, -7107377, 12037051, 12969516, 30972052, 14514991, -2548294, 12304827, 31917989, 1317958 },
+    { -11948798, -7687151, 21697570, 9893844, -3656904, 10493510, -21765360, 11794312, 28911981, -5470387 },
+    { 21996814, -2560087, 23283746, 7541733, -5776731, -6921647, -5156128, -15494238, 12096625, -1088990 }
+  },
+  {
+    { 20858827, 7716357, -20871520, 10528024, -18963043, -10644188, -9151709, -11451866, 1577263, -13006193 },
+    { -8264340, 11670045, 5858996, -13190140, 23445499, -5786029, -4655634, 13678963, 1684698, -9952556 },
+    { 23771014, -13958892, -28853989, -16083794, 23423949, -16633663, -18277778, 3775198, -24631884, 2402240 }
+  },
+  {
+    { 31104319, 10380133, -544381, -6090915, 30291780, -12456961, -29854295, 7212734, 11237062, -14129905 },
+    { 19711148, -9468178, -33254111, -4994134, 3404859, 7715587, 981112, 16348652, -2105858, -4887462 },
+    { -14435999, 6853668, -9866281, 7701234, -9274949, -4845546, -331979, 14880194, 6618018, -16359717 }
+  },
+  {
+    { 30079845, -11806721, -24908142, -4068090, -26173684, 5736948, -1229355, 11764498, -6614201, 15736094 },
+    { 21015958, -15418770, 14040455, 5019259, 28636236, 1748556, 27397006, -438522, -10107521, -5526075 },
+    { 29786748, 3710360, 24410277, -4251865, -8731657, 805205, -4385538, -3041485, 22455054, -2772167 }
+  },
+  {
+    { 26862404, 852578, 2867928, -4671779, 28866252, -2896813, 18241523, -12107321, -1697837, -8302419 },
+    { -5763891, 13789138, 11536636, 2705072, -17359333, 11957011, 8938051, -16013653, 7125828, 4858143 },
+    { -33409148, -1567008, 5579520, 3018182, -2458904, 11547642, -19313047, 9406175, -23192632, 6700561 }
+  },
+  {
+    { 22439197, 6073835, -18681498, -3015329, 352366, 5109476, 10943265, -16128583, 30589587, 12639673 },
+    { -3083565, -8358797, -9442335, -8713834, 30259461, -7479673, 2234642, 10981484, -13673465, 7924042 },
+    { 22652335, 6515168, -25265582, 13236281, 28274803, 13460880, -4372059, 2427596, -20657332, -11572556 }
+  }
+},
+{ /* 6/25 */
+  {
+    { 166991, -15976393, 15612707, -12414786, 3859799, 10068474, 15791766, 8882529, -13904217, -16113556 },
+    { 5878335, -11030369, 10377567, -1004952, -26821707, -12500491, -32589455, 1330441, 20157226, 5246228 },
+    { -10703555, -5134677, 32878464, 10118550, -16188877, -13117789, -18307586, -12382964, 4281976, 2841433 }
+  },
+  {
+    { -7176526, -14530030, 17755939, -8800171, 13593436, -15587581, -7176951, 11682802, -17650183, -11954511 },
+    { 24898741, 9496464, 5033731, 6719600, 19600974, 9612324, 29526147, 4615092, -30745039, 4637079 },
+    { -16993447, -570329, -1406964, 2180914, -10106635, -10114385, 981040, -16698728, -5368639, -15756431 }
+  },
+  {
+    { 29542070, -2182933, -7168690, -4764788, -12344156, 4582134, 29160811, -8922022, 6050304, -14977506 },
+    { 20489514, 11664490, -27510910, -10908666, 18661539, -3332790, 2854782, -14555153, 2555760, -2911023 },
+    { -10712936, 28558, 6884883, -5300244, 19667819, -14481644, 423572, -7844175, 16634613, 11281690 }
+  },
+  {
+    { -16801750, -1762975, -22467725, 9434440, -9951831, -8933476, 27827120, -3222516, -32374318, 7290746 },
+    { -16659543, -2982994, 20476665, 10859803, -32517917, 4205786, -15350323, -1086381, 17401998, -5907683 },
+    { 6969781, 9774089, -5109431, 16204799, -10945801, -14454277, 29242247, -2434264, 9253113, -5791284 }
+  },
+  {
+    { -3669226, 3129507, 31416816, -6565690, 27965531, -13838685, -711700, -13280343, 9391828, -7974698 },
+    { -27869520, 10677334, -8828821, -2983317, -1840345, -12009354, 20734475, 12867382, -9533141, 16434110 },
+    { 17014661, -6877276, -11191730, -1067110, -16537698, 420500, -12178760, -4473581, 8518315, 15782726 }
+  },
+  {
+    { -7956, 12772300, 32978859, 8517266, 27953488, 6824388, -1319335, 7161177, 11931082, -8295195 },
+    { 10460864, -11872344, 17958900, -8539875, 7777518, 14231236, 30537017, 7189523, 18087307, 14485069 },
+    { -23257390, 1423639, 20207261, -5020483, -4218590, 6221438, -26758641, -7211487, 29919858, 12403424 }
+  },
+  {
+    { -2469315, -11851734, 4851051, -5102376, 13157069, 12165049, -27074990, -12296615, 9797749, -1265251 },
+    { 6820283, 9377919, 124462, 4395148, -26029759, -6727852, 10086820, -413999, -11524269, 13780629 },
+    { -19755809, 5857808, -3720534, 9870103, 4940095, -13136305, -5936654, -3243695, 33015652, 13484 }
+  },
+  {
+    { -23811906, -14818544, 25006789, 7818556, 2841551, -9159601, 23314567, -6712687, -10834224, -2520603 },
+    { 7162490, 8520820, -235608, 2918152, -17043438, -12026913, 6511583, -12247282, 23271856, -4675124 },
+    { -19555662, 2820406, -33502507, -949064, -14455339, -11775334, -6229176, 2263280, 30370950, -10340844 }
+  },
+  {
+    { -14153619, -5936245, 26559889, -10275116, 23091691, -6645492, 27277322, -10480815, -7222825, -11061979 },
+    { -17922285, -2059844, -2788841, 10082224, -23042987, 7924064, -12557107, -11923649, 29584993, -4861537 },
+    { 25563885, 14404915, -26923773, -8377218, -1750972, 12924822, -4663112, 8390978, -19350274, -10414879 }
+  },
+  {
+    { 2802201, 6388282, 17974956, 13015754, 1622499, 3408423, 51105, 6924884, -26833658, -16542012 },
+    { -28148458, -8415979, 27555912, 11302786, 16785938, -14671332, 32918065, 5797731, -28766650, -10643504 },
+    { -26483368, -5660162, 24602409, 2152784, 11687226, 6476518, -3591987, 8237920, 30748916, 9579252 }
+  },
+  {
+    { 32778029, -6592894, 10575199, 1309227, 20063865, 2366075, 24290483, -14380474, 19466830, -12966689 },
+    { -31419487, 3753739, 25834170, -12661978, 28927836, -13031616, 2559163, 14797755, -12282020, -336596 },
+    { -11283032, 965075, -10419109, 1024677, 4901738, -4222859, -8398458, -3200735, -23883412, 3152440 }
+  },
+  {
+    { 8973235, 15634443, 22149738, 6342817, 6202129, 6787876, 16977729, 146860, -11114185, 10592439 },
+    { 17827488, 15497598, -15844279, 849808, -28255718, 3399728, 13330136, -6677954, -29239623, 7587038 },
+    { -27148343, -10019514, 8286741, -4482008, -12488585, -6714325, 27803656, -16367898, -1813203, -7093361 }
+  },
+  {
+    { -8411477, 8151476, 3675597, -3715319, -11523257, -16679986, -18061191, 2035568, -31574641, 9900149 },
+    { -13966927, -14115602, 5893488, -12236061, 30263829, -4873750, -20317206, 10972758, -24346414, 44769 },
+    { -13460285, -4538769, 17486465, -7469399, 4959170, 12454093, -33310938, -6693239, 4957181, -5724073 }
+  },
+  {
+    { -15755379, 3991544, 24106352, -16680170, 32549896, 1059935, -25306315, -8806320, 4619868, 8266818 },
+    { 27223156, 12632188, -17242749, 5932654, 6032259, 13876663, 31352056, -1958779, 24518795, -1897650 },
+    { 18471665, -14571490, 13319358, -5800023, -2911075, -233626, -14570047, 4097065, -24013261, 7109180 }
+  },
+  {
+    { 3408337, -4262303, -2370363, 14132412, 3288387, -11644227, -32698312, -15487970, -7640801, -4442594 },
+    { 17768860, 16490824, -12040045, -10263510, -30426614, 7900666, 22075554, 4467372, 25148505, 6512365 },
+    { 25667472, -4550627, -31375242, -3286969, -10776788, -16405497, 30760022, 11165052, -20870141, -12199707 }
+  },
+  {
+    { -3017432, 10058206, 1980837, 3964243, 22160966, 12322533, -6431123, -12618185, 12228557, -7003677 },
+    { 32944382, 14922211, -22844894, 5188528, 21913450, -8719943, 4001465, 13238564, -6114803, 8653815 },
+    { 22865569, -4652735, 27603668, -12545395, 14348958, 8234005, 24808405, 5719875, 28483275, 2841751 }
+  }
+},
+{ /* 7/25 */
+  {
+    { -33349104, -12968546, -10808498, 8713650, 33524436, 13108626, -1419451, 4669469, -5523721, -3186258 },
+    { -8099411, -5380176, -31015873, 2560818, 5636160, -9168869, 12687448, 15176521, 15747510, 15632705 },
+    { 28990153, 11360283, 28664170, 8248719, -22786756, -16472522, 11077326, 12281365, -13134018, -6271260 }
+  },
+  {
+    { -26424185, -10781027, -13852000, -951650, 15474996, 10668212, 24279721, 13459047, -6237183, -10048830 },
+    { 24350163, 12173425, -8529029, -5401735, -1631271, 15818485, 11878433, 10161213, 33224202, 15370052 },
+    { -27349979, -12905691, -18411784, 2293916, 6365638, 11138129, -6185985, -12006553, 15502955, 6395806 }
+  },
+  {
+    { -22956456, -756042, -15806360, 3959375, 29470269, 6405422, -27353020, -3353214, 2165810, -10267697 },
+    { 18128975, 5634442, 31759800, 12307418, 6560675, -8962366, -20761020, 9034332, 8644625, -7386993 },
+    { -32154091, -3311962, 17434343, 11896135, 21065782, 14346328, 6089569, -12076264, -9727276, 8877999 }
+  },
+  {
+    { 5414091, -15386041, -21007664, 9643570, 12834970, 1186149, -2622916, -1342231, 26128231, 6032912 },
+    { -26337395, -13766162, 32496025, -13653919, 17847801, -12669156, 3604025, 8316894, -25875034, -10437358 },
+    { 3296484, 6223048, 24680646, -12246460, -23052020, 5903205, -8862297, -4639164, 12376617, 3188849 }
+  },
+  {
+    { 17296638, 780909, 21844480, 1934604, -28018544, -14365979, -26616478, 11880703, -1115508, 2027157 },
+    { -23584125, 15911808, 11574391, 10424501, -31146037, -62594, 31920545, -1724617, 16711674, 4124580 },
+    { 23743348, -2403564, -32480914, -7652749, 13297745, 1335568, -9836495, 4925985, -29347163, -11063940 }
+  },
+  {
+    { 11147722, 11314911, 3355084, -4036110, -26193748, 15008629, 32383854, -5286168, 29132241, -13964545 },
+    { 6154618, 12714019, -30990643, -10586981, -7933783, 9817885, -20069891, -12145040, -17129292, -6650685 },
+    { 14482931, 12128407, 218547, -2704432, -4670365, 16745236, -22919619, 1873104, -5505714, -9118365 }
+  },
+  {
+    { -24509315, 9841588, -16615120, -5243643, -28819075, -560585, 20998503, 6809766, -23527876, 9877156 },
+    { 29060853, 6488951, 16991721, -961615, -30788396, -13869599, 15650073, -10850093, 8549423, 4803399 },
+    { -30110401, -16588592, -29597868, -16395199, 25199716, 6159962, -25320082, -361117, -6382094, -16235746 }
+  },
+  {
+    { 29190488, -14659046, 27549113, -1183516, 3520066, -10697301, 32049515, -7309113, -16109234, -9852307 },
+    { -14744486, -9309156, 735818, -598978, -20407687, -5057904, 25246078, -15795669, 18640741, -960977 },
+    { -6928835, -16430795, 10361374, 5642961, 4910474, 12345252, -31638386, -494430, 10530747, 1053335 }
+  },
+  {
+    { 23000366, 50860, 20712085, 7163919, 21806384, 1254552, -1415187, 9361080, 25139581, -570800 },
+    { 7476509, -5916265, 13646109, 5015799, 32979280, 12023074, -29281926, 14930217, -3068577, 8497493 },
+    { 25862729, 12429079, 16117625, 4038555, -16856495, -13144694, -11548949, -6450467, 8834488, -14687553 }
+  },
+  {
+    { -13241385, -12533569, 11941897, -2189936, 5605667, -14759138, 12913296, 2426174, 10948731, -4365096 },
+    { 8094601, -11259838, -24522630, 16222245, -743918, 10307728, -13821675, 2069754, -20688122, 3888516 },
+    { -18231972, 15478811, 32964717, -13141441, -1574144, 12118301, -29255919, -14053330, -22244524, 14655246 }
+  },
+  {
+    { 28703429, -10309782, -15750271, 12196233, -19092830, -9092670, 20946008, -11988684, -20646363, -10193975 },
+    { 6705071, 7087511, -27643882, -16038721, -4990431, -3811454, 12097637, 12412739, 6123734, 2762379 },
+    { 10025899, 3936505, -21192464, -14845349, -1241024, -15533606, -22114207, -13284116, 16691797, -16190366 }
+  },
+  {
+    { -29265967, -14186805, -13538216, -12117373, -19457059, -10655384, -31462369, -2948985, 24018831, 15026644 },
+    { -22592535, -3145277, -2289276, 5953843, -13440189, 9425631, 25310643, 13003497, -2314791, -15145616 },
+    { -27419985, -603321, -8043984, -1669117, -26092265, 13987819, -27297622, 187899, -23166419, -2531735 }
+  },
+  {
+    { 16610038, 15639351, -13245915, 6045636, 25187847, 12290810, -4731180, 10404441, -11767561, -216174 },
+    { -859781, -1162170, -25704266, -13202206, 7293701, 10981365, 1993080, 15980565, -28172962, 5422449 },
+    { -5022751, 2319483, -10174374, -6777734, -13774794, 3324871, 9930015, 6975560, -2181959, 14842495 }
+  },
+  {
+    { 8812340, 12860015, -19871313, 9274103, -20188739, 254430, 24098389, -5393370, -9236745, 5681448 },
+    { 16394842, -10315047, -18674424, -14971991, -3458117, 8394754, 7620056, 534935, -7925574, -15993780 },
+    { -18347813, -500770, 11411006, -861708, -31186382, 16479396, 1229499, -7712512, -21178419, 8166934 }
+  },
+  {
+    { -20536911, 3413305, 2178835, -13970167, 11377952, -12709255, 18974670, 302196, -6384509, -8070910 },
+    { 2691926, 422737, 8874018, -2543294, 30218759, 2928198, 31385119, 999573, 16303550, 2726235 },
+    { 6657514, -2705190, 24488691, -6525232, 2847173, 15485382, 7710391, -3119134, 33520892, 14060871 }
+  },
+  {
+    { -21744398, -13810475, 1844840, 5021428, -10434399, -15911473, 9716667, 16266922, -5070217, 726099 },
+    { 29370922, -6053998, 7334071, -15342259, 9385287, 2247707, -13661962, -4839461, 30007388, -15823341 },
+    { -936379, 16086691, 23751945, -543318, -1167538, -5189036, 9137109, 730663, 9835848, 4555336 }
+  }
+},
+{ /* 8/25 */
+  {
+    { 12015105, 2801261, 28198131, 10151021, 24818120, -4743133, -11194191, -5645734, 5150968, 7274186 },
+    { 2831366, -12492146, 1478975, 6122054, 23825128, -12733586, 31097299, 6083058, 31021603, -9793610 },
+    { -2529932, -2229646, 445613, 10720828, -13849527, -11505937, -23507731, 16354465, 15067285, -14147707 }
+  },
+  {
+    { 7840942, 14037873, -33364863, 15934016, -728213, -3642706, 21403988, 1057586, -19379462, -12403220 },
+    { 915865, -16469274, 15608285, -8789130, -24357026, 6060030, -17371319, 8410997, -7220461, 16527025 },
+    { 32922597, -556987, 20336074, -16184568, 10903705, -5384487, 16957574, 52992, 23834301, 6588044 }
+  },
+  {
+    { 32752030, 11232950, 3381995, -8714866, 22652988, -10744103, 17159699, 16689107, -20314580, -1305992 },
+    { -4689649, 9166776, -25710296, -10847306, 11576752, 12733943, 7924251, -2752281, 1976123, -7249027 },
+    { 21251222, 16309901, -2983015, -6783122, 30810597, 12967303, 156041, -3371252, 12331345, -8237197 }
+  },
+  {
+    { 8651614, -4477032, -16085636, -4996994, 13002507, 2950805, 29054427, -5106970, 10008136, -4667901 },
+    { 31486080, 15114593, -14261250, 12951354, 14369431, -7387845, 16347321, -13662089, 8684155, -10532952 },
+    { 19443825, 11385320, 24468943, -9659068, -23919258, 2187569, -26263207, -6086921, 31316348, 14219878 }
+  },
+  {
+    { -28594490, 1193785, 32245219, 11392485, 31092169, 15722801, 27146014, 6992409, 29126555, 9207390 },
+    { 32382935, 1110093, 18477781, 11028262, -27411763, -7548111, -4980517, 10843782, -7957600, -14435730 },
+    { 2814918, 7836403, 27519878, -7868156, -20894015, -11553689, -21494559, 8550130, 28346258, 1994730 }
+  },
+  {
+    { -19578299, 8085545, -14000519, -3948622, 2785838, -16231307, -19516951, 7174894, 22628102, 8115180 },
+    { -30405132, 955511, -11133838, -15078069, -32447087, -13278079, -25651578, 3317160, -9943017, 930272 },
+    { -15303681, -6833769, 28856490, 1357446, 23421993, 1057177, 24091212, -1388970, -22765376, -10650715 }
+  },
+  {
+    { -22751231, -5303997, -12907607, -12768866, -15811511, -7797053, -14839018, -16554220, -1867018, 8398970 },
+    { -31969310, 2106403, -4736360, 1362501, 12813763, 16200670, 22981545, -6291273, 18009408, -15772772 },
+    { -17220923, -9545221, -27784654, 14166835, 29815394, 7444469, 29551787, -3727419, 19288549, 1325865 }
+  },
+  {
+    { 15100157, -15835752, -23923978, -1005098, -26450192, 15509408, 12376730, -3479146, 33166107, -8042750 },
+    { 20909231, 13023121, -9209752, 16251778, -5778415, -8094914, 12412151, 10018715, 2213263, -13878373 },
+    { 32529814, -11074689, 30361439, -16689753, -9135940, 1513226, 22922121, 6382134, -5766928, 8371348 }
+  },
+  {
+    { -16515239, 6451019, 31507083, 4332819, -33349349, 9350252, -8772794, 12290633, -26680430, 14645399 },
+    { -29200239, 5265404, -32024541, -3874059, -19735057, 7918453, 22216228, 9812801, 11243093, -201486 },
+    { 24242833, -5871366, 12737683, -7107135, -28452610, -12933275, -23526274, -4514964, 2106417, -16513350 }
+  },
+  {
+    { 1792751, -7600555, 14367867, -3148440, 14332423, 14812948, -4397435, -7463918, 24017565, -14345816 },
+    { -15116870, -12359479, 12903923, 14483699, 9212942, 8538584, -28566466, 13691904, -20564568, 5478553 },
+    { 26966131, 1535286, 12725537, -6080689, 25637686, 15899166, 1507604, -15517567, 9682699, 1772795 }
+  },
+  {
+    { -12622164, -3886464, 20086897, 12735442, -23304391, -14548580, -15614743, -12051326, 23516862, -7862710 },
+    { -16181489, 7839148, 11850892, -9919039, -8506808, -9640042, -390384, -3047267, 28707025, -2430302 },
+    { 23611124, 13236149, 6157260, -5841803, 28598277, 10645329, -7748027, 861594, 13526892, 5277730 }
+  },
+  {
+    { -29389482, -8845040, -4225500, -11286722, 13340070, -4921762, -1248169, 11884965, 5686126, 3330105 },
+    { -20252650, -10479602, 31608063, 16000234, -7646205, -10735245, 3242114, 13744167, 27606535, -6077110 },
+    { -31134112, -14320517, 12081570, -9703797, -26146736, 11694318, -27910117, 6306238, -25658934, 6842388 }
+  },
+  {
+    { 26242700, -546854, -2971931, -3795888, -31495669, -14941140, -23480770, 6930636, -24702940, -14283588 },
+    { -27283403, -16069328, -1406216, 10974063, -32403998, -5412747, -23861931, 1114519, 31304776, 11262106 },
+    { -8273624, 13126357, -27791982, 9531796, 12205582, 2984296, -1864743, 4428618, 30803485, -9110265 }
+  },
+  {
+    { -1795304, 9814429, -33303036, -11707965, 29886347, -12364730, -2004136, -1821413, 17587560, -12050754 },
+    { 22124883, -7140642, -11074008, 4837032, -24481385, -649812, 31001574, -5631853, 2558386, -6009887 },
+    { -16213003, -10716106, 17069342, -4370547, -28195846, 1664721, -17161121, -8090608, -5880004, -14091799 }
+  },
+  {
+    { -29913252, -3164571, 20174689, 11791987, -13036076, -13218564, 19335233, 15367612, 9072649, 16740406 },
+    { -9359736, -9581442, 17890629, -316332, 29569149, 11800309, 29478370, 5913429, -32254849, -4490275 },
+    { -28609106, 11400069, 551906, 6729680, -3504507, 236709, 20720982, 11436838, -10399896, 11444928 }
+  },
+  {
+    { 1466931, 6920868, 81906, -9248881, -3631797, -7282819, -4002752, -577600, -2046153, -12744640 },
+    { -9673188, -8089957, -14215533, 2884955, -23247878, -4031904, 14654684, -14180722, 15170242, -12458993 },
+    { -2212300, 4413816, -676769, 9818067, -12803306, 1459473, 3636451, -7302343, 4498007, 9916704 }
+  }
+},
+{ /* 9/25 */
+  {
+    { 23838809, 1822728, -15738443, 15242727, 8318092, -3733104, -21672180, -3492205, -4821741, 14799921 },
+    { 13345610, 9759151, 3371034, -16137791, 16353039, 8577942, 31129804, 13496856, -9056018, 7402518 },
+    { 2286874, -4435931, -20042458, -2008336, -13696227, 5038122, 11006906, -15760352, 8205061, 1607563 }
+  },
+  {
+    { -4283307, 5368523, -31117018, 8163389, -30323063, 3209128, 16557151, 8890729, 8840445, 4957760 },
+    { -15447727, 709327, -6919446, -10870178, -29777922, 6522332, -21720181, 12130072, -14796503, 5005757 },
+    { -2114751, -14308128, 23019042, 15765735, -25269683, 6002752, 10183197, -13239326, -16395286, -2176112 }
+  },
+  {
+    { -18316774, -15480288, -28069362, -3360196, -29775698, -15731393, 12916849, -13215678, -28714484, 11439936 },
+    { -20788461, -11369289, -24368307, 522913, -28036423, 12241782, -27105971, 3595873, -23681849, -11663902 },
+    { 16404041, -3535778, -27311072, -9601854, 8973272, -5912499, 24052682, -762501, 10597938, 14712498 }
+  },
+  {
+    { 6083246, 12395507, -20041050, -713102, 11444551, -15587007, 23416873, 10372699, 26431488, -14797209 },
+    { 15803991, -10657305, 29704098, 10955216, -6242370, -4502552, -28051410, -15443577, -14004028, 2921542 },
+    { 12255955, 11948580, -31284309, -7834093, 21202979, 15865602, 17908903, -16731059, -12339931, -13163379 }
+  },
+  {
+    { -19234360, -9372767, -24223524, 13635188, -20466564, -4794700, -2113497, 4635109, -33414046, 2526380 },
+    { 27872793, 4278863, -7551330, -6229230, -31016676, -4814746, 17041096, -15730725, -12891312, -2800164 },
+    { -14960500, -10437731, -32027285, -4526899, -15735181, -13994233, -10136787, 3142735, -33240852, -2884954 }
+  },
+  {
+    { -612041, 2116917, -4837519, -13102446, -10458763, -1243850, -13710764, -1881587, -25842288, -11545880 },
+    { -22014229, 11703879, 19833672, -7555572, -7296253, 16074808, 12841177, 13983296, 15557782, -15474201 },
+    { -31089022, 14691109, -6061582, -13692870, 16228498, -877623, -28007803, -6126563, 25334131, 6402897 }
+  },
+  {
+    { -18536157, -14997709, 3994238, -9668171, 7655623, -2153492, 4747420, -7369843, -6354815, 1612651 },
+    { 14582695, 13299034, 29424201, -14437677, -14250945, 4298790, -18419028, -15776795, 9897732, 4913912 },
+    { -24538434, 14358512, 17689949, 4144444, 19491822, -5189567, -16628378, 14577998, -1830958, 8692661 }
+  },
+  {
+    { -9680504, 16317181, 2402138, -14042063, -10652521, 2467095, 30023376, -16188146, -11779811, -5312013 },
+    { -8354103, 10686468, 28908656, -4408072, 16637852, -774988, -9496537, 15765471, -3446083, -11954714 },
+    { 10816854, -1624971, 24102798, -4311051, -19361534, -8349905, 14656539, -6328833, 3879723, 56674 }
+  },
+  {
+    { 14917733, -11136022, 9683801, 6965216, 28513386, 5248491, 5542191, -14042491, -8452276, -5056251 },
+    { -21019443, 1319250, -24046298, -14270302, -15082604, 4464332, 7698714, 903952, 5151297, -6914384 },
+    { 30915516, -8084834, -7348270, 8454987, -22501978, -3812460, 21736926, -5111909, 14813936, -15461499 }
+  },
+  {
+    { -11667681, 15547184, 9001346, -3108210, 15974747, -8234038, 31291306, 4698873, 22954137, 350166 },
+    { 1469431, 11700556, 20569887, 1966347, 3300264, 6273443, 32715875, -12468894, -23537299, 3861945 },
+    { 32349549, 4460138, -26832353, -4139669, 25331201, 5130025, -26583158, -10883265, -22778675, 14575443 }
+  },
+  {
+    { 6557463, -2697993, 7261485, -10267853, -1359321, -9378913, -27620459, -16028299, 8626977, -9313455 },
+    { -5870110, -14942617, 24644525, -8186875, 15406401, -15374260, -22262274, -7299842, -6048467, 6554257 },
+    { 7562511, -10927353, 16550758, 4969423, 16975639, -10220945, -11398739, 2939640, 7848305, 193706 }
+  },
+  {
+    { 7719343, 16458075, -6383311, 1818, -7272941, 9467445, -4862499, -12918451, -11067592, -6653773 },
+    { 13306195, 7123786, 10035200, -16549663, 26209607, 14010929, -20756242, 13375158, -2571184, -6517193 },
+    { 10212123, 5954793, -28059294, -10937196, 617142, -11150927, 10452256, -8964465, -32242055, -3505130 }
+  },
+  {
+    { -8509474, 10030479, 14509958, 3928559, 6935624, 9964460, -29649664, -106849, -2764546, 12871624 },
+    { 27776277, 419107, 21602915, -13868438, -9578678, -5899289, 24969040, -9072546, 19060721, 2924775 },
+    { 2590466, 2101080, -10230367, 11102159, 23767486, -4748594, 3504392, -428582, 14158821, 4502206 }
+  },
+  {
+    { -17451494, -5348306, -4368578, 3348574, 1103956, 13216354, -25128787, 2054191, -10409059, -2295243 },
+    { 18459759, -14015646, -751198, 9029388, -31633434, 654118, 13283051, 241977, -12967746, -12993779 },
+    { 1014286, -2043151, -23256133, -7615707, -26599218, -14267104, -30008002, -1323058, 10550311, 1001033 }
+  },
+  {
+    { 33500422, -2286432, 9154062, -14655698, -6419729, 14445458, -27470109, 16161060, 10263721, 5168537 },
+    { -13717551, 13458841, 4129737, -1846667, -14099836, -4687154, -31767375, -12687116, -3252241, -4535209 },
+    { 19966949, -9508469, -12557168, 6350384, -13362568, -218126, 17977628, 3789270, 21237562, -461352 }
+  },
+  {
+    { -18545207, -11910535, -28966478, -10616503, -27055645, -5168344, -5589803, -9900290, -4713414, -926170 },
+    { 13182109, -6272313, -1371049, -9369335, 25827772, -979250, -18686929, -4192873, 27141691, 957129 },
+    { -30204747, 7174328, 8658488, 7385061, 23756150, -2542927, -31688514, 14480373, -16660972, 11067504 }
+  }
+},
+{ /* 10/25 */
+  {
+    { -30587084, -4629784, -20009115, -10744271, -15524787, 10280576, -28667146, 7716332, 24015220, 15147052 },
+    { -5646697, -13269764, -13947040, -14622668, 3346795, -337258, -1015199, 7124142, 4664896, 15322844 },
+    { -8229784, 5997383, 8085987, -15578361, -2326588, -4766867, 25901074, 5262370, 25656743, 3392425 }
+  },
+  {
+    { -5860243, 11777295, 769126, -15776754, -8901554, 6810940, -33061713, -5528741, 28019812, -9002317 },
+    { 30723280, -14669513, -5004498, 15511447, 9149397, 14075675, -15080544, 8780012, -6507584, -1125302 },
+    { -26208846, -6712689, 29530263, 7885954, 30958908, 617491, 10886354, -6441812, 17398271, -5028867 }
+  },
+  {
+    { 4956577, -12669076, -6361090, -1974546, -12324368, -8776931, -22792445, -11783036, 18817572, -7313138 },
+    { -12310337, 1702372, -21202916, -8048502, 5377387, 403765, -24479332, 9674308, 9302088, -7454061 },
+    { -33117989, -5351766, 12466361, 16089921, -29020674, 16555776, 26195362, -6322866, 5646086, 12810190 }
+  },
+  {
+    { 12375359, -4411558, 31344248, -8172991, -15128721, -3466513, -8976863, 16561847, -26205910, -9394891 },
+    { 29358073, -9242956, -18683448, 1114915, -14399942, -15164073, -26780152, 13440858, -23247769, 7151756 },
+    { 22427521, -8216631, -13953689, 5390460, 9717898, -15420189, -24996943, -3843860, -27420816, 8959577 }
+  },
+  {
+    { -30126184, -13656189, 25625075, 6569873, -5456214, 14774032, 15970087, -4369508, 21072393, -15754951 },
+    { -9261855, 6283629, -1899634, -11914810, -33141702, -4158631, -27884874, -97164, 29917072, 2936988 },
+    { -30028170, -8874873, 5361707, 7325840, -17285067, -8528659, 392275, 14456831, 9885372, -10694473 }
+  },
+  {
+    { -26182647, 15674824, 15490680, 6526093, 13923950, 14064179, 1521517, 1040394, 32631944, -12010168 },
+    { 13523352, -4449934, 22306302, 8760927, -17036716, 12043353, -28278000, -16076403, -14476251, 13913407 },
+    { 27496510, -16264770, -8813338, -4404436, -14389617, -7726065, 10852392, 3110348, 24164752, -1314133 }
+  },
+  {
+    { -8115330, 5274428, 14202128, 3980639, 22519493, -8892418, -28849278, 1503631, -8717104, -9616760 },
+    { 12107329, -8694487, 6010956, -16196217, -29313968, -1561933, -31909401, 16345151, -27510098, 4331499 },
+    { 20321045, -16524868, 8205169, 1278080, 6363273, 10637440, -22872718, 6556862, -7078489, 2662793 }
+  },
+  {
+    { -20210390, -6496548, 22819522, 4633575, -1324763, -10609782, -2827669, -12753155, -3455290, -9249699 },
+    { 8174749, 12907021, 7366869, 10800649, 14755747, -2733367, 18391108, -2299491, -11855318, 8180997 },
+    { -21517309, 7971553, -17356463, -12788426, -3116187, -7501968, -10418063, -13057315, 16249265, -871572 }
+  },
+  {
+    { -32947452, 13000135, 33143473, 15163714, -28379906, -228337, 23898400, -3389174, 7251979, 9640815 },
+    { 793741, -2102370, -6747559, 16138876, -4943332, -14056571, -7503845, 6462, -26274334, -12045047 },
+    { -1505900, -15079632, 19336107, -7706505, 26498272, -9055238, 22018648, 12500772, -10570238, -1292196 }
+  },
+  {
+    { -13504904, 5912465, 16758065, -12110999, -21274301, -2521299, -24238724, 4662443, -18073122, -13489718 },
+    { 2872923, 3219672, -8741158, 6714954, -15691911, -16333096, 5803453, -10411484, 27867824, -6310242 },
+    { -3134328, -4062806, 30545427, 10696074, -17184076, -2202215, 26604862, -10291849, 19116491, -1410859 }
+  },
+  {
+    { -7632140, -6602064, 5060300, 7391028, -18620011, -9809338, 6305839, -4883334, 31909493, 194500 },
+    { -17459798, -4864110, 21859477, 13826557, 2636180, 6091646, 15706685, -16098975, -29459618, -10248569 },
+    { 3982473, -7221251, -18876593, 12452547, 12022982, 3004021, -7192997, -4051505, 13422114, -12054880 }
+  },
+  {
+    { -22590042, 1919892, 25447074, -5266273, 2187698, 14977524, 14846029, -7211937, 24051312, 5026737 },
+    { 20707550, -1405233, -2152556, -2347406, -28641650, -15562210, -31752500, 5218373, -3237522, -518431 },
+    { -26265854, 16051925, 10027634, 9050638, -24267620, -11418879, -1441088, 16006542, -28137925, 15244680 }
+  },
+  {
+    { -3447633, 3599518, 7348220, 3163230, -983758, -4748979, 14222700, -5535145, 5471649, 2475346 },
+    { 8419476, -14167967, 16248930, 8109629, 6375916, 7561252, 18371405, -13733749, 15480997, 8940209 },
+    { 1642164, -14414991, -22760173, -3676214, -6669169, 3419726, 7257886, -9075258, -1729647, -9762454 }
+  },
+  {
+    { 12569299, -15093697, 3520502, 7021022, 14843286, -5392332, -10760380, 5585960, 13643919, -11880124 },
+    { -13598393, -373991, -2102054, 8976415, 7064959, -2925900, -22973106, 9840623, -9585581, -910700 },
+    { 33412528, 14587507, 30535703, -9554771, -1797473, -1367618, 18236487, -429605, 20675635, -14319441 }
+  },
+  {
+    { 6592880, 13175957, -13201712, 14063443, 23404307, 1679364, -21722260, 14579163, -28580832, -2439411 },
+    { -12961463, -4026361, 3388303, 3821391, -9520560, -16149080, -27209991, -14128345, -17777214, -3101057 },
+    { -457290, 4764706, -27175759, -2587705, -30278271, -12965437, -17424110, -1734125, 13515911, -15413467 }
+  },
+  {
+    { 12962541, 5311799, -10060768, 11658280, 18855286, -7954201, 13286263, -12808704, -4381056, 9882022 },
+    { 18512079, 11319350, -20123124, 15090309, 18818594, 5271736, -22727904, 3666879, -23967430, -3299429 },
+    { -6789020, -3146043, 16192429, 13241070, 15898607, -14206114, -10084880, -6661110, -2403099, 5276065 }
+  }
+},
+{ /* 11/25 */
+  {
+    { 19073494, -4037188, -22594853, 3100191, -9442162, -11197422, -16689028, -4093733, 5601348, 10233900 },
+    { 6033336, 9711222, 19885731, -13869448, -12140687, -16144022, -11316798, 13313507, 32398080, 5470206 },
+    { -7984180, -4091862, 25152576, 13826189, -33084670, -3069252, -4095445, -15830519, -31898193, 6722296 }
+  },
+  {
+    { -24476149, -13841201, -5563725, 5192812, 20614618, 9319711, -3169617, -9007496, 19645471, -11264161 },
+    { -15448412, -12956327, 8297361, -16338695, 26001315, 11118805, 20972297, -15046251, -6231662, -14424208 },
+    { 26571535, 13254858, -31603811, -15423465, 32650027, -3348869, -3007991, 3994168, 26626691, -10612448 }
+  },
+  {
+    { -16018211, 319257, 7021686, -15328656, -25422132, -9940820, 2337136, -3421302, -25677495, -13084288 },
+    { 31112278, 12898762, -20090742, -15525725, -20558313, 6730956, 33270733, 815022, -19017024, 16368401 },
+    { 30782267, 13607481, 30927192, -3724204, 26318064, 13157281, 17546828, 4467462, 14433068, -7834329 }
+  },
+  {
+    { -2244452, -754728, -4597030, -1066309, -6247172, 1455299, -21647728, -9214789, -5222701, 12650267 },
+    { -9906797, -16070310, 21134160, 12198166, -27064575, 708126, 387813, 13770293, -19134326, 10958663 },
+    { 22470984, 12369526, 23446014, -5441109, -21520802, -9698723, -11772496, -11574455, -25083830, 4271862 }
+  },
+  {
+    { 25571127, -5973985, 30041809, -8447599, 18688614, 601798, -12011510, -3658248, 7051663, -15922570 },
+    { -22780671, 6963996, 2424355, 16092707, -12885540, -14339656, 19395448, -16582077, 3098011, -2409879 },
+    { -6185605, -2575726, 26306600, 6211099, -13341400, -6625518, 32591885, -6298428, 30631670, 16464263 }
+  },
+  {
+    { 21224834, 13940273, -10557586, -15567660, -5918630, -3343459, -9628714, 13004579, 20459409, -4957543 },
+    { 28703190, 14517095, -31180693, -7973421, 26305586, -570359, -20624991, 9504946, -27344281, -3063413 },
+    { -19923884, -5897464, -2046418, 4130469, -14757201, 8162914, -18799644, -4803589, 27970390, -2138711 }
+  },
+  {
+    { 37789, -873740, -2943662, -727197, 4785088, 12373847, -28641107, 16726163, 31107600, -13314555 },
+    { -18432352, -8015697, -3311537, -11413231, -18384795, -1421508, 4304964, 14270237, 14187637, 9991613 },
+    { 14853374, 15813460, -20085261, 2491200, -24420472, 13052982, 18400987, 6087335, -12585806, -13217916 }
+  },
+  {
+    { -25169565, -10053642, -19909332, 15361595, -5984358, 2159192, 75375, -4278529, -32526221, 8469673 },
+    { 15854970, 4148314, -8893890, 7259002, 11666551, 13824734, -30531198, 2697372, 24154791, -9460943 },
+    { 15446137, -15806644, 29759747, 14019369, 30811221, -9610191, -31582008, 12840104, 24913809, 9815020 }
+  },
+  {
+    { 641396, 10524828, 21368180, 13457590, 5561279, -5076612, -29851909, 5443549, -9023691, -12541512 },
+    { -9478184, 16650100, 26321143, -3860606, -1216358, -9368476, 10447898, -11750303, 31496417, 4930733 },
+    { -30171790, -13615861, -22383584, 2921009, -27916455, 14953012, -6291358, 6380156, -15050576, 2577870 }
+  },
+  {
+    { -26352017, -10679244, -22783520, 3217855, -23911955, -9261213, 7883176, -15092141, -22013755, -2250794 },
+    { 17686040, -8709481, 25154489, 9674801, -24016313, 15169893, 4075961, 6724552, -5831348, -4813848 },
+    { -6826331, 5676773, -29041524, -1094661, 31957433, 11069627, 31462873, -5072714, 8407082, 14864040 }
+  },
+  {
+    { 25435633, -9132020, 18858410, 15386898, 20654587, 885960, -732275, 11540202, -19349035, 9725890 },
+    { -8465958, 14702931, -22393297, 7754725, 12302396, 8178093, -21817440, -11727266, -13411133, 7965962 },
+    { 21909566, 6139948, -20835584, -3544788, 26257179, 10567795, 4571641, -15827879, 14933578, 2030007 }
+  },
+  {
+    { -4709286, -5614269, -31841498, -12288893, -14443537, 10799414, -9103676, 13438769, 18735128, 9466238 },
+    { 11933045, 9281483, 5081055, -5183824, -2628162, -4905629, -7727821, -10896103, -22728655, 16199064 },
+    { 14576810, 379472, -26786533, -8317236, -29426508, -10812974, -102766, 1876699, 30801119, 2164795 }
+  },
+  {
+    { -9796050, 7325542, -9094704, -7515764, -31758711, 3114024, -11354228, -12058104, -15600714, 1510067 },
+    { 28977892, -15825945, 3482267, 11153228, 11080576, -15240228, 13465337, 12377327, -23351334, 11889648 },
+    { -21066088, -160301, 32373155, 7700663, 20323030, 9029603, 15430317, -15787744, -30090796, 12127338 }
+  },
+  {
+    { -18068761, 4434245, 8956995, -16098194, -13310796, -14589927, -6617189, 1001343, 29300674, 12432123 },
+    { 21593519, 14818090, -6096110, 9642383, 7370068, -2558891, -28476948, -2865282, -31888456, -2559733 },
+    { 22881314, -3437057, 32547148, 10060717, -6506174, -7987888, -26311530, -836599, -11482389, -11126440 }
+  },
+  {
+    { 25524213, 12106105, 2479170, -13291944, 13111215, -9021711, 16244605, -13766081, -552296, -14813810 },
+    { -25657646, -4321809, 5233227, 16335509, 13626752, 13795111, -13177618, 5275415, 33441011, 10190019 },
+    { 18149106, 8245975, 7168399, -98292, 18644547, -7822651, -26265789, -14642687, 27447709, -15465443 }
+  },
+  {
+    { 15995086, 3199873, 13672555, 13712240, -19378835, -4647646, -13081610, -15496269, -13492807, 1268052 },
+    { -10290614, -3659039, -3286592, 10948818, 23037027, 3794475, -3470338, -12600221, -17055369, 3565904 },
+    { 29210088, -9419337, -5919792, -4952785, 10834811, -13327726, -16512102, -10820713, -27162222, -14030531 }
+  }
+},
+{ /* 12/25 */
+  {
+    { -8858980, -2219056, 28571666, -10155518, -474467, -10105698, -3801496, 278095, 23440562, -290208 },
+    { 10226241, -5928702, 15139956, 120818, -14867693, 5218603, 32937275, 11551483, -16571960, -7442864 },
+    { 17932739, -12437276, -24039557, 10749060, 11316803, 7535897, 22503767, 5561594, -3646624, 3898661 }
+  },
+  {
+    { 7749907, -969567, -16339731, -16464, -25018111, 15122143, -1573531, 7152530, 21831162, 1245233 },
+    { 26958459, -14658026, 4314586, 8346991, -5677764, 11960072, -32589295, -620035, -30402091, -16716212 },
+    { -12165896, 9166947, 33491384, 13673479, 29787085, 13096535, 6280834, 14587357, -22338025, 13987525 }
+  },
+  {
+    { -24349909, 7778775, 21116000, 15572597, -4833266, -5357778, -4300898, -5124639, -7469781, -2858068 },
+    { 9681908, -6737123, -31951644, 13591838, -6883821, 386950, 31622781, 6439245, -14581012, 4091397 },
+    { -8426427, 1470727, -28109679, -1596990, 3978627, -5123623, -19622683, 12092163, 29077877, -14741988 }
+  },
+  {
+    { 5269168, -6859726, -13230211, -8020715, 25932563, 1763552, -5606110, -5505881, -20017847, 2357889 },
+    { 32264008, -15407652, -5387735, -1160093, -2091322, -3946900, 23104804, -12869908, 5727338, 189038 },
+    { 14609123, -8954470, -6000566, -16622781, -14577387, -7743898, -26745169, 10942115, -25888931, -14884697 }
+  },
+  {
+    { 20513500, 5557931, -15604613, 7829531, 26413943, -2019404, -21378968, 7471781, 13913677, -5137875 },
+    { -25574376, 11967826, 29233242, 12948236, -6754465, 4713227, -8940970, 14059180, 12878652, 8511905 },
+    { -25656801, 3393631, -2955415, -7075526, -2250709, 9366908, -30223418, 6812974, 5568676, -3127656 }
+  },
+  {
+    { 11630004, 12144454, 2116339, 13606037, 27378885, 15676917, -17408753, -13504373, -14395196, 8070818 },
+    { 27117696, -10007378, -31282771, -5570088, 1127282, 12772488, -29845906, 10483306, -11552749, -1028714 },
+    { 10637467, -5688064, 5674781, 1072708, -26343588, -6982302, -1683975, 9177853, -27493162, 15431203 }
+  },
+  {
+    { 20525145, 10892566, -12742472, 12779443, -29493034, 16150075, -28240519, 14943142, -15056790, -7935931 },
+    { -30024462, 5626926, -551567, -9981087, 753598, 11981191, 25244767, -3239766, -3356550, 9594024 },
+    { -23752644, 2636870, -5163910, -10103818, 585134, 7877383, 11345683, -6492290, 13352335, -10977084 }
+  },
+  {
+    { -1931799, -5407458, 3304649, -12884869, 17015806, -4877091, -29783850, -7752482, -13215537, -319204 },
+    { 20239939, 6607058, 6203985, 3483793, -18386976, -779229, -20723742, 15077870, -22750759, 14523817 },
+    { 27406042, -6041657, 27423596, -4497394, 4996214, 10002360, -28842031, -4545494, -30172742, -4805667 }
+  },
+  {
+    { -11025030, 5682633, 9525392, 1810759, -23289593, -4124447, -14871726, -14478176, 24745792, 14938388 },
+    { 3334667, -3664312, 31850349, 1244239, -24197536, -1859222, -7234392, 405074, -5912446, 8710770 },
+    { -12802819, -5299988, -77855, -16695987, 31759716, -6265070, -5276900, -14730428, 1043880, 2282289 }
+  },
+  {
+    { 28901759, 9299043, 10998926, 5323889, -15565908, 14448111, -4949695, -13726216, -30032796, -6301316 },
+    { 8796148, 7605546, -9811829, 12493901, -19438571, -16339479, 25773503, 7301419, -3787887, -16169478 },
+    { -23631515, 1274400, 30630226, -16481525, 21113936, 4036738, 9601133, -7008001, -20890739, -3767219 }
+  },
+  {
+    { 27319357, 9721936, -4613620, -3520173, -18188719, -3836506, -4305265, -1178316, -7886746, 8982528 },
+    { 9356198, -3029177, 32881215, 1736171, 26179939, 5378740, 23110079, 11924862, 18766836, 3024186 },
+    { -31652542, -1850137, 12716638, -686502, 16589913, -5993910, 26064585, -7452876, -31644762, -5493474 }
+  },
+  {
+    { -27516337, 11363630, 29805684, 7475890, -5029415, 15864023, 17647130, 7849763, 28825940, 12085845 },
+    { -15331312, -7654482, 5742856, 3551572, -20132646, 10594578, -23466749, -2271701, 11317560, -16017663 },
+    { 3261302, -11152494, -29874016, -3612593, -2283672, 7389447, -6935149, -5160746, 25748747, 4058888 }
+  },
+  {
+    { -7971080, -6272031, -778066, -10065546, -27164065, -9059398, -31414655, 16468249, 6327623, 2010793 },
+    { -6675147, -14042147, 18732990, 8148450, 12884875, 3005207, 33282805, -4578570, 22900820, 11228872 },
+    { 22876448, 14837242, 19336390, -12233346, -6784375, -16080173, 23234304, -10528303, 22896767, -6758268 }
+  },
+  {
+    { -19670236, -14533720, 24645435, 4103602, 6340365, -16713684, -13121981, -14460443, -12425683, -1341846 },
+    { 21229707, 10464351, 9178926, 2730075, -27050864, 16589710, -410044, -130438, 22433863, 13650160 },
+    { 2798906, 15274624, 6649131, 651358, -17175255, -621194, -11140896, 3474004, 20185843, -12500110 }
+  },
+  {
+    { 4884566, 2924321, -29338749, 8926592, -23454530, 12348522, -8113331, -15690198, 25031751, -13292024 },
+    { -32247859, -14055639, 33352672, 624930, -22062928, 11617980, -28996776, 4667636, -14899528, 4439764 },
+    { -5600458, 8284625, -10831200, -1364515, -7902258, 3972340, 4444576, 6092792, -23379450, -1003272 }
+  },
+  {
+    { 13709443, -5310645, 30658614, -13647152, -27739891, 14679756, 29939045, 1891282, 27601955, -11772417 },
+    { 6456676, -7170684, -1668316, -1751641, 11087586, -6058429, 18004340, 9296837, 27258448, 15922863 },
+    { 12181132, -14302828, -21793544, -2222066, 16009888, -9772148, -23645078, -12877747, 3515930, -1614618 }
+  }
+},
+{ /* 13/25 */
+  {
+    { 12501286, 4044383, -8612957, -13392385, -32430052, 5136599, -19230378, -3529697, 330070, -3659409 },
+    { 6384877, 2899513, 17807477, 7663917, -2358888, 12363165, 25366522, -8573892, -271295, 12071499 },
+    { -8365515, -4042521, 25133448, -4517355, -6211027, 2265927, -32769618, 1936675, -5159697, 3829363 }
+  },
+  {
+    { -12863944, -13219986, -8318266, -11018091, -6810145, -4843894, 13475066, -3133972, 32674895, 13715045 },
+    { 11423335, -5468059, 32344216, 8962751, 24989809, 9241752, -13265253, 16086212, -28740881, -15642093 },
+    { -1409668, 12530728, -6368726, 10847387, 19531186, -14132160, -11709148, 7791794, -27245943, 4383347 }
+  },
+  {
+    { 14843095, 12054424, -13249219, 7986432, 18903413, 8358874, 20873056, 12776186, -20109207, 13745159 },
+    { -13562002, 8931376, 32098917, 12651175, -6578092, -3706611, 19323217, -5017573, 18377290, 2820170 },
+    { 11538533, -4193833, 14048017, -5434360, 17351142, -1952916, 5655584, -5429011, -16765376, 2474768 }
+  },
+  {
+    { 30624416, -13126242, -25953584, 418414, -13619589, -10675952, -19780750, -133977, -22060553, 12064616 },
+    { -10199003, 9477007, 10089317, 8504039, 13126086, -9573819, -25173649, -3230644, 17558158, 1638976 },
+    { -31724711, -1833290, 16865417, -1626396, 26770535, -3512281, 2769244, -1784691, 13565448, 10809822 }
+  },
+  {
+    { 24089433, -7417630, -30794289, -12505712, -26212751, 5902416, -9857533, 566304, -14671484, -9327844 },
+    { -5647902, -11264529, 16505867, 9968507, 21624609, -2772525, -32175654, -3294188, 28542174, -12685975 },
+    { 3881623, -12656548, -8535941, 8084400, -11719866, -15440336, 30578201, 10582753, 15778735, 4565880 }
+  },
+  {
+    { -9398173, 5018368, 19997586, 13282789, 153811, 3571731, -7587215, -4168217, 10372476, -5059022 },
+    { 3713845, -4488198, -24023252, -1241615, 7634409, 8593439, 11309477, 7320174, -18227055, -15081090 },
+    { 19473247, -6227160, 23680490, -4698236, -8625971, 9514552, -30611024, -80348, -14955913, -1119919 }
+  },
+  {
+    { -25314427, 13975422, 16860974, 11926789, 15904771, -14688527, -16377204, 617164, -12440736, -1986488 },
+    { -18367061, 2443873, 1664298, 4731278, 305944, 14522804, 15749901, 493959, 22774229, 2141430 },
+    { 3518812, -11341710, -12173993, 6415970, -8645625, 8722162, 28345580, -7542133, -31523793, -1743638 }
+  },
+  {
+    { 18870803, -1739352, -21421351, -15365439, -13778108, -11299402, 21598286, -9834178, 16981576, -12393717 },
+    { -16346986, 2595842, 3223760, 11478824, -22323860, 1704264, 28019409, -5521154, -15652842, 1187792 },
+    { -24491659, -12385790, 26429703, 10127433, 29357889, -9451299, -5790376, 11625206, -11285062, -13888177 }
+  },
+  {
+    { -645871, -9774723, 9352012, -5027890, -15803494, -4912788, 32505997, -15503566, 4755846, -9996287 },
+    { 26469404, -7615543, -7393094, 14907562, -967568, -15907584, 33232711, -12736387, -14960213, -12535954 },
+    { -14669745, -7885691, 1957824, 10652035, -24030167, -6268802, -30571725, -9124911, 13855214, -15367707 }
+  },
+  {
+    { -15036198, -7249981, -12919532, 6944155, -4449478, -6766895, 7856874, -9088030, -4148787, 603210 },
+    { -23032350, -15919045, -21481921, -16498913, 3442190, 5329611, -15493773, -3030337, -13530605, 8505048 },
+    { 9598244, -13811679, 7009441, -7029192, -7546673, 9639252, -23199380, 10083413, -10590939, 7622661 }
+  },
+  {
+    { -6950579, 12113815, -26268980, -15176405, -20362355, -2135943, -20644649, -14214373, -28529669, 14049437 },
+    { -26054599, 11589504, 10587370, 8658397, -7574196, 8957875, 12419676, 952740, 29895159, -3800612 },
+    { 29979475, 14236855, 28240219, 2218374, 1293716, 10869584, -25838466, -797012, 12482288, -4342793 }
+  },
+  {
+    { -4107564, -12040502, -20498463, 5105880, 24840609, 7318424, 26629447, -16249919, 30739409, 1389103 },
+    { -13435015, -8441977, 32732045, 16260520, -5384278, 517639, -23775690, -14606434, 22353688, 13910451 },
+    { 30345040, 2902983, 5162772, -14827595, 19759779, -12562534, -19524886, 4538331, 31805532, -3432267 }
+  },
+  {
+    { 7715142, -2536869, -17101189, -3944983, -29806023, -13361018, 6034702, -2469604, -1376922, 6142468 },
+    { -9703473, 7532075, 29742076, -518807, -14647502, -14147486, -3222826, -4223761, -21409127, 6714128 },
+    { 8993562, -728206, 16743299, -3628464, 3123794, -3062882, 14212156, -14210723, 21258117, 2008182 }
+  },
+  {
+    { 21433, 9345223, -3433525, 610177, 12759771, -7941207, 30640141, -8644810, 21411690, 15420189 },
+    { 7469040, -2803587, -31400455, 4807392, 2099339, 15272327, -9237612, -7913265, 6075105, -10093933 },
+    { -12324625, -9797469, 13124713, 2993704, -21520787, -7384625, -21089636, -9164479, 27356476, 12375799 }
+  },
+  {
+    { 21361608, -3391169, 32558130, 2960769, -9327499, -14201530, 3453838, 7688534, 32773851, 923498 },
+    { -14259177, 10158852, 12754864, -4626572, 16858888, -2705616, -4181905, -13069106, 24726160, 11903553 },
+    { -11056011, -331901, 7295489, -4816105, 11452677, -12970075, -33399438, -11780490, 17734397, 5351152 }
+  },
+  {
+    { 24583426, 7569242, -30425061, 7038944, 17041883, 11611847, -23579122, -15980151, 23229697, 10575612 },
+    { 14173403, 14311420, 23670113, 15125454, -18068511, -2486496, -23010463, 4340309, -23753497, -1183599 },
+    { 16869553, 6557632, -33508380, 10353713, -10623105, -1372388, 24588191, 1741860, 11830688, -12306463 }
+  }
+},
+{ /* 14/25 */
+  {
+    { -7570426, -524391, 20097620, -16661414, -8606086, -5438902, -2513010, 10337285, 10198951, -1104705 },
+    { -6980636, -15417090, 2662804, -16317394, -24179607, 8716369, 17742056, 5985806, 15380671, 2812132 },
+    { 1759737, -275552, -12102669, 10734975, -32659979, -10917039, -10879009, -14934751, -8530948, 629933 }
+  },
+  {
+    { 25995253, 15321678, 20676051, -13905342, -5344615, 12928226, 26535743, 5834045, 32469870, 9220744 },
+    { -32995849, 11707082, 25397526, -10218086, -24075856, -684171, -15920372, 5550704, 12235466, -3115905 },
+    { 20957975, 5279561, 23238636, -11021873, 2228468, 5359535, -16683060, 2719281, -33251788, 1049551 }
+  },
+  {
+    { 7240454, 15271080, 11273695, 2712681, 5348885, 8032711, -7735829, -4293645, 7428075, 13241387 },
+    { -27146917, -8315473, -18688646, 12461725, 14323547, 14167305, 19720948, 14642646, -23573131, 3294684 },
+    { -13145624, 695982, 29721039, -3953268, 1212790, -3347743, 19469174, -16513750, 3686075, 3532094 }
+  },
+  {
+    { -6102612, -15517206, -15274115, -534898, 17071973, -10519397, -28251257, -10304793, -30207362, 3511881 },
+    { -32172300, -8555800, 29933543, 8070229, -4587153, -12935436, -6416931, 14179867, -14546646, 2485296 },
+    { 27907910, 15385928, -10176367, -11095850, -23393364, 13320966, -30011805, -11735988, -22462796, -56256 }
+  },
+  {
+    { 8172112, -545433, 645285, -11888318, -27963834, 13577339, 29966526, -12436792, -21004912, -5003785 },
+    { -10725063, 3964808, 25067649, 15849772, 6962365, -3729815, 11063679, 15714325, 20748469, -6921286 },
+    { -17316702, -9815740, 10896567, 9140583, -5406512, -12720840, -5719565, -10454851, -32980692, -3389825 }
+  },
+  {
+    { 32798541, -9546936, -18551031, -10238786, -16938042, 5657132, 2875422, 4345059, 19486241, 15948449 },
+    { -940853, 304405, -17760858, 5130154, -17590137, 12511162, 26577308, 5349209, 11135620, 12621286 },
+    { -18044519, -13130609, 2484222, 202566, -17389204, 9997023, 13565515, 445687, -24828319, 16599809 }
+  },
+  {
+    { -20703546, 3139196, -20041141, 12406424, -21878464, 14591148, -22751861, 11349075, 29986961, 1524641 },
+    { -32288295, 11084683, -25493507, 10998779, 10586397, -8200719, 30732987, -7659157, 12216683, -8191935 },
+    { -23282025, -8910792, 32407716, 11905118, -1564687, -15605914, -25800824, -3561742, -23414418, 14292210 }
+  },
+  {
+    { -20584495, 15739967, -6829946, 2777159, 29961914, 9932699, 19292707, -451010, -19519450, -14144514 },
+    { 15964992, 7223198, -12744997, -7519682, 33360822, -4374562, -26678467, -3316604, -20369475, -5652160 },
+    { 17388308, -71784, -27321053, 10491141, -16512130, 6691084, 15825661, -3737631, -1176112, -6274009 }
+  },
+  {
+    { -2237861, 11927939, -26760468, 10020, -6525174, 2716204, -7731368, 6273350, 11082172, 5231661 },
+    { -9128308, 13990339, 22973692, -485471, 5989278, 7671110, 7495423, -11381135, 24255760, -3789653 },
+    { 29610480, -1596339, 25810156, 8089313, -29462764, -16341970, -26854287, -12622283, -24329099, 3580658 }
+  },
+  {
+    { 4051816, -14074016, -22331714, 11688225, -8901927, -7913251, -19553769, -5062204, -25404291, -3382785 },
+    { 8151704, 9205666, 17521223, 4921459, 11298819, -7084404, -23676578, 15205662, -2453788, -7820682 },
+    { 11026945, 330433, 10006680, 5592054, 32891395, -15510005, 27435628, -5191943, -27943253, 15069893 }
+  },
+  {
+    { 13736861, 11131089, -8380938, -2888802, -26441889, 9652636, 30871832, -10916755, 18927872, -6105542 },
+    { 22181393, 4393920, 17169659, -8398385, 31675704, -7983102, 24394223, 15475343, 19291340, 12064950 },
+    { 21435560, 13294936, -26731259, -5536218, 24877410, -5746784, -22244895, 8607541, 23465514, 2373828 }
+  },
+  {
+    { -1944923, 12919569, 30734257, -12450012, -19827681, -13309084, -11816616, -7255404, -14392601, -10707248 },
+    { -11964089, 1451880, 7927972, -14247679, -3059297, -14547935, -9810248, -4248712, -13755475, 8384832 },
+    { 26033805, 12538621, -10765263, 7597377, 1870144, 4707929, 18559562, 11102131, -6650109, -13915017 }
+  },
+  {
+    { 32152332, -526383, 19452709, -5494869, -18266859, -14104009, 2043844, 2420728, -28710784, 11441387 },
+    { -31944923, 10563798, 25388369, -13741698, -28515362, 3784542, 33305070, -11108317, 1579218, 3306223 },
+    { -13075977, -6879163, 11156382, -14684916, -19616141, 13766547, 22374656, -3105781, -2090020, 10823745 }
+  },
+  {
+    { 4802618, 15611045, -21672380, 15149769, 18727715, -676083, 7038874, -8396987, 4291962, -8699178 },
+    { -1118195, 5583658, 33537736, -4184316, 4081762, 15942418, -4988004, -16346650, 4521091, 3569312 },
+    { 3817807, -7065289, -581440, 5481936, -22429944, -16647995, 11755323, 2403523, 4798248, 12876271 }
+  },
+  {
+    { 3687165, -15558344, 12606146, -16077355, 12807275, -2445908, -6774543, -13292136, -16282523, -381475 },
+    { -28385782, 3979177, -15242576, 12710403, 27669440, -4455289, 13267131, 11151486, -8014887, 1628153 },
+    { 9601415, 2681644, -398339, -12173272, 2811053, -11064092, 3564545, 6929145, 14859091, -9610855 }
+  },
+  {
+    { -33256173, 4144782, -4476029, -6579123, 10770039, -7155542, -6650416, -12936300, -18319198, 10212860 },
+    { 2756081, 8598110, 7383731, -6859892, 22312759, -1105012, 21179801, 2600940, -9988298, -12506466 },
+    { -24645692, 13317462, -30449259, -15653928, 21365574, -10869657, 11344424, 864440, -2499677, -16710063 }
+  }
+},
+{ /* 15/25 */
+  {
+    { 7337550, 5873052, 10988340, 15232053, 4384079, 6032278, 7402343, -7533815, -26138751, 11939300 },
+    { -119159, -14583143, -27421804, 8942753, -17273154, 16514684, 30754115, -9596433, 33487209, 4113918 },
+    { -3960789, -9335892, 15011643, 9719616, 31254661, -16703303, 24322161, -11683727, -15224142, 2537614 }
+  },
+  {
+    { -678578, -12898735, 29248392, 15218180, -26007912, -7777208, 20041027, -345609, -25108726, -9825940 },
+    { 28422467, -8382679, 28591009, -3932530, 28651951, -196633, -20235478, -2839073, -24371998, 2486440 },
+    { 32216266, 6254487, -7796323, -3906683, 14893713, -9842537, -9999791, 16283784, -33192, 2640168 }
+  },
+  {
+    { 17278281, 13024003, 18975539, 8663460, 31955995, 8256379, -31534884, -8322269, -31927111, -5643302 },
+    { 13689985, 103296, -15508309, 7783930, 17321065, -3055474, -15436357, 2963324, 17990801, 13444833 },
+    { 5480859, 3913672, -48394, 5871705, 32596833, -5579228, 32357847, 2012618, -28862580, 13899423 }
+  },
+  {
+    { -11225584, 2320285, -9584280, 10149187, -33444663, 5808648, -14876251, -1729667, 31234590, 6090599 },
+    { -9633316, 116426, 26083934, 2897444, -6364437, -2688086, 609721, 15878753, -6970405, -9034768 },
+    { -27757857, 247744, -15194774, -9002551, 23288161, -10011936, -23869595, 6503646, 20650474, 1804084 }
+  },
+  {
+    { -7927624, 8517204, 17449040, 876144, -1082587, -13435235, -7287236, 5101860, 31632326, 7802391 },
+    { -6678993, -11183427, -19945483, -15103523, 28588002, -10419114, 28132155, 324767, 23359119, -8687572 },
+    { -17877079, -4886626, -552924, 1820912, -15113006, 14941513, 31762257, 551158, 16825814, -16408586 }
+  },
+  {
+    { -24607839, -10664789, -2222456, -6069163, -16317947, -4632983, -22697359, -13908046, -6061820, -6987228 },
+    { -26197424, 5363699, -27767315, 641979, 22168344, -14817900, -3399021, -6551236, -22639075, -8186989 },
+    { 11810905, 16424036, -15497117, -3216280, 7175490, 9881952, 2230646, -14471445, -23323343, -6218253 }
+  },
+  {
+    { -26664093, 8738483, -24989677, 10842183, -22409739, -4980558, -26126214, -5115723, -22882043, 11979818 },
+    { -6935402, -6451083, 19949530, -2073634, -12312727, 16230259, -24324414, 9666847, -11374, 11000636 },
+    { -22554183, -14223040, 29703046, 7661989, -20997457, -16531593, 31688803, 7921971, -30280482, -9667424 }
+  },
+  {
+    { -27589786, 15456424, 8972517, 8469608, 15640622, 4439847, 3121995, -10329713, 27842616, -202328 },
+    { -15306973, 2839644, 22530074, 10026331, 4602058, 5048462, 28248656, 5031932, -11375082, 12714369 },
+    { 20807691, -7270825, 29286141, 11421711, -27876523, -13868230, -21227475, 1035546, -19733229, 12796920 }
+  },
+  {
+    { 10596787, -5136883, -31681802, -10402323, 12288807, 7058279, 22566420, -9647834, -27673288, -13632983 },
+    { -25473577, -8494034, 17733282, 35286, 30143994, 5200388, 24233528, -4579445, -5705781, 12778141 },
+    { -14974188, 1530156, -8022489, 10503549, -5912584, -6409993, -650857, -155086, 22395066, -7386441 }
+  },
+  {
+    { -16876905, 5489568, -9362937, 4973196, -21504257, 9730739, -30076661, 7053705, -27690901, 8504819 },
+    { 20084352, -3565798, 10796020, -6846844, -11325871, -9135063, -29578159, 6305995, -19441972, 278528 },
+    { -29370154, 7217291, -17029715, -8927548, -5144061, 12687919, 18018479, 1555332, -12355183, 2688287 }
+  },
+  {
+    { 31886748, 1403596, -26085788, 5192869, -11674933, -2220301, -32371500, -2890961, 25657906, -16641275 },
+    { -1042714, -585056, -32391648, 2504239, -29747902, 12676835, -33223707, -13675799, 6353339, -4434833 },
+    { -1179441, -7803479, -5314670, -7629870, -8062295, -692404, -19213790, -12125023, 19586154, -14679848 }
+  },
+  {
+    { 12076899, -14301286, -8785001, -11848922, -25012791, 16400684, -17591495, -12899438, 3480665, -15182815 },
+    { -32361549, 5457597, 28548107, 7833186, 7303070, -11953545, -24363064, -15921875, -33374054, 2771025 },
+    { -21389266, 421932, 26597266, 6860826, 22486084, -6737172, -17137485, -4210226, -24552282, 15673397 }
+  },
+  {
+    { -4644496, -4707481, 15413722, -1890989, -30719114, -1016857, 24171479, 13914687, 30151988, -734555 },
+    { -18062448, -3096663, -23457563, 6053130, -20159744, 15175476, -16804149, -8435129, 31402397, 13412958 },
+    { -4067034, -10550967, -3394218, 12067499, -14615944, 1961217, 9218632, 16058157, -4491694, 16742078 }
+  },
+  {
+    { -19039466, -105803, 20473734, -4333051, -16644992, 9546497, 12717651, -7405437, 33326511, -10589653 },
+    { 7310357, 16380699, -30667759, -10590014, -29946398, 8958541, 3633435, -7259521, 25445905, -12034452 },
+    { 24977330, 15467472, -17715207, 10543181, 21949195, -10064750, 2612028, -3583299, -30509133, 386162 }
+  },
+  {
+    { -23656682, 15010141, 19449987, -14711483, 1616689, 4346488, -21448186, -4306507, -18243124, 3776928 },
+    { -497018, -4383046, -29089158, 1762737, 12930884, 3724377, 31854608, -10335708, -14939678, 15794315 },
+    { -29923746, -13855609, 9692171, 6485890, 31371904, 3689, -3816329, -16051048, -23895868, -8761323 }
+  },
+  {
+    { -20184622, 2338216, 19788685, -9620956, -4001265, -8740893, -20271184, 4733254, 3727144, -12934448 },
+    { 6120119, 814863, -11794402, -622716, 6812205, -15747771, 2019594, 7975683, 31123697, -10958981 },
+    { 30069250, -11435332, 30434654, 2958439, 18399564, -976289, 12296869, 9204260, -16432438, 9648165 }
+  }
+},
+{ /* 16/25 */
+  {
+    { 5975908, -5243188, -19459362, -9681747, -11541277, 14015782, -23665757, 1228319, 17544096, -10593782 },
+    { 5811932, -1715293, 3442887, -2269310, -18367348, -8359541, -18044043, -15410127, -5565381, 12348900 },
+    { -31399660, 11407555, 25755363, 6891399, -3256938, 14872274, -24849353, 8141295, -10632534, -585479 }
+  },
+  {
+    { -12675304, 694026, -5076145, 13300344, 14015258, -14451394, -9698672, -11329050, 30944593, 1130208 },
+    { 8247766, -6710942, -26562381, -7709309, -14401939, -14648910, 4652152, 2488540, 23550156, -271232 },
+    { 17294316, -3788438, 7026748, 15626851, 22990044, 113481, 2267737, -5908146, -408818, -137719 }
+  },
+  {
+    { 16091085, -16253926, 18599252, 7340678, 2137637, -1221657, -3364161, 14550936, 3260525, -7166271 },
+    { -4910104, -13332887, 18550887, 10864893, -16459325, -7291596, -23028869, -13204905, -12748722, 2701326 },
+    { -8574695, 16099415, 4629974, -16340524, -20786213, -6005432, -10018363, 9276971, 11329923, 1862132 }
+  },
+  {
+    { 14763076, -15903608, -30918270, 3689867, 3511892, 10313526, -21951088, 12219231, -9037963, -940300 },
+    { 8894987, -3446094, 6150753, 3013931, 301220, 15693451, -31981216, -2909717, -15438168, 11595570 },
+    { 15214962, 3537601, -26238722, -14058872, 4418657, -15230761, 13947276, 10730794, -13489462, -4363670 }
+  },
+  {
+    { -2538306, 7682793, 32759013, 263109, -29984731, -7955452, -22332124, -10188635, 977108, 699994 },
+    { -12466472, 4195084, -9211532, 550904, -15565337, 12917920, 19118110, -439841, -30534533, -14337913 },
+    { 31788461, -14507657, 4799989, 7372237, 8808585, -14747943, 9408237, -10051775, 12493932, -5409317 }
+  },
+  {
+    { -25680606, 5260744, -19235809, -6284470, -3695942, 16566087, 27218280, 2607121, 29375955, 6024730 },
+    { 842132, -2794693, -4763381, -8722815, 26332018, -12405641, 11831880, 6985184, -9940361, 2854096 },
+    { -4847262, -7969331, 2516242, -5847713, 9695691, -7221186, 16512645, 960770, 12121869, 16648078 }
+  },
+  {
+    { -15218652, 14667096, -13336229, 2013717, 30598287, -464137, -31504922, -7882064, 20237806, 2838411 },
+    { -19288047, 4453152, 15298546, -16178388, 22115043, -15972604, 12544294, -13470457, 1068881, -12499905 },
+    { -9558883, -16518835, 33238498, 13506958, 30505848, -1114596, -8486907, -2630053, 12521378, 4845654 }
+  },
+  {
+    { -28198521, 10744108, -2958380, 10199664, 7759311, -13088600, 3409348, -873400, -6482306, -12885870 },
+    { -23561822, 6230156, -20382013, 10655314, -24040585, -11621172, 10477734, -1240216, -3113227, 13974498 },
+    { 12966261, 15550616, -32038948, -1615346, 21025980, -629444, 5642325, 7188737, 18895762, 12629579 }
+  },
+  {
+    { -12985210, 2232306, -19245727, 13593841, 21993069, 8135687, -5796627, -12667581, -5248612, 7727958 },
+    { 31014590, -3210030, 8051177, 7477488, -22595585, -1688574, -12710138, -13971834, 22555828, 9443904 },
+    { 20406719, 13480001, -9586732, 5462500, -6324254, -4954984, 18464765, 10190197, 29305164, 12651287 }
+  },
+  {
+    { 3183109, 4683634, -23207796, -10363585, 5282234, -16140883, 24008332, -6521211, 26673690, -9501990 },
+    { 21238823, -1798803, -11529034, 16087566, 4404308, -457826, -3275936, -7213640, 3985587, -604474 },
+    { 10324605, -595874, 11566535, -3934990, -29775914, -15655244, 20381406, -3916325, 3862564, 13173910 }
+  },
+  {
+    { -21957963, 13492071, -26665590, -2455291, -26336472, -9189245, 14860663, -8432958, -3650002, 15092584 },
+    { -15399726, -8574195, -6788827, 45139, -9529197, 5486710, -16775014, 14372672, 17653981, 3209355 },
+    { -19321322, 8270008, -10982885, 15551010, 15372283, 3563700, -27142009, -15568290, 26130544, -14943167 }
+  },
+  {
+    { -14714855, 1032433, 22864387, 14196322, 12795394, -5284021, 25447033, -445588, -9532848, -38248 },
+    { 4055646, 1174354, -27473301, 11608482, -32016831, -12281361, 29208446, 7731819, -11168558, -10801590 },
+    { 31879923, 16403627, 25182783, 571067, 12709657, 3477023, 33359739, 8500205, 28891595, 5571888 }
+  },
+  {
+    { -7852082, 9694042, -17421415, -16555086, 25603963, -13892491, 26706975, 2852359, -30181638, -2372293 },
+    { -3379817, 4751536, -15017919, 1116618, 2822616, -10267218, 6109822, -8112603, 18962344, -15403693 },
+    { 2145750, 370657, -27838250, 10019748, 6694181, -2118665, -5048406, 9202666, 15633945, 9582675 }
+  },
+  {
+    { -16260779, 13338275, -8543071, 887524, 17896284, -13707485, -25237644, -12057274, 16170998, 14682704 },
+    { 8590969, -11930721, -23778707, -4207163, -16714765, 323589, 16689111, 7873298, -27842931, -1365914 },
+    { -21985136, 16418196, 30868187, 728762, -13146445, 6788087, 9611773, 11581761, -5914378, 10115143 }
+  },
+  {
+    { 28352553, -15624484, -17118660, 9409585, -664834, -11081144, 26238194, -12894402, 3277523, -12665476 },
+    { -30546688, 6744533, -9180105, -1379581, 14345903, -12652956, -8896037, 9706624, 15901529, -1340349 },
+    { 29446013, 13842603, -1904844, 12411287, 21675552, 6988455, -11644243, -10327647, -17982540, -12420404 }
+  },
+  {
+    { 32848944, 14869187, -32304465, 5534472, 11039196, 5740254, -2934758, -8833159, 27856026, 9081406 },
+    { -12649604, 4231155, 22186379, 13513185, 28360494, -3678076, 13136226, 10172232, -18198137, 3756407 },
+    { 20950123, -9423069, 25144688, -10012895, 22175542, 54021, -4289030, 2542214, -1029927, -16422958 }
+  }
+},
+{ /* 17/25 */
+  {
+    { -30505967, -3821767, 12074681, 13582412, -19877972, 2443951, -19719286, 12746132, 5331210, -10105944 },
+    { 30528811, 3601899, -1957090, 4619785, -27361822, -15436388, 24180793, -12570394, 27679908, -1648928 },
+    { 9402404, -13957065, 32834043, 10838634, -26580150, -13237195, 26653274, -8685565, 22611444, -12715406 }
+  },
+  {
+    { 29875063, 12493613, 2795536, -3786330, 1710620, 15181182, -10195717, -8788675, 9074234, 1167180 },
+    { -26205683, 11014233, -9842651, -2635485, -26908120, 7532294, -18716888, -9535498, 3843903, 9367684 },
+    { -10969595, -6403711, 9591134, 9582310, 11349256, 108879, 16235123, 8601684, -139197, 4242895 }
+  },
+  {
+    { 9878253, 14006920, -1396338, -8779282, -23114353, -9743395, -6371446, 12165081, 11500190, -2211678 },
+    { 33289110, 2293677, 32885825, -7250597, 9212210, 7873891, -7606588, -4575035, -30162256, 822763 },
+    { -9554709, 1468008, -6064228, -3944406, -4771871, 1636531, -11516301, 3715354, 26021108, 12947434 }
+  },
+  {
+    { -6069670, -5052251, -5462350, -15363256, -21086622, 10493066, -4240204, 10782758, 19715924, -10609716 },
+    { -20837039, 11879200, -28543308, -9107892, -15126666, -36018, 4729185, -11056419, -9260288, -14375140 },
+    { -32242881, -1949709, -2333073, -12442631, -3258303, -14955346, -33321070, 15757667, 12526404, -13498899 }
+  },
+  {
+    { 6924812, 3786709, 32656832, -10703501, -29662375, 9472810, -9760315, -16518851, 33044309, -1742717 },
+    { 20074026, -7523902, -4254665, 10223771, -25455705, -3109860, -1315051, 14479447, 836954, 1554453 },
+    { 18434310, 12703876, -2229523, -7120652, -14089649, 1651615, 9050147, -299459, 17068758, 5201829 }
+  },
+  {
+    { -15111099, 11831190, -13797030, -3431460, 14988762, -7741847, 27834248, -14276076, -5518248, 12357828 },
+    { -13080957, 11750094, 32949488, 15147850, 2273666, 14753148, 27580717, -13865781, -3452878, 12615038 },
+    { -24951748, 1647399, 25256554, 10447541, 31117105, 14123725, 4981368, 15006717, 10955413, -969526 }
+  },
+  {
+    { 23498695, 11936529, 1580586, -4678573, 10363508, 13429786, -19959846, -4796642, -27573063, 6119615 },
+    { -7628588, -11035017, 3294813, -15035167, -14540722, 14024832, -5870353, 12650900, -30103905, -7172297 },
+    { -29771603, -7408358, -12353138, -1449843, 14871170, -3579131, -7871622, -4199777, -17609318, -12003517 }
+  },
+  {
+    { 738455, 15209961, 21522471, 13794043, -18272072, 14800413, 30429911, -7705559, 27832414, -1931956 },
+    { 7453038, 1368394, -29924865, -10811872, -8062337, -13351933, -22238829, 9010656, -16295049, 2678542 },
+    { -19900866, -8627185, 3435928, -7976663, -29672159, -8117016, 32080383, 11402077, -29170196, -3492341 }
+  },
+  {
+    { -19346278, 11274573, 12354158, -3877472, -22606419, -13089305, -12672732, -8733188, 4458050, -4226234 },
+    { 3344143, 8832401, -18837190, 540344, -28377230, 4478894, 10408786, 16346735, 10939288, -15863175 },
+    { -32926095, -16717020, -26572936, 1719764, 21771008, -9067011, -26429066, 15761899, -29665237, -15441902 }
+  },
+  {
+    { -17100965, 14590591, 5738666, 11643247, -22247897, -2974006, 8640871, 9334973, 25570707, -11992505 },
+    { 18097883, 7569823, 14729847, -1032940, 20954056, 1793585, 22893033, 2614991, -27761733, 9562499 },
+    { -30455686, -15172531, -13375379, 14407395, -15545736, 15765069, 24889880, 14417623, -5135243, -12517701 }
+  },
+  {
+    { 8620320, -7362650, 33499987, 10198900, 7087849, -14319155, -13194335, -14299832, -27753224, 6322725 },
+    { 13581247, -15819656, -31136786, -524669, 28247530, 4521734, 14087135, 6160282, 1642091, -1017184 },
+    { 21080946, -6377210, 26914265, 1772885, 10770049, -3796069, 17486850, -11369436, -22065121, -3790843 }
+  },
+  {
+    { -16626749, 2417754, 33249389, -9811327, -29776058, 6245162, 24518258, -8872034, 32127821, 1670554 },
+    { -17078794, -6058641, -25942028, 4690837, 15161979, 16163792, 6736582, -3297897, 1522395, 6083038 },
+    { 20110157, 2863573, -9031360, -14541031, -18766188, -5769962, -4019862, -8320702, -3996712, 6731694 }
+  },
+  {
+    { 16445278, -4721559, 27670256, 5785530, -29313395, -14116121, -22851170, -10764558, 31232897, -11227443 },
+    { 28953144, 6474041, -32961869, 4058091, -352824, 7842933, -23074745, 14548439, 21727502, 10965451 },
+    { 3443933, 7254654, 10199454, 3941915, -9711704, -6403697, 8296083, 3546961, 31234082, -8548677 }
+  },
+  {
+    { -10919240, -1336035, 28362684, -8581164, -3720067, 6507068, 932604, 4958210, 14173156, -10170900 },
+    { -29363764, -14993174, -4064361, 15725020, 3864638, -99079, 22771393, 2402978, -28031901, 16251972 },
+    { -575225, 6826741, 5320066, 14004555, 2891630, -21545, 3022103, 6468070, 31240325, 5047156 }
+  },
+  {
+    { 9483081, -2917371, 30250088, -9340476, -28826409, -14992888, 31550410, 3171422, -11783057, -4277779 },
+    { 6946092, 16468042, 14760809, -2124897, -31841186, -532359, -3135990, -5272343, 24289725, -9766853 },
+    { 25162946, 10113803, -12331299, 860931, 19365102, -4860600, -10755550, -13179667, 27312473, -14325519 }
+  },
+  {
+    { -3991660, -9527471, 10802081, -222831, 9552676, 1668152, 32465931, -9801628, 25695594, 10570178 },
+    { -1386077, 3332181, 7198948, -358053, 22465318, 168113, 28159978, -2337220, -15485647, 12543796 },
+    { -551221, -11413806, 32145656, 10133860, -11854144, -14354305, -23987682, 3851704, 24621200, -6994241 }
+  }
+},
+{ /* 18/25 */
+  {
+    { 22514622, -9142449, 2166950, -6940349, 11376442, 13509235, -33293707, -9958222, 5161867, 2412512 },
+    { -5883134, 12235213, 11132467, 15344146, 11665129, -6953919, 4018212, 2010037, -31830517, -16465592 },
+    { 21587062, 14311011, 24712437, 16246189, -33257813, -11299725, -32933954, 10704060, 6677587, 2094364 }
+  },
+  {
+    { -18290749, 8672615, 5547528, -11754940, -3537207, -8236827, 30807836, -14773950, 9784229, 338920 },
+    { 26029005, 986953, -18351861, 7174918, 6031977, -9816191, -1774815, -10191038, -6059200, 7371135 },
+    { -5020052, 6668295, 26687846, 9592831, 13369729, 8921916, -7811955, 7111975, -10234643, 10773009 }
+  },
+  {
+    { 1750782, -11669265, 4726644, 10119869, 718929, 10871286, -6681860, 3219099, -16724792, -10120239 },
+    { 4959226, -15072905, 26746984, 15903927, 11556605, -6611653, -8187301, -2579591, 17439217, 16480865 },
+    { 17393683, 8963403, 20110473, 13337651, 24126229, 11533166, -19200733, -5162010, 2065776, -10599081 }
+  },
+  {
+    { 1566649, 5953730, -33237314, -15081047, -33410651, 13562370, 21765546, 6858313, 8692869, -11599288 },
+    { -18822673, 9680709, 5436102, 7311888, 18492958, 16085950, 18594642, -14335181, -15144673, 7995124 },
+    { 30126015, -16441220, -23283109, -5010676, 9204919, 10837144, -21288079, 12501360, 25340489, 16405875 }
+  },
+  {
+    { 29047378, 8190936, -14166681, -14060087, -29700094, 12656501, -13146596, 9696956, 23228220, -6998534 },
+    { -19835853, -2828400, -32211822, -11506796, -12462683, 14574472, 32050901, 12494879, 8189001, 5282082 },
+    { 8203499, -13371561, 26688685, 16169406, -32785729, -413524, -1199767, -4756447, 3883865, 2993835 }
+  },
+  {
+    { -16733893, 11449742, -26319863, 10408893, -17301361, -12929270, -8281294, 8542988, 4786208, 75191 },
+    { -31261013, -7671070, -30019747, 11957701, 18733193, 14943924, 21585529, 10494795, 24661569, -744192 },
+    { -25271456, -13753487, 10584975, -13342556, 1909073, 903984, -16925281, -10193879, 28588036, 4329724 }
+  },
+  {
+    { -14391122, -2503815, 19937966, -9593691, -12096980, -9908242, 28081993, 4004783, 13948268, -816869 },
+    { -10324259, 4265294, -6604609, 7256867, -13015978, -13210822, -13719409, 14193247, -18536807, 4545838 },
+    { -8339866, -15981664, -26020065, 5875023, 24965859, -3396820, 11591322, 13509397, -5002833, -3931880 }
+  },
+  {
+    { 27093406, -911231, -3329016, -15936755, 9290559, -8241685, -14841576, 9033888, -17137912, 7629846 },
+    { 1807870, 5197188, 9490047, -3507334, -1327922, -15342237, 12169160, -4969782, 17140545, -94266 },
+    { 23852594, -7238535, 5530489, 8614556, -11671892, -12577138, 6471427, -14906965, -30915538, -10909350 }
+  },
+  {
+    { 13608635, -1286487, -15097358, -5233120, -3921792, 15537896, 19944987, -3542094, -5100553, -6569620 },
+    { 7349180, 2584028, 13050262, 14417310, 27735952, -5108317, 12929043, 6138363, 8685876, 5308664 },
+    { 5293084, -947550, 11541360, 12852170, -18315713, 6392997, 6498722, 6268805, -10250694, 5937470 }
+  },
+  {
+    { 13756766, -1032929, 30476417, -15455181, 854830, -13845598, 13418827, -13335817, 12828590, 13695739 },
+    { 6145266, 13120682, -19179542, -3788964, 10388329, -11436813, 28922238, 4061789, -25835062, -2428327 },
+    { -5500297, 12302652, 28955787, 3292843, 13597413, 6257648, 31959860, -3050978, -31634526, 2734564 }
+  },
+  {
+    { 25961039, 11669482, 8573340, 4570924, -33065176, 324411, 9037954, 1546605, 26796043, -7903044 },
+    { -19662614, -1784357, -22493037, 16588997, 11358057, 1916700, 27829748, -7390667, 13330222, 3608454 },
+    { 14639831, 5919622, 3895590, -9221357, -31308988, -13310843, -27556118, 9457054, -5130095, -14172010 }
+  },
+  {
+    { -10216359, 14296705, -27604717, 9677452, 28675827, 9430074, 16547056, 14436332, 14380435, -8410439 },
+    { 14085239, 508471, -22177772, -1440142, 1437001, 3636721, -16063422, 1750508, -9139302, 2275253 },
+    { 20870270, 8888610, 20766036, -12520016, -17880963, 4771438, 30664839, -8165394, -33122003, 11788841 }
+  },
+  {
+    { 22406140, 9747943, 6074525, 13838139, 25336966, -9267730, -31937273, -9462085, -12666208, -3633875 },
+    { -8798805, -8468272, -31170546, 10847869, -29870653, -168272, -10249893, -6025012, -29244067, -9066739 },
+    { 14551152, -7870998, -9071203, 628348, 32899167, 10599620, 21550966, -6693276, 18834583, 2070353 }
+  },
+  {
+    { 25508286, 8497410, -31341705, -16093386, 9821414, 8647651, -32512011, -15709615, 20305794, -13538503 },
+    { 28218765, -14429006, 4112288, -5360321, 18974039, -1863576, -3547004, 10135908, -26793938, -7063762 },
+    { 10652891, 3002803, 9118688, 10646268, 618621, 2883775, 736688, 4319205, 26183623, 10098398 }
+  },
+  {
+    { -17117658, 12150713, -14132432, -13904030, -4587984, 12814106, 13401580, 8123604, -14448935, -13809928 },
+    { 24031065, -16588366, 29052443, 15920084, 21324975, -9263464, 32699806, -16254409, -28814959, -14337642 },
+    { 28719254, 7751682, -9658795, 12334236, 32217809, -10485717, 9502945, 3379022, -2420594, 13432289 }
+  },
+  {
+    { -817581, 6763912, 11803561, 1585585, 10958447, -2671165, 23855391, 4598332, -6159431, -14117438 },
+    { -31031306, -14256194, 17332029, -2383520, 31312682, -5967183, 696309, 50292, -20095739, 11763584 },
+    { -594563, -2514283, -32234153, 12643980, 12650761, 14811489, 665117, -12613632, -19773211, -10713562 }
+  }
+},
+{ /* 19/25 */
+  {
+    { -16994639, 15280136, 22189231, -8986236, 31096112, 248622, 8877467, 5184062, 31974465, -16619719 },
+    { -13580849, -10411780, 25270984, 11606798, 20140754, 8660652, 7503954, -2261550, -3044331, 2872438 },
+    { -28237316, 6525923, 33293145, 2547665, 32946773, 4394489, 5572331, -610204, -28130141, -6698486 }
+  },
+  {
+    { 3598048, 5152435, 31306191, -14947645, -1578273, 14808293, -3454627, 9422666, -1051148, 7361217 },
+    { -7767763, 7827611, 13407330, 3592841, 7127763, -15398823, -4348312, 8454549, 32616457, 7835919 },
+    { 11031204, -14748603, -25828563, -7306841, 22994355, -6459910, 15573512, 9596005, 25601393, -8662791 }
+  },
+  {
+    { -18696226, 1573839, 16206360, -9715585, 13790638, -7876141, -20128360, -10885001, 3040978, -15017072 },
+    { 442335, 2305512, 9106877, 7956597, 20849759, 11936775, -12134436, 6214554, 22873697, 1360009 },
+    { 22346621, -8480788, -12777700, 7574889, -14785126, -13661977, 23258068, 11746362, -13427956, -9401843 }
+  },
+  {
+    { 793299, -9230478, 8836302, -6235707, -27360908, -2369593, 33152843, -4885251, -9906200, -621852 },
+    { 5666233, 525582, 20782575, -8038419, -24538499, 14657740, 16099374, 1468826, -6171428, -15186581 },
+    { -4859255, -3779343, -2917758, -6748019, 7778750, 11688288, -30404353, -9871238, -1558923, -9863646 }
+  },
+  {
+    { 13996835, -11187661, 30304858, -10253687, -12082323, 9075313, 7646289, -10659464, 25620368, -6312021 },
+    { 3004490, -7366189, 22469549, 16161597, -22823127, 10053460, -25518163, -6763919, -23750661, -1317743 },
+    { -24319557, -8332209, 2795281, -12105780, -24156161, -5141989, -33499610, 12538904, 6104076, 9104367 }
+  },
+  {
+    { 25719065, 370440, -24454836, -16282654, 22605481, 11276789, 28650907, 2812442, -15274290, 14493745 },
+    { -20014357, -13198100, 10193460, 7588676, 13635563, -9781533, 4628093, 1403495, 22994885, 15687418 },
+    { 17521553, -12980945, 13263851, 201576, -24719691, -12713898, 24126746, -9224994, -30995382, -8953239 }
+  },
+  {
+    { 29219325, 10400830, 1797776, 1988065, 30983215, -11959902, -18481687, 14422321, -8954510, 1274847 },
+    { 610067, -11153919, 10779639, -7125720, -24749333, 16536193, 33447005, -8252515, -3329887, 1017120 },
+    { -18691844, -7504526, -21573764, 7961401, 33179150, 8477887, 21865241, 1906277, -2041982, 16361684 }
+  },
+  {
+    { 10896332, -7719704, 824275, 472601, -19460308, 3009587, 25248958, 14783338, -30581476, -15757844 },
+    { 10566929, 12612572, -31944212, 11118703, -12633376, 12362879, 21752402, 8822496, 24003793, 14264025 },
+    { 27713862, -7355973, -11008240, 9227530, 27050101, 2504721, 23886875, -13117525, 13958495, -5732453 }
+  },
+  {
+    { 32208885, 1241056, 31524438, -2826535, 9223262, 15755589, 2529397, 13161242, 13823414, -12316513 },
+    { -16215809, -15886425, -22715182, -5585899, 28706052, 8772993, -31810548, 3444687, 21976640, 13034047 },
+    { 10500766, 12500940, 9585425, -2875337, 29932328, 11494540, -32673163, 4950706, 12058159, 7381311 }
+  },
+  {
+    { 11496483, -16644084, 21670178, -4953302, -31875164, -10782419, 14756366, -3306957, -1471563, -4447166 },
+    { 19884282, -9209586, 29002381, 7226429, -8323216, -7322824, 30082214, -5825864, -31643884, -11319822 },
+    { -8527226, 8843699, -16076587, -16467792, 11670755, 1331905, 13719030, -10253022, 23033583, 2367120 }
+  },
+  {
+    { -14655722, -15129881, -5310641, 5905945, 20945995, -6604759, 19791647, -6843770, 28863218, -9626401 },
+    { -5854722, 3998094, 31487773, -13819169, 30575581, -3497189, -9803465, -1701827, 6670639, 7970937 },
+    { 4147362, -14549130, 5359735, -11798081, -1971713, -5531717, -12399495, -16668336, 29884862, 13999668 }
+  },
+  {
+    { -23481610, 4867226, -27247128, 3900521, 29838369, -8212291, -31889399, -10041781, 7340521, -15410068 },
+    { 4646514, -8011124, -22766023, -11532654, 23184553, 8566613, 31366726, -1381061, -15066784, -10375192 },
+    { -17270517, 12723032, -16993061, 14878794, 21619651, -6197576, 27584817, 3093888, -8843694, 3849921 }
+  },
+  {
+    { -8801027, -13977460, 20803145, -13952848, -16590496, -15463448, 13876628, 3056392, -26356703, -4709708 },
+    { -21116935, 6148160, 31064252, 10249238, 3988509, 4816541, 11160761, -1158403, -23830284, -11433635 },
+    { 8228376, 15021426, -30630267, -2272339, 32170164, 2282559, -4108878, 8461870, 23095865, 12727734 }
+  },
+  {
+    { 14191562, -13094421, -19240175, -1626248, 28026917, 995498, 4679412, 6450329, -21229530, -10508513 },
+    { -10957009, 2849895, -272551, -3788916, 27737764, 11080281, 15742478, 13653032, -29143976, 4424345 },
+    { -25569182, 15611687, 6494389, -13738197, 21362673, -8994144, -31531310, 3086588, -15565581, -10758554 }
+  },
+  {
+    { 18076276, 1656783, 4957381, 12301206, 13329699, -13581722, -18851774, -2360210, 8376961, -5954237 },
+    { 11203119, 13637748, 5990264, -14989603, -6181570, -15589594, -17746898, -12264697, 18375058, 5791518 },
+    { 1996667, -3648826, 7069388, 3563341, 6639739, -1675406, 18892688, -13201461, 22496305, -10410429 }
+  },
+  {
+    { -9064912, 2103172, 25561640, -15125738, -5239824, 9582958, 32477045, -9017955, 5002294, -15550259 },
+    { -12057553, -11177906, 21115585, -13365155, 8808712, -12030708, 16489530, 13378448, -25845716, 12741426 },
+    { -5946367, 10645103, -30911586, 15390284, -3286982, -7118677, 24306472, 15852464, 28834118, -7646072 }
+  }
+},
+{ /* 20/25 */
+  {
+    { -25499735, -4378794, -15222908, -6901211, 16615731, 2051784, 3303702, 15490, -27548796, 12314391 },
+    { 15683520, -6003043, 18109120, -9980648, 15337968, -5997823, -16717435, 15921866, 16103996, -3731215 },
+    { -23169824, -10781249, 13588192, -1628807, -3798557, -1074929, -19273607, 5402699, -29815713, -9841101 }
+  },
+  {
+    { 23190676, 2384583, -32714340, 3462154, -29903655, -1529132, -11266856, 8911517, -25205859, 2739713 },
+    { 21374101, -3554250, -33524649, 9874411, 15377179, 11831242, -33529904, 6134907, 4931255, 11987849 },
+    { -7732, -2978858, -16223486, 7277597, 105524, -322051, -31480539, 13861388, -30076310, 10117930 }
+  },
+  {
+    { -29501170, -10744872, -26163768, 13051539, -25625564, 5089643, -6325503, 6704079, 12890019, 15728940 },
+    { -21972360, -11771379, -951059, -4418840, 14704840, 2695116, 903376, -10428139, 12885167, 8311031 },
+    { -17516482, 5352194, 10384213, -13811658, 7506451, 13453191, 26423267, 4384730, 1888765, -5435404 }
+  },
+  {
+    { -25817338, -3107312, -13494599, -3182506, 30896459, -13921729, -32251644, -12707869, -19464434, -3340243 },
+    { -23607977, -2665774, -526091, 4651136, 5765089, 4618330, 6092245, 14845197, 17151279, -9854116 },
+    { -24830458, -12733720, -15165978, 10367250, -29530908, -265356, 22825805, -7087279, -16866484, 16176525 }
+  },
+  {
+    { -23583256, 6564961, 20063689, 3798228, -4740178, 7359225, 2006182, -10363426, -28746253, -10197509 },
+    { -10626600, -4486402, -13320562, -5125317, 3432136, -6393229, 23632037, -1940610, 32808310, 1099883 },
+    { 15030977, 5768825, -27451236, -2887299, -6427378, -15361371, -15277896, -6809350, 2051441, -15225865 }
+  },
+  {
+    { -3362323, -7239372, 7517890, 9824992, 23555850, 295369, 5148398, -14154188, -22686354, 16633660 },
+    { 4577086, -16752288, 13249841, -15304328, 19958763, -14537274, 18559670, -10759549, 8402478, -9864273 },
+    { -28406330, -1051581, -26790155, -907698, -17212414, -11030789, 9453451, -14980072, 17983010, 9967138 }
+  },
+  {
+    { -25762494, 6524722, 26585488, 9969270, 24709298, 1220360, -1677990, 7806337, 17507396, 3651560 },
+    { -10420457, -4118111, 14584639, 15971087, -15768321, 8861010, 26556809, -5574557, -18553322, -11357135 },
+    { 2839101, 14284142, 4029895, 3472686, 14402957, 12689363, -26642121, 8459447, -5605463, -7621941 }
+  },
+  {
+    { -4839289, -3535444, 9744961, 2871048, 25113978, 3187018, -25110813, -849066, 17258084, -7977739 },
+    { 18164541, -10595176, -17154882, -1542417, 19237078, -9745295, 23357533, -15217008, 26908270, 12150756 },
+    { -30264870, -7647865, 5112249, -7036672, -1499807, -6974257, 43168, -5537701, -32302074, 16215819 }
+  },
+  {
+    { -2270480, 9905127, -19878473, 1360660, 24554722, -9687238, 12782554, -7281466, 17752100, 6800758 },
+    { 29206677, -833038, -27323062, 2480935, 3611278, 16277604, -31694519, 8616913, -3425209, 10519115 },
+    { 27037483, -13601464, -21387895, -6124304, -21179052, 13082642, -14828899, -14459207, -7062435, -4484474 }
+  },
+  {
+    { -19363085, 15205051, 9763978, -9967203, -14560672, 1056897, -13287485, 14840805, -8567211, 11673161 },
+    { 22107340, 4221837, -6605758, 6726757, 32743190, 10987537, -1506999, 10174960, -23264021, 7164324 },
+    { -7245606, -55316, -7840079, 2582875, -7042442, -7552966, -19378814, 14265903, -15298509, -7880024 }
+  },
+  {
+    { 10819259, 3008016, -21355318, -12590520, 30591691, -1769551, -24389986, 9528500, 18798290, 16049143 },
+    { 8700151, -10093645, -5877839, 7179258, 17945227, -11873562, -18263959, 7412431, 21893461, -12816706 },
+    { 7564261, -12638048, 5433207, 2624316, -28925793, 3051047, -3237697, 12267615, 21466137, 14507011 }
+  },
+  {
+    { -20533817, -14783328, -16869356, 1339533, 20298815, 11494437, -3226361, -5724234, 10118034, -10578575 },
+    { -21507983, -1116176, 13487118, -3339105, 21520812, 822992, -30311968, 46042, -7961788, 12053966 },
+    { -7043947, 4070625, -9312750, 5273755, -5275385, -4943067, -30210780, -2307834, -27852985, 10344120 }
+  },
+  {
+    { -8254790, 318274, 29062800, 14930521, -31111914, -11866822, -10448321, -8204325, -8126929, -3828000 },
+    { 20453873, -4752093, -24866351, -5506565, -2849229, 13693867, -566795, -704715, 9589134, -2910202 },
+    { -32525565, 12739431, 14163346, 3690990, 6360507, -14285678, -12620653, 9659390, 331582, 11683454 }
+  },
+  {
+    { 1640018, 11085374, -21915057, 12742353, 22572887, 6958110, -14714037, 15154622, -16637152, -16724003 },
+    { 5241041, 6516, -8725560, 14111021, -19545640, -10629416, -3939109, 6187990, 14762013, 12703080 },
+    { 8888207, -2189055, 13533791, 13010868, -32431218, 7548001, -2834203, 9627309, 515285, -4245802 }
+  },
+  {
+    { -13390918, 261474, -14753252, -5082987, -6505372, 9759596, -5920848, 9024392, -637247, 12633952 },
+    { 29487090, -10534426, 31779264, 15206873, -19983309, -5034336, 14719410, -2562413, -8802194, 11737987 },
+    { 22046370, 12471572, -10870188, -7183198, -12696771, 10419475, -25794991, 12305469, 6594993, -3900077 }
+  },
+  {
+    { 4863460, 14069888, 16285550, 1692464, 13072445, -14101095, -20389917, 10588017, -27305040, -11077015 },
+    { -294417, 2704020, 1566698, 4841377, -20479788, 11152593, 21433955, -12053643, -31481288, 13143650 },
+    { -2409006, 1487693, -21216864, -1833630, 280270, -7803925, 23803448, -8804078, -15314800, -2344265 }
+  }
+},
+{ /* 21/25 */
+  {
+    { 31879134, -8918693, 17258761, 90626, -8041836, -4917709, 24162788, -9650886, -17970238, 12833045 },
+    { 19073683, 14851414, -24403169, -11860168, 7625278, 11091125, -19619190, 2074449, -9413939, 14905377 },
+    { 24483667, -11935567, -2518866, -11547418, -1553130, 15355506, -25282080, 9253129, 27628530, -7555480 }
+  },
+  {
+    { -16358878, -12663911, -12065183, 4996454, -1256422, 1073572, 9583558, 12851107, 4003896, 12673717 },
+    { -1731589, -15155870, -3262930, 16143082, 19294135, 13385325, 14741514, -9103726, 7903886, 2348101 },
+    { 24536016, -16515207, 12715592, -3862155, 1511293, 10047386, -3842346, -7129159, -28377538, 10048127 }
+  },
+  {
+    { -21278553, -6072320, 8490289, -10836365, -4075270, -6316075, 17090014, -7311317, 6693065, 5996898 },
+    { -24756121, -13297480, 9506171, 7614624, 5789114, -15141643, -1032577, 1810334, 32205562, 11185459 },
+    { -24483750, -1309509, -13748660, -6585594, 29000503, -15278358, -26622727, 97875, -21125378, 4748377 }
+  },
+  {
+    { -11299124, 15664638, 15253659, 12490691, 27761291, -12670010, 5164283, 12212424, -10276126, -8288808 },
+    { -3240036, 13514210, 17935985, -15594547, -19359388, -11456146, 29773433, 12133902, -579801, -14398926 },
+    { 21030896, 5096381, -32200700, -5435505, 2376540, -16336889, -27957586, 4630727, -11103153, -5707879 }
+  },
+  {
+    { -31519842, -3080072, 15405259, 13836713, 28263557, -7451960, 4913130, 3631635, 1186637, -8265334 },
+    { 28702401, -9396513, 16043549, 7058722, -2273212, 1698242, -4727728, -3334935, -32853008, 4980678 },
+    { -19043505, 977678, -28178689, -5840877, 16319278, -1869693, -3648041, -8262182, 27789182, -1873636 }
+  },
+  {
+    { -783681, -1830880, -27635050, -8749223, -11010662, 12327012, -6079838, 4192874, -33137291, -1787460 },
+    { 28871833, -10458244, -16580862, -12480789, -28222537, 735245, -17901325, -5128244, -16837981, -2955687 },
+    { -19277765, 1360897, 14639304, -13450208, 28663069, -13882761, 26043957, -2693879, 23006997, 16373845 }
+  },
+  {
+    { 32045881, 12734144, 10367801, 13684803, -27222428, 13119591, 23531643, 4923977, 29569834, -3967947 },
+    { -8625002, 5530070, -32014115, 14278914, -29162159, -6906044, -33551754, -3159897, 29670721, 9199780 },
+    { -367711, -12593921, -32639112, 15391485, -11169809, -15494750, 15639250, 11675013, -7478643, -14833554 }
+  },
+  {
+    { 302749, 6657501, -22715468, -15939598, -1100357, 5387943, 31893606, 14439993, -2885244, 8223521 },
+    { -7277574, -11169736, 12407514, 7790545, 28371416, -1884988, 32998573, -3472226, -1756973, -16113030 },
+    { -24327307, 13168845, 31273439, 4123707, -21165432, -333929, 32337455, -1432545, -21992454, 9468050 }
+  },
+  {
+    { 12814131, 13437069, -32094213, 7982846, 5407237, 3462543, 1986897, -15863180, -9035357, -6035454 },
+    { -4551563, 10381552, -29493602, 7251666, 21681778, -6709767, 6311770, 3161025, -24767724, 5391989 },
+    { -3736368, 12381987, -3672087, -13842074, -22746059, 3747593, -26678946, 4739275, -10108950, -434740 }
+  },
+  {
+    { -33211392, -13394939, 19119895, 5372356, 5903064, -16278561, -20851525, 1862578, -7702350, -10695433 },
+    { 22364507, 6458329, 267401, -15218100, 16279028, -5148466, -25972684, -11697922, -8211878, 13705223 },
+    { -25108544, -10686578, -14453656, -12532366, -25622749, 6232287, 21422470, -5290959, 28330158, -6319871 }
+  },
+  {
+    { 28003379, 4599731, -17745541, -902957, 16200588, -78301, -3217324, -7417063, -29746051, -1417289 },
+    { 31427263, 13131310, -5444013, 10818477, 12058150, -10597794, -11498932, -15337955, -5655533, 11960822 },
+    { 1911196, -8525160, -3211408, -13115884, 16516890, 2062696, -8020041, -11550231, 19412410, -13072005 }
+  },
+  {
+    { -25117768, 12527257, -16699435, 9936927, 9083964, -226016, -14656114, 8242746, -10581035, 11475289 },
+    { 24025353, -6056469, 828733, 4217393, 20072835, -14763189, 4396883, 1239008, -313127, -9499874 },
+    { 23834003, -8968214, 16489755, -1118006, -6930746, -15179868, -23497421, -16380669, -5229400, 8353201 }
+  },
+  {
+    { 28259121, -3627655, -25108049, 47989, -5297537, -361313, -28765922, 13329393, -32131714, 2207381 },
+    { -22644519, 13051469, 29016031, 2010550, -15662813, 10069233, -19708894, -11799108, 12971524, -7354932 },
+    { -20011298, -12626723, -23782713, 2716810, 738068, 5721333, -18701540, -13502948, 20961349, 2392694 }
+  },
+  {
+    { -5125307, -5293529, 27733640, -1100191, -8748525, 10255767, -28714923, -16225793, -1434922, 13972823 },
+    { -1263640, 787046, 7917005, 15954962, -750220, 15365766, -10676341, -6127853, -32487506, -14860572 },
+    { 55710, 2666502, 17445455, -1778469, 1703577, -15101826, -28939376, 186546, -3099292, -9179415 }
+  },
+  {
+    { -1289418, -5712208, 23403851, 7118402, -12483907, 3699232, 29089270, 12062477, -5706514, 2425180 },
+    { -1466102, 16277658, -17533681, 6382911, -20237494, -8461927, -25690186, -13448594, 28767420, -13501797 },
+    { -23819514, 5930938, -23605531, -12492054, -10341737, 3614089, 30303206, 14890036, 27102966, -2753878 }
+  },
+  {
+    { 30996412, 15313227, 22541186, 6420462, 11988094, 587701, -15130577, -12799292, -31736211, -14474619 },
+    { 31201534, -13065451, 24879437, 13212879, -7373190, 14870099, -31354440, -8270026, 3386957, 14155263 },
+    { 23356504, 5676822, -20791416, 12454214, -12021045, -280301, -18553725, -693241, 19350570, -16032092 }
+  }
+},
+{ /* 22/25 */
+  {
+    { 7030396, 10563936, 1008588, -2147605, -15213978, -8859037, -1266598, -9563795, -22536999, 16130906 },
+    { 207890, -9611941, -12101257, -4634292, -8534457, -1211972, -4615337, 8304704, -4813856, -3754077 },
+    { 5166985, -6380344, 29708655, 6094085, 30981931, -3258233, -661961, -626972, 22609670, 13681032 }
+  },
+  {
+    { -25480761, 8798667, 188316, -5418308, 20310898, -12086492, 20665156, -8560168, 30539173, -4868491 },
+    { 32882505, -9934344, 1203212, -9526373, 10032630, -3394826, -27771974, -413956, 23711190, 2717266 },
+    { 28344707, 6906554, -15637418, -7468318, -633022, -16120552, 9550659, 7066928, -5523469, 13426995 }
+  },
+  {
+    { -31356019, -15163766, 25962104, 16661824, -5635384, -12673305, 5805452, 733835, -2039053, 1935647 },
+    { 10667976, -1533437, 33245070, 2325938, 7160328, 3266270, 26889770, -7258774, 16169082, -11935026 },
+    { 1455981, 4291973, 24414812, -4969121, -5087555, -5866441, -10845422, -10476323, 24067408, -9190495 }
+  },
+  {
+    { 28525224, -5010353, -16918570, 14426478, -13726323, -8449040, -30207935, 12115218, -22747283, 7229667 },
+    { -18298188, 5905607, -27738407, 16145021, 24674768, 13483070, -23203130, -4266571, -31024783, 12023803 },
+    { -26279123, 1957766, 6623562, -7832131, 1699048, -15745674, -18558207, -14638299, -10696895, -4725034 }
+  },
+  {
+    { 13295188, -993582, 5119388, 16617876, 27926812, 10492778, 19206688, -1757567, 23069622, -14911138 },
+    { -606769, 4606538, 3754072, -3014165, -29473210, -6414494, -30592186, -935036, -8368447, 5658642 },
+    { 15546303, -5313301, 27089747, -5289724, 32018575, 11451106, -30533604, -3808102, -16923173, -12382885 }
+  },
+  {
+    { -13518473, -10012729, -10585602, 2909481, -3007834, 9183109, 12137205, -8387951, 31011501, -2021041 },
+    { 29557528, -13643568, -4603588, 9181377, -4528104, 1976738, 14706542, 11933743, 9466867, 7798254 },
+    { 16533792, 8288197, -219725, 6693453, 31142616, -3211261, 26631667, 1922178, -30060800, 16666465 }
+  },
+  {
+    { 31541624, -16468898, -1319594, -6430880, -112384, 6540840, -13503997, 12577119, -25093537, 4148743 },
+    { -33239400, 16374312, -26726352, 15737395, 27147996, 8973740, 16959411, -13412942, 20263601, -9007805 },
+    { 3596135, -5555415, -19063221, -12225713, 4337030, -10681492, 12805558, -1440741, -6296021, -6986401 }
+  },
+  {
+    { 184492, 5252852, -13314120, 2993767, 26843145, 14583276, 12509821, -1986490, 11971966, 784973 },
+    { 16909071, 2891754, -30902827, -11033825, -1953318, 7895649, 4305694, 9765558, 21505658, 2337476 },
+    { -4724108, -12828620, 5610988, -6484390, 9053657, 15893986, -16373145, -11879782, 4759879, 12649008 }
+  },
+  {
+    { -30924448, 4649014, -15361922, 16270858, 31714656, 107669, 2209995, -12802100, -25654383, -12399734 },
+    { -12140790, 15455924, -6424621, -8267926, 19891041, 11279446, -19296730, 2574771, -18462040, -1788928 },
+    { -5671072, 14626162, -24704092, 7610005, 30384520, -1342910, -11893614, -12144566, -12009103, -8615882 }
+  },
+  {
+    { -3416568, -13252740, -18294243, -9033224, 30419312, 8347544, 11948712, 10533477, 17395550, 1669924 },
+    { 18399424, -2591112, 12011535, 6493037, 21856190, 6781557, -13136957, 15155723, -25322852, -5421855 },
+    { -11005630, -14259534, -32676404, 7892682, 7658864, -3297042, 4856198, 4391270, 7899383, 14447090 }
+  },
+  {
+    { 19040224, -16028772, -2021508, -5331437, 9898276, -6544097, 27756703, -11214091, 21900752, 567340 },
+    { -11792585, 2485093, 17253851, -7460462, 13528853, 6903115, -11904604, 3474079, 4134234, 3834930 },
+    { 18492120, 921907, -29754665, 3518473, 12545487, 9065141, -17183859, -6286505, -21543910, -9305172 }
+  },
+  {
+    { -24151113, -11633389, -16139042, -5790260, 7995755, -3082528, -23607252, -12903200, -18630428, -14056531 },
+    { -21495927, 8324688, 17590058, 6521210, -31989651, -5894442, -3029019, 15863173, 12105538, -16594537 },
+    { 22234366, -6780713, 17379533, -291381, 3527589, 2634384, 23030395, 1994175, 32268183, 15512722 }
+  },
+  {
+    { 18837828, -16077763, 28360953, 4153046, -28887020, 14165081, -17732033, -5726152, 27689755, 16076987 },
+    { 27547248, -14389531, -28087309, 11125640, -30152308, -14400952, -29646177, -3280989, 5822614, -14273476 },
+    { -17818651, -12057190, 26173247, -7258734, 32298306, 4713502, 26672948, 4741318, -1681943, -16135972 }
+  },
+  {
+    { 11795510, -10008267, -32422197, 14252135, 30593358, 3336763, 10754416, 8420270, -20426478, -1222980 },
+    { -9919852, -13466992, -31694102, -9041325, 31189785, -2978527, 20462252, 435529, -290928, -10949935 },
+    { 30215222, -4612200, -9289638, 751405, -8897204, -6493413, 13360582, 13122079, -15621685, -2367603 }
+  },
+  {
+    { -8372490, -13524773, -19804920, 15624394, 23909758, -4515917, 17666420, 12232825, -24706236, -9037727 },
+    { -18414563, 15037749, -28115623, -5630895, -18674486, 6272362, -12419605, 10947232, 27197497, -12665951 },
+    { -28563814, -7549633, 22308726, -6190887, -12140211, -3112867, -5851388, -10593336, 5716729, -15920919 }
+  },
+  {
+    { 20678546, -8375738, -32671898, 8849123, -5009758, 14574752, 31186971, -3973730, 9014762, -8579056 },
+    { -13644050, -10350239, -15962508, 5075808, -1514661, -11534600, -33102500, 9160280, 8473550, -3256838 },
+    { 24900749, 14435722, 17209120, -15292541, -22592275, 9878983, -7689309, -16335821, -24568481, 11788948 }
+  }
+},
+{ /* 23/25 */
+  {
+    { 12233317, 14834208, -25048942, 2593837, 20079295, 5523638, 22269394, -3146263, 17455019, -11934956 },
+    { 2806510, -12366339, -8478133, 2409744, -30547072, -7779149, 25411866, -6190166, 14935193, 729401 },
+    { 21760935, -9167606, -600918, -3737400, -2788069, -5340313, -630073, 2932238, -26732275, -10348194 }
+  },
+  {
+    { 22558130, -11266301, 9265731, 4186438, 11042895, -1415602, 5298117, -3939180, -7728847, -15727911 },
+    { -7332260, -22252, -17809020, -4649946, 11283903, -15410296, -14207, 2645169, -10192806, 14437437 },
+    { -18015805, 7199014, -28965056, -7902828, 13074475, -3533391, 21244866, -2561471, 7711948, 1747686 }
+  },
+  {
+    { 8172977, -11097200, -3200100, 240783, 11679624, 10815900, 18520167, -718077, 14163065, -9103282 },
+    { -2046039, 7950157, -23625292, -2779253, -25010909, -1621857, 25466017, 13673477, -18892937, 14140641 },
+    { 24497818, -7431753, -31959599, -9225314, 31804119, 9755134, 17243589, 3797992, -9966819, -16533793 }
+  },
+  {
+    { 19852034, 7027924, 23669353, 10020366, 8586503, -6657907, 394197, -6101885, 18638003, -11174937 },
+    { 31395534, 15098109, 26581030, 8030562, -16527914, -5007134, 9012486, -7584354, -6643087, -5442636 },
+    { -9192165, -2347377, -1997099, 4529534, 25766844, 607986, -13222, 9677543, -32294889, -6456008 }
+  },
+  {
+    { -14086317, -16446700, 27173569, -1776008, 22502239, -14921721, -29705638, 15997986, 20097099, -16621995 },
+    { -19442519, 6442733, -25358132, 592229, -12095120, 3279646, -25994264, 13153184, -32192036, -14923735 },
+    { -31938619, -14051887, 25288813, -11962048, 27155504, 16415583, 23129692, -11245444, 28091739, 2530997 }
+  },
+  {
+    { -14387758, 3367720, -18834161, 8958280, 32832172, 14016506, 7792226, -16751697, -5004105, -12084538 },
+    { -20891008, -11267666, 7810735, 853858, -13544260, -11925430, -5920573, 833522, -20338484, 14373232 },
+    { -27956159, 1839074, 30903787, -4071482, 26799694, -13456781, 19439231, 8106367, 15112633, -11824498 }
+  },
+  {
+    { -14228847, -2709402, -20994531, -14062792, -21808853, 282276, 19087141, 8696936, 14629942, -11600236 },
+    { -4348753, -15987779, 1357757, 9701250, -26881709, -8985848, 29481074, 3308220, -11613317, 3959574 },
+    { -23948240, 2784941, 27658808, 9978451, 32024346, -7462061, -3082376, -11911834, 28989534, 12255980 }
+  },
+  {
+    { -2444496, -149937, 29348902, 8186665, 1873760, 12489863, -30934579, -7839692, -7852844, -8138429 },
+    { -15236356, -15433509, 7766470, 746860, 26346930, -10221762, -27333451, 10754588, -9431476, 5203576 },
+    { 31834314, 14135496, -770007, 5159118, 20917671, -16768096, -7467973, -7337524, 31809243, 7347066 }
+  },
+  {
+    { 3726090, 4172485, 17671261, -16756452, 12296416, 10386182, 26754564, -5164171, -9520145, 889881 },
+    { -28881832, -5497732, -29530544, -11406097, -5666715, 4698992, -17934763, -7911760, -24566579, -5458166 },
+    { 18604338, 4503882, -19702828, -15684236, 4536680, 6147654, 999443, 5106248, 18072214, -3575380 }
+  },
+  {
+    { 23714325, 16625584, 24233226, 14843819, -15131472, 3633216, 29744497, 2919717, 24827756, -3255838 },
+    { 3255451, 2085018, 19128936, -2155747, 31392170, -15065400, -21424121, -2213769, 22293421, -8759475 },
+    { 26201334, -8363777, 11995529, -7966058, -26782770, -3483252, 15353899, 6925632, 670970, -3917790 }
+  },
+  {
+    { 10384511, -12969788, -19856657, 10915879, -7691895, 4492720, 16352046, 10797632, -8979019, -1123927 },
+    { 20397822, -13285385, 7346198, -8504036, -29084324, -8495476, 16899734, 14931950, -13554021, 14514997 },
+    { -20248702, 12685066, 16778639, 7490264, 25018482, 3523509, 24958353, -12615174, 15048002, 489901 }
+  },
+  {
+    { -9606723, -11874240, 20414459, 13033986, 13716524, -11691881, 19797970, -12211255, 15192876, -2087490 },
+    { -12663563, -2181719, 1168162, -3804809, 26747877, -14138091, 10609330, 12694420, 33473243, -13382104 },
+    { 33184999, 11180355, 15832085, -11385430, -1633671, 225884, 15089336, -11023903, -6135662, 14480053 }
+  },
+  {
+    { 9801247, 13126175, -23954393, -13541932, -2743039, 10035638, -24455653, 12597709, 2882642, -7363134 },
+    { -4530839, 7698472, 8747132, 5803074, -17095133, 14212241, -5813744, 1275784, 27937543, -5251661 },
+    { 26563193, -13185352, 21826890, 5925671, 30101857, -3134149, 12540498, -13642740, 15737688, 6002520 }
+  },
+  {
+    { 21487358, -7236003, 16456317, -437449, -6218834, 5936684, 32080572, -1426786, 17014562, 10800944 },
+    { -16299633, -10130398, 5442731, 11049968, -20329053, -622205, -33433780, -3012123, 5681051, 16323226 },
+    { 11555755, -15066764, -19381707, 15485982, -5318886, 13011221, -3889239, 12575173, 31917967, 11480537 }
+  },
+  {
+    { -24041384, 1998095, 2837015, -16119376, -2391569, 15537436, 26390771, -11904513, 14937657, -13545568 },
+    { 26315735, -4095870, 30283640, 9004127, -2566652, 14045326, 12983031, -4202226, -20765081, 4289862 },
+    { -4224990, -7714443, -12901336, 9762736, 20536074, 2524923, 18169693, 1607655, 1957895, -4696700 }
+  },
+  {
+    { 31308717, -5619998, 31030840, -1897099, 15674547, -6582883, 5496208, 13685227, 27595050, 8737275 },
+    { -20318852, -15150239, 10933843, -16178022, 8335352, -7546022, -31008351, -12610604, 26498114, 66511 },
+    { 22644454, -8761729, -16671776, 4884562, -3105614, -13559366, 30540766, -4286747, -13327787, -7515095 }
+  }
+},
+{ /* 24/25 */
+  {
+    { -26016874, -219943, 21339191, -41388, 19745256, -2878700, -29637280, 2227040, 21612326, -545728 },
+    { -13077387, 1184228, 23562814, -5970442, -20351244, -6348714, 25764461, 12243797, -20856566, 11649658 },
+    { -10031494, 11262626, 27384172, 2271902, 26947504, -15997771, 39944, 6114064, 33514190, 2333242 }
+  },
+  {
+    { -21433588, -12421821, 8119782, 7219913, -21830522, -9016134, -6679750, -12670638, 24350578, -13450001 },
+    { -4116307, -11271533, -23886186, 4843615, -30088339, 690623, -31536088, -10406836, 8317860, 12352766 },
+    { 18200138, -14475911, -33087759, -2696619, -23702521, -9102511, -23552096, -2287550, 20712163, 6719373 }
+  },
+  {
+    { 26656208, 6075253, -7858556, 1886072, -28344043, 4262326, 11117530, -3763210, 26224235, -3297458 },
+    { -17168938, -14854097, -3395676, -16369877, -19954045, 14050420, 21728352, 9493610, 18620611, -16428628 },
+    { -13323321, 13325349, 11432106, 5964811, 18609221, 6062965, -5269471, -9725556, -30701573, -16479657 }
+  },
+  {
+    { -23860538, -11233159, 26961357, 1640861, -32413112, -16737940, 12248509, -5240639, 13735342, 1934062 },
+    { 25089769, 6742589, 17081145, -13406266, 21909293, -16067981, -15136294, -3765346, -21277997, 5473616 },
+    { 31883677, -7961101, 1083432, -11572403, 22828471, 13290673, -7125085, 12469656, 29111212, -5451014 }
+  },
+  {
+    { 24244947, -15050407, -26262976, 2791540, -14997599, 16666678, 24367466, 6388839, -10295587, 452383 },
+    { -25640782, -3417841, 5217916, 16224624, 19987036, -4082269, -24236251, -5915248, 15766062, 8407814 },
+    { -20406999, 13990231, 15495425, 16395525, 5377168, 15166495, -8917023, -4388953, -8067909, 2276718 }
+  },
+  {
+    { 30157918, 12924066, -17712050, 9245753, 19895028, 3368142, -23827587, 5096219, 22740376, -7303417 },
+    { 2041139, -14256350, 7783687, 13876377, -25946985, -13352459, 24051124, 13742383, -15637599, 13295222 },
+    { 33338237, -8505733, 12532113, 7977527, 9106186, -1715251, -17720195, -4612972, -4451357, -14669444 }
+  },
+  {
+    { -20045281, 5454097, -14346548, 6447146, 28862071, 1883651, -2469266, -4141880, 7770569, 9620597 },
+    { 23208068, 7979712, 33071466, 8149229, 1758231, -10834995, 30945528, -1694323, -33502340, -14767970 },
+    { 1439958, -16270480, -1079989, -793782, 4625402, 10647766, -5043801, 1220118, 30494170, -11440799 }
+  },
+  {
+    { -5037580, -13028295, -2970559, -3061767, 15640974, -6701666, -26739026, 926050, -1684339, -13333647 },
+    { 13908495, -3549272, 30919928, -6273825, -21521863, 7989039, 9021034, 9078865, 3353509, 4033511 },
+    { -29663431, -15113610, 32259991, -344482, 24295849, -12912123, 23161163, 8839127, 27485041, 7356032 }
+  },
+  {
+    { 1371167, -11963634, -2450739, -3466516, -13426033, 12510196, -23372232, 14216383, 19254350, 9028193 },
+    { 18033841, -1040873, 3456561, -11652378, 31146754, 7384082, 26567076, 6662240, -32619486, 10608615 },
+    { -12194008, -3286666, 231243, 14099788, -7970909, -11833777, -10583136, -15331031, -26838109, -9560707 }
+  },
+  {
+    { 12153526, -11777326, -3068316, -8099530, 27745597, -12079103, -29204950, -1690199, -10977255, -640727 },
+    { 11305745, -5085826, -3505220, 3634466, -29522810, 13656962, -26901287, 10992053, 11120354, 2213014 },
+    { 4929294, 11074186, 1093028, -15523645, -5558686, -14198858, -18578744, -147082, 5202741, 4756236 }
+  },
+  {
+    { 4525036, 1638467, 25029482, -8695127, 7889502, -7138222, 2509869, -939849, -24727046, -4164410 },
+    { -20139902, 3157172, -26011260, 4459040, 10079910, -10301950, -13961656, 11589226, 21912285, -9546643 },
+    { 18023022, -400919, -14598257, 6839966, 26295100, 12720126, -11364258, 635719, -24050356, -12268728 }
+  },
+  {
+    { 11296155, -5415070, 546640, 14821338, 2804136, -3023800, 29290312, 6234468, -24576308, -1154020 },
+    { -2413405, -13090070, -78472, 14602504, 24188531, 16228800, -14159026, 3540566, -33145582, 14829313 },
+    { -31961037, -5757656, -18938919, 9349993, -24449333, 2176732, -16007350, -8245301, 29050938, -3537636 }
+  },
+  {
+    { -31227095, 6241277, 25559461, 5959922, 2734298, 495020, -242111, -357512, -871775, -11738931 },
+    { 2402732, 16202435, -31479943, -11741204, 32962728, 6076539, -26557856, -4490980, 2262470, 16010910 },
+    { 1370845, -6635877, -11413705, 8028567, -22684457, 7643896, -3928754, -4572684, 29975657, 15942909 }
+  },
+  {
+    { -3230059, 5098256, -6157219, 2349385, 26921097, -2617527, -21362686, -1139908, 29213956, -5540314 },
+    { -28675651, 5706527, 18921163, 5303521, 12266480, 6329835, -15338429, -975490, 28735052, -12563057 },
+    { 8989419, 6067900, 6669875, -2433881, -20872680, -2085317, 15746033, -9247001, 4487081, 16014383 }
+  },
+  {
+    { 19811918, 7486361, -23654029, -2107447, -14975479, 4140540, 3643083, 7680705, -4787503, 1340723 },
+    { 26486867, -1846391, -22461881, -5302984, 26504326, -10608503, 9150489, -10024221, 25741432, 14608192 },
+    { 15501251, -10502063, 12226672, 9175889, -26549384, 7235223, 24904443, -10941703, -18907114, 6818938 }
+  },
+  {
+    { 12926894, -4621803, -92124, 612986, 27798555, 11958898, -33046416, 8250987, 3985534, 5752383 },
+    { 8181413, -14871953, -4457237, -11061318, 4090619, 8617513, 938880, 3172702, 30667196, -7426963 },
+    { 2684044, -12461844, 13362767, 174928, 1574941, -11969704, 32246114, 1161895, 28861941, 2212274 }
+  }
+},
+{ /* 25/25 */
+  {
+    { -19765507, 2390526, -16551031, 14161980, 1905286, 6414907, 4689584, 10604807, -30190403, 4782747 },
+    { -1354539, 14736941, -7367442, -13292886, 7710542, -14155590, -9981571, 4383045, 22546403, 437323 },
+    { 31665577, -12180464, -16186830, 1491339, -18368625, 3294682, 27343084, 2786261, -30633590, -14097016 }
+  },
+  {
+    { -22448644, 15655569, 7018479, -4410003, -30314266, -1201591, -1853465, 1367120, 25127874, 6671743 },
+    { 29701166, -14373934, -10878120, 9279288, -17568, 13127210, 21382910, 11042292, 25838796, 4642684 },
+    { -20430234, 14955537, -24126347, 8124619, -5369288, -5990470, 30468147, -13900640, 18423289, 4177476 }
+  },
+  {
+    { 20907598, -3658942, 26397451, -11073340, -31142246, 14221016, -23912337, -6179376, -2206935, 11321450 },
+    { -27721707, -1178700, -29627157, -1988626, -23588930, -2977307, 15632966, 2529522, 8920405, -14369895 },
+    { -6598005, -15862216, 9834460, -12919055, -9225676, 7665986, -1527134, 5850767, 800219, 8765288 }
+  },
+  {
+    { -14936374, -8966633, 16035159, -12459047, -28113932, -11200577, 9309498, -699242, 17539307, -14268189 },
+    { -14913844, 2041963, 16152106, -1002060, -17493443, 8032684, -16924778, -2611573, 31650478, -2759542 },
+    { -21329046, -14969697, 9403807, 3956363, 5669425, -9408529, 14897968, 1748830, -7404637, -7530518 }
+  },
+  {
+    { -11401669, -6353295, -11867342, 13525589, 33334853, 13616941, -31209096, 5615463, -4349959, 14199330 },
+    { 11392371, 245287, -8450339, 12894922, 27005984, 16110046, -21763464, -3987569, -20988032, 10340091 },
+    { -28256068, -7687616, 10839938, 3755982, 2153761, -305804, 16674549, 2835922, 15390659, -10028499 }
+  },
+  {
+    { -24298365, -10949360, 2719184, -11441151, 10404192, 7741745, 22729829, -3258360, -14048427, -13318164 },
+    { 7809827, -10774836, -13727819, -3487369, -14616399, -16236688, 9382709, -6547782, 21430925, -1595732 },
+    { 17586195, -7749845, 12602025, -6814782, 2636275, -9024702, -9224124, 5437631, 11329632, 6193547 }
+  },
+  {
+    { 24623330, 12920831, -12976763, 2640548, -2128362, 13898404, -19544286, 13347865, 27896986, -4845001 },
+    { 2440354, -9481499, -8303156, 38052, 31913742, 439810, -11441383, -2846298, 13161246, 6743805 },
+    { -17405570, -1301657, -24801095, -243260, 14758222, -15964615, -1561959, 12523445, 28146425, 256679 }
+  },
+  {
+    { 30994596, 15923823, -27241862, 14674108, -9677648, -15226762, -17942848, -2109512, 13169703, 16280007 },
+    { 1435572, 12474308, 5012448, 15551904, 31734544, -1437433, 17256602, -15128153, -25283664, -11281360 },
+    { 12238178, -14092060, 17201416, -13101938, -33310834, -8847163, 1861226, -771824, -30282702, 11632385 }
+  },
+  {
+    { 13343421, -2001338, 16844942, -8085841, 12622693, 3483330, 9474823, 6339533, -27697083, -9696812 },
+    { 23752421, -6826818, -16440381, 11789163, 24149177, -5221652, 2156507, 10001810, 26553704, 6101454 },
+    { -32544233, 12592510, 8423051, 14588827, 9311673, 2889529, -4012258, 6703731, 25652444, 5554237 }
+  },
+  {
+    { -3076204, -570360, 26748644, 3614869, 16073304, -6122038, -19330883, -14250708, -22901896, 8097128 },
+    { -3071920, -11163227, -28990001, -5375167, 4119450, 1114399, -15351966, 9787566, -12371588, 5822682 },
+    { -31307972, -15740367, -32978253, -13738200, -21616023, -13982309, 11625955, 16502673, -13087631, 109916 }
+  },
+  {
+    { 26592829, -12753630, 1881926, 7771843, 21730591, -931066, -11994512, -9441572, 25683687, -15548159 },
+    { -32499392, -12629607, -4452809, -10129894, -14952759, -4798797, -537422, -2368203, 15711587, 15726649 },
+    { -10543280, 4841925, -30369608, -5662869, -4424296, 11335631, -30394716, -231653, -25808849, 16508234 }
+  },
+  {
+    { -29004168, 12137537, -9291644, 939684, -31652565, 11993054, 24206801, 123570, -41951, -2660533 },
+    { -16544926, 10765766, 32522199, -15839497, -7059235, -15890379, -887889, -8862829, -6144572, -6111558 },
+    { -31004644, 7150990, 31173499, -4856575, -31041115, -1017932, 9215665, 9314632, 2100453, 12738185 }
+  },
+  {
+    { 26733552, -16759218, 5244066, 14353645, -17771783, 14577922, -23661554, 16550996, -21155033, -4640002 },
+    { -8254267, 16569562, -28907343, 3340150, -29186359, 11105895, 3956718, -1056249, -26462991, 12044881 },
+    { 15523454, 12803498, 30482376, -7629674, 2862238, -7956143, -17549221, -7205947, 23489776, -2918583 }
+  },
+  {
+    { -18129587, 5169233, 20514605, 7788344, -24612795, 6069640, -2518978, 7811367, -21315231, -4830878 },
+    { 7610549, 4398182, 27957550, -7531683, -30468721, -1346505, 32164955, 12233118, 20191486, 10337829 },
+    { -1640618, -5415355, -14188560, 2929921, 11407001, -4824312, -17685968, 9641833, 3287789, 4067904 }
+  },
+  {
+    { 17278017, -16596787, -4655540, -14387719, -20113327, -14733795, 27976340, -3939692, 18317204, -13800727 },
+    { -24162918, 720024, -21565264, -13680607, -21710354, 6461173, -17080527, 14831294, 14436775, -8991930 },
+    { 14265347, 9161670, -26439401, -6624127, -4100835, 2505079, -12698846, -11660796, -15039439, -4616452 }
+  },
+  {
+    { -23739239, 12175642, -20909012, -6181563, 5010829, 13707831, 17477840, 7104010, -19240197, -10895057 },
+    { -477089, 10341682, -31642904, -1045100, -3864955, 15033511, 14090074, -5701542, 19720252, -13711114 },
+    { -17231175, -15554091, -31910418, -10042564, 24746366, -3617448, -19512878, -11548281, 68185, 11397287 }
+  }
+}
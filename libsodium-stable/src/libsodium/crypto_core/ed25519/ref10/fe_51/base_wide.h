@@ -0,0 +1,2132 @@
+{ /* 0/25 */
+  {
+    { 1288382639258501, 245678601348599, 269427782077623, 1462984067271730, 137412439391563 },
+    { 62697248952638, 204681361388450, 631292143396476, 338455783676468, 1213667448819585 },
+    { 301289933810280, 1259582250014073, 1422107436869536, 796239922652654, 1953934009299142 }
+  },
+  {
+    { 1380971894829527, 790832306631236, 2067202295274102, 1995808275510000, 1566530869037010 },
+    { 463307831301544, 432984605774163, 1610641361907204, 750899048855000, 1894842303421586 },
+    { 748439484463711, 1033211726465151, 1396005112841647, 1611506220286469, 1972177495910992 }
+  },
+  {
+    { 1601611775252272, 1720807796594148, 1132070835939856, 1260455018889551, 2147779492816911 },
+    { 316559037616741, 2177824224946892, 1459442586438991, 1461528397712656, 751590696113597 },
+    { 1850748884277385, 1200145853858453, 1068094770532492, 672251375690438, 1586055907191707 }
+  },
+  {
+    { 934282339813791, 1846903124198670, 1172395437954843, 1007037127761661, 1830588347719256 },
+    { 1694390458783935, 1735906047636159, 705069562067493, 648033061693059, 696214010414170 },
+    { 1121406372216585, 192876649532226, 190294192191717, 1994165897297032, 2245000007398739 }
+  },
+  {
+    { 769950342298419, 132954430919746, 844085933195555, 974092374476333, 726076285546016 },
+    { 425251763115706, 608463272472562, 442562545713235, 837766094556764, 374555092627893 },
+    { 1086255230780037, 274979815921559, 1960002765731872, 929474102396301, 1190409889297339 }
+  },
+  {
+    { 1388594989461809, 316767091099457, 394298842192982, 1230079486801005, 1440737038838979 },
+    { 7380825640100, 146210432690483, 304903576448906, 1198869323871120, 997689833219095 },
+    { 1181317918772081, 114573476638901, 262805072233344, 265712217171332, 294181933805782 }
+  },
+  {
+    { 665000864555967, 2065379846933859, 370231110385876, 350988370788628, 1233371373142985 },
+    { 2019367628972465, 676711900706637, 110710997811333, 1108646842542025, 517791959672113 },
+    { 965130719900578, 247011430587952, 526356006571389, 91986625355052, 2157223321444601 }
+  },
+  {
+    { 2068619540119183, 1966274918058806, 957728544705549, 729906502578991, 159834893065166 },
+    { 2073601412052185, 31021124762708, 264500969797082, 248034690651703, 1030252227928288 },
+    { 551790716293402, 1989538725166328, 801169423371717, 2052451893578887, 678432056995012 }
+  },
+  {
+    { 1802695059465007, 1664899123557221, 593559490740857, 2160434469266659, 927570450755031 },
+    { 1725674970513508, 1933645953859181, 1542344539275782, 1767788773573747, 1297447965928905 },
+    { 1381809363726107, 1430341051343062, 2061843536018959, 1551778050872521, 2036394857967624 }
+  },
+  {
+    { 1569908045411470, 706723917266915, 1500941167088851, 271058246676941, 1190527933001305 },
+    { 938493881647581, 1913928661987006, 2094455298711648, 986546367603450, 58515486184715 },
+    { 1454533688490200, 416156769327623, 1344514353803379, 1816391251363763, 259908591619060 }
+  },
+  {
+    { 1970894096313054, 528066325833207, 1619374932191227, 2207306624415883, 1169170329061080 },
+    { 2070390218572616, 1458919061857835, 624171843017421, 1055332792707765, 433987520732508 },
+    { 893653801273833, 1168026499324677, 1242553501121234, 1306366254304474, 1086752658510815 }
+  },
+  {
+    { 1548398643541305, 838955728976966, 116266075650295, 1878116023572280, 132675799667661 },
+    { 2114866412082361, 591083254091949, 940561138633470, 412059816539947, 2134627974686210 },
+    { 1571032457823571, 1253760059932116, 665829584253800, 109400965270906, 981221002823741 }
+  },
+  {
+    { 213454002618221, 939771523987438, 1159882208056014, 317388369627517, 621213314200687 },
+    { 1971678598905747, 338026507889165, 762398079972271, 655096486107477, 42299032696322 },
+    { 177130678690680, 1754759263300204, 1864311296286618, 1180675631479880, 1292726903152791 }
+  },
+  {
+    { 124159973735922, 12085856625887, 570609322991103, 870869641855508, 1947192330052817 },
+    { 996453150823040, 557931626380283, 1039170142840520, 115485616863415, 808203906823112 },
+    { 498660636760962, 1605652986893012, 893278769679967, 1769999239723039, 646478004325289 }
+  },
+  {
+    { 1913163449625248, 460779200291993, 2193883288642314, 1008900146920800, 1721983679009502 },
+    { 1070401523076875, 1272492007800961, 1910153608563310, 2075579521696771, 1191169788841221 },
+    { 692896803108118, 500174642072499, 2068223309439677, 1162190621851337, 1426986007309901 }
+  },
+  {
+    { 1412482364088822, 1810590036362821, 923779398567548, 2023841154802081, 355905946953295 },
+    { 89929455382003, 409881867087833, 601740464114195, 1198413365513369, 1353640795548072 },
+    { 1825728698698411, 497946242397168, 105715611816086, 968568072676853, 592999326381074 }
+  }
+},
+{ /* 1/25 */
+  {
+    { 1982622644432056, 2014393600336956, 128909208804214, 1617792623929191, 105294281913815 },
+    { 980234343912898, 1712256739246056, 588935272190264, 204298813091998, 841798321043288 },
+    { 197561292938973, 454817274782871, 1963754960082318, 2113372252160468, 971377527342673 }
+  },
+  {
+    { 794524995833413, 1849907304548286, 53348672473145, 1272368559505217, 1147304168324779 },
+    { 1504846112759364, 1203096289004681, 562139421471418, 274333017451844, 1284344053775441 },
+    { 483048732424432, 2116063063343382, 30120189902313, 292451576741007, 1156379271702225 }
+  },
+  {
+    { 748123900738723, 2239140288387656, 322477057520882, 393173627734548, 1290933190145309 },
+    { 106518640742844, 984674612580210, 300810941301077, 1847778052863102, 1252302570260833 },
+    { 2218076336525385, 339947754397137, 1735892619490, 1441988709036711, 932991353908008 }
+  },
+  {
+    { 423177393666002, 81745418621691, 2028971153113313, 476357540333955, 1525930694244524 },
+    { 2111527632783832, 450040158835276, 2024085682500627, 1804656400081649, 1628769314539400 },
+    { 1435691822393684, 1850026012837208, 2218717487026642, 81859254010196, 244808221751742 }
+  },
+  {
+    { 240926297106744, 1484603468873016, 211374054712375, 2174528716017124, 2102319798003376 },
+    { 201490184422996, 1430226075823072, 1590438952458810, 1043100298986572, 996894416545175 },
+    { 472944491312913, 1384790305004554, 1778189765345105, 1598862570437896, 213614412209990 }
+  },
+  {
+    { 716669116169929, 1188055609443829, 1393721681141128, 1973577243912927, 1619241114669502 },
+    { 1143996060716970, 875276423664526, 978750810123940, 1496005210694645, 1796311493993286 },
+    { 689732974960969, 1149694494797763, 34666016056848, 998690978315409, 1354271921124160 }
+  },
+  {
+    { 2106273162427187, 252812780214586, 990368180146863, 303666997649525, 598398948476041 },
+    { 1732812508157850, 1938646508379112, 1178555870966108, 1668799299728871, 1682686212203884 },
+    { 1317989739078862, 2091808081627199, 2131778561189098, 1093597680131246, 667689068451005 }
+  },
+  {
+    { 821837003520378, 1758499246064311, 611427618116979, 1826926617406750, 190751450672812 },
+    { 1899219292317099, 301143383160140, 1505423608269154, 262436526053886, 1603944942225467 },
+    { 1428688544729295, 109069749881410, 270830364539996, 1755181768867140, 162349670944771 }
+  },
+  {
+    { 413697308896272, 699134461586886, 711015030907047, 1299876542002, 832305981626214 },
+    { 565499889088674, 751683022690201, 1153353920866673, 479317048114822, 1114414346729200 },
+    { 952340031139928, 2138102993568440, 1606889213039914, 166919511679670, 717893816202340 }
+  },
+  {
+    { 518843098730077, 691570479886707, 1060582056459323, 428039850528040, 2034179537060677 },
+    { 2056597642290698, 1046561792437087, 984312131004873, 966661265733746, 1765752713684574 },
+    { 1986058137797378, 1434580626693337, 966814340967020, 502425303678510, 1066330051859875 }
+  },
+  {
+    { 682288735387347, 307964577169723, 1297694910860965, 65014380107452, 1099823476578138 },
+    { 1827631150975132, 1045479367173851, 1999947219314874, 2196955488651286, 730377382901712 },
+    { 1623598009048187, 1014844876644353, 871714129530196, 813891329549000, 507587707143124 }
+  },
+  {
+    { 387321772446342, 157157592651549, 1734448286334816, 737995238873311, 2164082093074358 },
+    { 138427770525630, 1006458583514274, 50156603826175, 564841532066850, 1867325910960689 },
+    { 309881142350067, 2106019349943259, 816133263871674, 2018031260992166, 1563425406132832 }
+  },
+  {
+    { 683676082606588, 949275451828816, 2120840305454211, 444385807761591, 387195881600984 },
+    { 645200600588590, 562546169747253, 156186764608191, 2235471020771491, 273215864888271 },
+    { 1174467518774776, 1720687219579664, 1460314689686527, 1234315554419367, 10342280797801 }
+  },
+  {
+    { 636266545979769, 1196678303499110, 1544042804952052, 390348891242074, 2154007392837602 },
+    { 1639688611092348, 1650093789575836, 1655732950498695, 740816158202830, 660499420339501 },
+    { 119472839998080, 306976601680874, 1752396185972949, 389264399846114, 716403171730209 }
+  },
+  {
+    { 619982547023359, 507151035019806, 1394235460635684, 213108763323576, 428287479820651 },
+    { 1218779158586662, 207160811231456, 511838183164909, 1587562924076948, 1109498130852034 },
+    { 990348128231819, 2171729958991420, 73723086835884, 1704262857642441, 1782896286691103 }
+  },
+  {
+    { 1498799085180043, 1744340656397133, 2064851197592072, 178034001090864, 2145324400616904 },
+    { 2143695105244535, 759647590919964, 1665346117918695, 508167339935601, 1875842900408800 },
+    { 614788980313577, 1501513053451003, 1472055221710495, 1920317897819127, 2208964791748263 }
+  }
+},
+{ /* 2/25 */
+  {
+    { 1907837041515237, 898421797873440, 1363421772307007, 1869148099628409, 252053503603382 },
+    { 1983475287633675, 383067298392598, 1529372645239762, 271237723417042, 16306006127885 },
+    { 45902352975738, 1246446699820833, 173320410042641, 1542230462600972, 692910725375140 }
+  },
+  {
+    { 710084928405467, 2105676789486896, 168843193799662, 353334820683649, 1050869817514446 },
+    { 2234556940968142, 508383103687203, 548677296961294, 1801756227307155, 763581134184080 },
+    { 2191680341805656, 1972509245077282, 981795995975654, 852454486043614, 1189735660434765 }
+  },
+  {
+    { 1743977233997800, 1581920097003352, 192244940755923, 2232313400412572, 1420975603500953 },
+    { 394331370968199, 375506683250477, 178987122837126, 1628597680090539, 1981626777721129 },
+    { 1931343025077052, 1393738210614177, 622857924319466, 1123524882306454, 1963513295012502 }
+  },
+  {
+    { 1850504730697909, 2129879659168370, 2011448898092861, 2090154061858281, 1857166627539261 },
+    { 93122640069162, 80390620181922, 904913824687012, 878714325670358, 2009239140681625 },
+    { 1509035496076582, 1583601071466027, 421912810565136, 1678479534084506, 2033502297510813 }
+  },
+  {
+    { 2238137325796934, 1165391281982950, 2048774700033766, 1309041739154703, 952882074105884 },
+    { 648683464284688, 918118399351936, 1745356360731796, 498388366566450, 2218312233818996 },
+    { 520151332809519, 1588829471961614, 2166353389460390, 404024831468766, 1335244071323823 }
+  },
+  {
+    { 276674675630644, 2071299735249834, 367425156502024, 1019665374394195, 1519932762444250 },
+    { 140650035965992, 4102126210825, 1340382612618316, 1431330732152485, 95392378361840 },
+    { 1935180256227856, 250757393177447, 1959439731378182, 1297506762666169, 575184640324100 }
+  },
+  {
+    { 1312014106178185, 1486712601904121, 727281996805526, 1807789883906315, 1294755680282130 },
+    { 1746208083129163, 286040119208595, 923407701729416, 1058134233102422, 2156333962869932 },
+    { 1438068615152094, 34949160848567, 1911746456436447, 1412684293826264, 1046374507505090 }
+  },
+  {
+    { 1493476678908327, 1067355251760666, 2088667670293412, 1347426012722422, 874958688794590 },
+    { 1106398809275628, 1328345218773061, 1782306826891988, 2161245407418976, 674877440657824 },
+    { 1428599160764785, 602821281250279, 1877258833313507, 333285098655770, 740310036947361 }
+  },
+  {
+    { 317431275767464, 1518352325643055, 1017739272243784, 131225281369735, 2248498609425138 },
+    { 2185938567848735, 7830587710417, 120201083722985, 1606359356887502, 1540314436818236 },
+    { 375535123602711, 924645774628115, 2045840727994073, 766250909414083, 1069698092749769 }
+  },
+  {
+    { 1648059230526694, 806437617638909, 1669265990252614, 1557023953019450, 1861135005644936 },
+    { 2183494317018394, 431280190007147, 1346280639008465, 2144569274614585, 1690834549380148 },
+    { 1352954153117419, 632457759471481, 85028188501619, 1852310027888311, 1569233778435479 }
+  },
+  {
+    { 1177033227220429, 1414982090591775, 1722841418062421, 980376562317675, 1625133154241834 },
+    { 491008111856233, 1298090237777443, 98870311764798, 759375037494073, 1325940420401793 },
+    { 478074309368979, 623121553345246, 885068774570210, 117698677138481, 109006840646140 }
+  },
+  {
+    { 1476961150268616, 69354429918369, 737795879830107, 1157931145550899, 2062873179003704 },
+    { 976783963761511, 1433695152478636, 1608095770825631, 1880765678109962, 1350718651958898 },
+    { 1329749333731727, 46254713998516, 373767480531871, 1933047124368118, 430092326122748 }
+  },
+  {
+    { 231642736627077, 1364013097423553, 606627474627588, 2135393495237611, 596254727540093 },
+    { 1816819588730494, 1703996634030255, 1472778532685586, 2085732496367231, 2000652244807656 },
+    { 8959488931169, 1768025271694380, 2157573235225770, 292082063715064, 330646837880843 }
+  },
+  {
+    { 1682783588724042, 399675063705792, 965357158907407, 1910483514645702, 1644451034905796 },
+    { 625421168776264, 1072313529331098, 140084527136792, 549153666664274, 124282572287672 },
+    { 976078747227308, 1952905065031031, 949292862704054, 1492592732072346, 1010921457352162 }
+  },
+  {
+    { 712043135351088, 1110443523197924, 118666337002710, 2051405852060770, 1998735788124574 },
+    { 1754610701142467, 2115564038671618, 856374256959303, 1148042632707004, 1399605648276789 },
+    { 629291283140720, 1484410172308977, 1230690465849055, 1563468011476927, 1425159147311735 }
+  },
+  {
+    { 717255318455100, 519313764361315, 2080406977303708, 541981206705521, 774328150311600 },
+    { 261715221532238, 1795354330069993, 1496878026850283, 499739720521052, 389031152673770 },
+    { 1997217696294013, 1717306351628065, 1684313917746180, 1644426076011410, 1857378133465451 }
+  }
+},
+{ /* 3/25 */
+  {
+    { 471657679736049, 36304457446248, 1889807602666694, 571526543144584, 2151183507738315 },
+    { 1320619393211836, 1830783765803799, 733116888584824, 192154761237340, 1836129819319417 },
+    { 216379584390389, 359329711860756, 2220840445637019, 1935487238453911, 314381139238943 }
+  },
+  {
+    { 1354120322856557, 1315215183190037, 873849392207479, 969776210885688, 1552605391252884 },
+    { 62769891776663, 1685142666023085, 443051725399699, 1094137944849531, 1786990183014737 },
+    { 758252632702114, 914226082256766, 434171717412081, 779505540917105, 51590353584795 }
+  },
+  {
+    { 411808451074640, 2105855808111832, 1544120735347360, 1337192426203247, 554754518107071 },
+    { 1425492357109559, 865850649486344, 215639866084739, 2110361447395184, 1214036906704351 },
+    { 2036310356419974, 1862941437683537, 2122628002305950, 427826430955887, 291402007632220 }
+  },
+  {
+    { 1608170971973096, 415809060360428, 1350468408164766, 2038620059057678, 1026904485989112 },
+    { 1837656083115103, 1510134048812070, 906263674192061, 1821064197805734, 565375124676301 },
+    { 578027192365650, 2034800251375322, 2128954087207123, 478816193810521, 2196171989962750 }
+  },
+  {
+    { 486799646208464, 1954741746371391, 599244162298817, 764911182067923, 1119314483065209 },
+    { 917617711079428, 2000908020759071, 67062208032578, 269886536216889, 794102734522411 },
+    { 1659547183874312, 1160992046637689, 115862046651144, 721750944787551, 553639199252871 }
+  },
+  {
+    { 222649147765230, 1244342055433210, 260212389089708, 750651607773942, 1416930622993378 },
+    { 978700433517105, 661498765597157, 923796644390494, 425042672855163, 1161006472261563 },
+    { 2052192104527388, 1670439396947783, 1365143255754144, 321214057777507, 1623893732838030 }
+  },
+  {
+    { 766485616863355, 185846422186304, 622697389167409, 1397282616236871, 1403664093647337 },
+    { 2187445915863115, 1567887873700238, 1490192810453810, 1229276594560986, 1628358773775064 },
+    { 1667454255937431, 1466524613972708, 1991366627974407, 1283865324159873, 951057717299277 }
+  },
+  {
+    { 1633188840273139, 852787172373708, 1548762607215796, 1266275218902681, 1107218203325133 },
+    { 462189358480054, 1784816734159228, 1611334301651368, 1303938263943540, 707589560319424 },
+    { 1038829280972848, 38176604650029, 753193246598573, 1136076426528122, 595709990562434 }
+  },
+  {
+    { 1179291724021934, 2135086029559761, 1310959933924188, 1038624650757648, 1397826829060106 },
+    { 177430163044496, 567245755530253, 373303234063068, 761118347856525, 2052772390285268 },
+    { 329210437128923, 534894741393748, 1127953928312911, 1202525317028321, 2152490543503365 }
+  },
+  {
+    { 2102214505332835, 1838940233011699, 251609668505654, 290942303809962, 1848549969618808 },
+    { 747501458420425, 954222199322869, 530194071067823, 1352800688468148, 1359323968428652 },
+    { 745974963505604, 2182623307274379, 929454982287594, 1928935065380062, 6620650377507 }
+  },
+  {
+    { 1267125746220324, 157079328970999, 1435198339381366, 333919294520225, 2157107865890357 },
+    { 54230113346551, 1548444340485407, 1502990405125363, 1383293293731590, 2097326762253969 },
+    { 1841606478231627, 361961350929299, 1230707688051911, 1872042866337718, 1800439317692451 }
+  },
+  {
+    { 1408451820859834, 2194984964010833, 2198361797561729, 1061962440055713, 1645147963442934 },
+    { 4701053362120, 1647641066302348, 1047553002242085, 1923635013395977, 206970314902065 },
+    { 1750479161778571, 1362553355169293, 1891721260220598, 966109370862782, 1024913988299801 }
+  },
+  {
+    { 1755814380100345, 987947382040385, 2045909051968813, 596166711338152, 590415265120010 },
+    { 1483939481037711, 1699005245098844, 947117724797150, 208511819939529, 882149497375655 },
+    { 670127973180808, 1909319231742221, 159615638555729, 404115291023205, 1019209553440563 }
+  },
+  {
+    { 462155829227911, 1975377407615080, 2042223714016128, 2246515598358375, 720540772935175 },
+    { 747027490450779, 331875678733161, 191832232451572, 1856548616787027, 1959559821319422 },
+    { 2138327645973426, 2065563746138428, 1458791106909595, 1224144005653688, 630204198065225 }
+  },
+  {
+    { 119992929148774, 1313934413100793, 1233909198950557, 1173318763689962, 1057047143342356 },
+    { 1726614263927506, 500595945482013, 1786986978415014, 1328040149744767, 1515110674745662 },
+    { 845119277029676, 546256359445244, 1053209421632273, 1597525808988209, 1321443535664119 }
+  },
+  {
+    { 212699049131723, 1117950018299775, 1873945661751056, 1403802921984058, 130896082652698 },
+    { 636808533673210, 1262201711667560, 390951380330599, 1663420692697294, 561951321757406 },
+    { 520731594438141, 1446301499955692, 273753264629267, 1565101517999256, 1019411827004672 }
+  }
+},
+{ /* 4/25 */
+  {
+    { 1364039144731711, 1897497433586190, 2203097701135459, 145461396811251, 1349844460790699 },
+    { 1045230323257973, 818206601145807, 630513189076103, 1672046528998132, 807204017562437 },
+    { 439961968385997, 386362664488986, 1382706320807688, 309894000125359, 2207801346498567 }
+  },
+  {
+    { 1229004686397588, 920643968530863, 123975893911178, 681423993215777, 1400559197080973 },
+    { 2003766096898049, 170074059235165, 1141124258967971, 1485419893480973, 1573762821028725 },
+    { 729905708611432, 1270323270673202, 123353058984288, 426460209632942, 2195574535456672 }
+  },
+  {
+    { 1271140255321235, 2044363183174497, 52125387634689, 1445120246694705, 942541986339084 },
+    { 1761608437466135, 583360847526804, 1586706389685493, 2157056599579261, 1170692369685772 },
+    { 871476219910823, 1878769545097794, 2241832391238412, 548957640601001, 690047440233174 }
+  },
+  {
+    { 297194732135507, 1366347803776820, 1301185512245601, 561849853336294, 1533554921345731 },
+    { 999628998628371, 1132836708493400, 2084741674517453, 469343353015612, 678782988708035 },
+    { 2189427607417022, 699801937082607, 412764402319267, 1478091893643349, 2244675696854460 }
+  },
+  {
+    { 1712292055966563, 204413590624874, 1405738637332841, 408981300829763, 861082219276721 },
+    { 508561155940631, 966928475686665, 2236717801150132, 424543858577297, 2089272956986143 },
+    { 221245220129925, 1156020201681217, 491145634799213, 542422431960839, 828100817819207 }
+  },
+  {
+    { 153756971240384, 1299874139923977, 393099165260502, 1058234455773022, 996989038681183 },
+    { 559086812798481, 573177704212711, 1629737083816402, 1399819713462595, 1646954378266038 },
+    { 1887963056288059, 228507035730124, 1468368348640282, 930557653420194, 613513962454686 }
+  },
+  {
+    { 1224529808187553, 1577022856702685, 2206946542980843, 625883007765001, 279930793512158 },
+    { 1076287717051609, 1114455570543035, 187297059715481, 250446884292121, 1885187512550540 },
+    { 902497362940219, 76749815795675, 1657927525633846, 1420238379745202, 1340321636548352 }
+  },
+  {
+    { 1129576631190784, 1281994010027327, 996844254743018, 257876363489249, 1150850742055018 },
+    { 628740660038789, 1943038498527841, 467786347793886, 1093341428303375, 235413859513003 },
+    { 237425418909360, 469614029179605, 1512389769174935, 1241726368345357, 441602891065214 }
+  },
+  {
+    { 256269894881655, 731087473525590, 1712829089863355, 1739545432690564, 1853100260794477 },
+    { 762634428407485, 914699280277969, 1907787519177201, 980988034818443, 1758095138401930 },
+    { 4642168584761, 1314096799362798, 1620739012635580, 444075187404753, 76135520441225 }
+  },
+  {
+    { 1717340294466846, 894010493775439, 1904170181110299, 1698314560575378, 2248427553137503 },
+    { 664232887435505, 906405014034017, 1557824336159424, 270380422518437, 1526479053144758 },
+    { 1356583144121446, 1439603152129038, 880464721166116, 426511648446184, 1044401386572766 }
+  },
+  {
+    { 1430891268582688, 1935676112917302, 918476809294643, 624233316991390, 1596266630249200 },
+    { 1575473650472430, 967253993350338, 1983977008222547, 928647195161666, 170861031434441 },
+    { 1484505136430423, 343818915658679, 1066931341976591, 1574952097402529, 895157643469052 }
+  },
+  {
+    { 2193735258244385, 13942854467965, 549801847492973, 1573679250261670, 2218164822512395 },
+    { 2132610855338939, 314844271876603, 2026649627971043, 1205053707864054, 2037006012910569 },
+    { 125908919015544, 908539856510216, 254196493329521, 1841783557943867, 1826956209112337 }
+  },
+  {
+    { 1218465765165773, 1222399589933778, 1897798290509556, 56200133600723, 278637912813060 },
+    { 1764048760908459, 870662304967533, 255906313198924, 1183161537014186, 1158717372378153 },
+    { 1352017428769842, 1226345478088737, 1834808987089176, 171935268241134, 1252599135760918 }
+  },
+  {
+    { 269241043449631, 1713401415896622, 808940841959443, 2228155591500883, 21723429550182 },
+    { 2140114154635772, 1139746460367841, 1009078681939033, 1841964102409991, 1982139153156902 },
+    { 994025955714788, 1395495501299355, 1717525291885154, 64780760930213, 1492125616744822 }
+  },
+  {
+    { 607657959766893, 341003272737447, 761249806099562, 2103923803467650, 437155965158728 },
+    { 2244771924854810, 1634082933647495, 1913546366257171, 85613129382467, 745552826499669 },
+    { 686675614020084, 1129369471718576, 1361332769753183, 814390480194826, 1958437091006724 }
+  },
+  {
+    { 1326059070986772, 1683859889439034, 800400358642626, 1553800812119228, 1435890639134217 },
+    { 10289322871173, 960938633288362, 54790899094325, 355480603420821, 769816521286162 },
+    { 1081752225631401, 201284952113932, 1619339403526661, 1533363030164674, 1727571790703503 }
+  }
+},
+{ /* 5/25 */
+  {
+    { 319638829540294, 596282656808406, 2037902696412608, 1557219121643918, 341938082688094 },
+    { 1901860206695915, 2004489122065736, 1625847061568236, 973529743399879, 2075287685312905 },
+    { 1371853944110545, 1042332820512553, 1949855697918254, 1791195775521505, 37487364849293 }
+  },
+  {
+    { 1812471844975748, 1856491995543149, 126579494584102, 1036244859282620, 1975108050082550 },
+    { 650623932407995, 1137551288410575, 2125223403615539, 1725658013221271, 2134892965117796 },
+    { 522584000310195, 1241762481390450, 1743702789495384, 2227404127826575, 1686746002148897 }
+  },
+  {
+    { 2204538589507476, 891043427298747, 199776800605413, 952417190022837, 635674663503434 },
+    { 2198333491841156, 555629646782191, 479238297408146, 1907252492795906, 2038569943093712 },
+    { 510455031824465, 465163402943305, 2022658124081289, 1881132727821470, 31746160856543 }
+  },
+  {
+    { 1171837083014025, 264732902278699, 1770010974323604, 266108208353474, 2020794083615322 },
+    { 293218709634113, 1719011489643599, 831619655945737, 1611022286286405, 2006064581746788 },
+    { 762321251771152, 1460210191529427, 2248797163104578, 217468651569622, 63003536153574 }
+  },
+  {
+    { 1253926392372274, 487954410348947, 105208478723800, 287609073983821, 551052366059500 },
+    { 480324482088798, 547821943377221, 1008880811730814, 229616966517108, 2187910192957436 },
+    { 382772988420084, 377268858355321, 2014446499231184, 1791684686627115, 1858385890274879 }
+  },
+  {
+    { 1468942521262663, 965285477748964, 1357339318615791, 453619687037093, 27583008856420 },
+    { 1785441127249196, 1692788790252292, 2030249112109248, 641340745250383, 1525476155656051 },
+    { 147617576924232, 750543836338826, 216515763171698, 448683940021842, 666426848177047 }
+  },
+  {
+    { 257778042578872, 24608579957679, 1528237364405256, 2008961667970794, 1766606190227381 },
+    { 1058899921801710, 83343181050531, 1801405111725810, 114408790349771, 709509117086787 },
+    { 1874277793138111, 1626529073509303, 151495790219656, 455240507092903, 706271551856999 }
+  },
+  {
+    { 391588043113892, 2202456919563943, 1617888818929289, 694159965511217, 2143606811138355 },
+    { 2008058364358132, 1051355690609066, 1659991296428347, 1022293360838405, 1042097367448254 },
+    { 719793864170869, 1411477466905009, 1515019021063010, 1483421690183889, 1704042941619334 }
+  },
+  {
+    { 1403761197126057, 2078598970957846, 1322929741411900, 1567306659790424, 1173285022924932 },
+    { 960589681362441, 706280137808542, 1229199323405406, 1538736872374776, 2018028444441884 },
+    { 2197022808271474, 1407143108986688, 1009817116705041, 71531789689040, 1896193213410282 }
+  },
+  {
+    { 1697781430640218, 1520304010377028, 781380208437990, 1793414410548913, 2166524336512075 },
+    { 565939882927894, 2119253489526995, 1435475806966004, 302446209351656, 17168463162684 },
+    { 164417108933475, 604787902585307, 1893481489487087, 942194265644630, 1933835561033231 }
+  },
+  {
+    { 1774831837164273, 870369497426874, 974084587952276, 825762959138234, 88446696097701 },
+    { 1735923830729967, 663964653130785, 704207531815736, 791502858216208, 1884688385386861 },
+    { 2079995305370875, 506117157505057, 1787295940729509, 1211999097803487, 2178718943974512 }
+  },
+  {
+    { 517835973347256, 706523709933216, 1537480429839773, 1483278086593314, 1378968978067758 },
+    { 783163454514521, 1366624508143284, 1863506003869690, 917979662972397, 1583895088313562 },
+    { 1315034452637574, 1172434640681242, 1135533609020364, 253349230877293, 161211572823476 }
+  },
+  {
+    { 696598964903212, 1843045426770307, 1415827342374723, 484038355219880, 1303557951944390 },
+    { 1616401163666585, 1916649121027360, 517784282068026, 1097139464632440, 1923807788916222 },
+    { 459941859277134, 516821055271895, 1926620716890555, 998592915107636, 1153917797071778 }
+  },
+  {
+    { 1459464209890149, 1978794890227345, 385000036933387, 789502095080917, 1056031385523015 },
+    { 1217063695723907, 336836783652230, 117343635436620, 2222371127823246, 1880951187948926 },
+    { 248998074417769, 1966462008064165, 54036384105462, 2047689206076670, 2065762857952013 }
+  },
+  {
+    { 57215567913777, 1938282035004120, 2057398012901067, 1439291273533426, 1694633904445394 },
+    { 925373380955341, 181534320494844, 802421407686171, 1177141761303107, 326024465005379 },
+    { 2146639653517188, 202546770944767, 774949134039784, 631237699522153, 449667013680072 }
+  },
+  {
+    { 407608189412637, 2049444491227494, 342891130347629, 1169428941568801, 848234126951058 },
+    { 1690850439525075, 1667024303418336, 1749847485823236, 736954918508817, 531773443234823 },
+    { 437225545901468, 888271756229202, 903344393515123, 162913205438885, 1475178706291532 }
+  }
+},
+{ /* 6/25 */
+  {
+    { 1179642228804668, 1418657644034850, 675683856213334, 596096446428822, 1170437361620647 },
+    { 1511564286472767, 2184358636968286, 1412906036411316, 89284351539568, 352068421522218 },
+    { 1907217462504765, 679044428705663, 1371479879514675, 1420793148384765, 190685345044087 }
+  },
+  {
+    { 1276705999322783, 1661230352625442, 1205734973860699, 784019563379976, 1449546143149561 },
+    { 637296935955637, 450944727568131, 645072163640910, 309713610901635, 311189073223217 },
+    { 2213525665395526, 146358659614731, 1573034916169973, 1131167148341295, 1194403623212224 }
+  },
+  {
+    { 2105305689409187, 1932040296635725, 307501795091619, 1653053081843051, 1246676406522367 },
+    { 782790693528855, 1519731603158914, 2028140081496226, 1275020033363837, 2056444369633135 },
+    { 1916484225176, 1896106466807315, 1279953155660650, 1725386140841619, 757101416534772 }
+  },
+  {
+    { 2133488547373098, 633134528408434, 1652284377802153, 2035540453530543, 489273649398225 },
+    { 2051614458366870, 728789063070456, 282245488169187, 2178894003553741, 1855341936085133 },
+    { 655928016394658, 1087485647128905, 1281789693328119, 2088439151211398, 1863153332596984 }
+  },
+  {
+    { 210017655980803, 1811183847825904, 1323101412046938, 1360571080713195, 1716626899554003 },
+    { 716543727419056, 2051592790034539, 1445865707531046, 863515409408522, 1102874443417899 },
+    { 1790273650925445, 2180187262630477, 28219260774301, 1951582862584504, 1059160821201578 }
+  },
+  {
+    { 857134543659225, 571584078624683, 457976954128720, 480578452053593, 1695118712507850 },
+    { 1455060305288896, 1678698521692147, 955042089053421, 482480751768889, 972076543638923 },
+    { 95538772778706, 1914880923031197, 417513632407841, 1767845086605839, 832379724270193 }
+  },
+  {
+    { 1456443406045738, 1909385161475434, 816382632051404, 1426587922914898, 2166890266198132 },
+    { 629341497594299, 294953389516334, 1800301282775361, 2224016821184931, 924802345871186 },
+    { 393110820654303, 662371396172458, 1370237312917823, 2034119121136113, 904928937827 }
+  },
+  {
+    { 1257344135899307, 524694436287172, 1637109398723535, 1801319038042246, 2082644998926031 },
+    { 571822557710951, 195833865463720, 1444687327784978, 1429898638089182, 1938057576257967 },
+    { 189274223123103, 2188109173279445, 1461570511269332, 151886143484743, 1557837550414982 }
+  },
+  {
+    { 1853425141155930, 1562248478016912, 1805828417935850, 1548444252518409, 1509442962180566 },
+    { 2113566004905728, 676606596444694, 531774910260309, 1451617262003405, 1925547617906272 },
+    { 966697507230426, 1689614203301123, 867370120071235, 563108996765880, 1552869095947518 }
+  },
+  {
+    { 428710350733830, 873472483018412, 228735397183971, 464721098622881, 1141684153257222 },
+    { 1687012995398915, 758517156051015, 1267223406584338, 389079174105648, 1537526322499142 },
+    { 1871952745325912, 144470913279784, 434631777342778, 552837449330893, 642852750438644 }
+  },
+  {
+    { 1809358219650842, 87860747263326, 158784625452665, 1286742564054195, 1381620064520781 },
+    { 251909128622990, 1402068879946426, 1377262896768859, 993060530359482, 2229211226216284 },
+    { 64765075641768, 68764899017819, 1968408548264810, 2037002115471749, 211556643344747 }
+  },
+  {
+    { 1049209717975987, 425659265579626, 455526653534993, 9855624744769, 710846537165111 },
+    { 1040026214336160, 57029633653833, 228151855733274, 1803649920231128, 509157472065208 },
+    { 1579401584164790, 1951017356653076, 1801209077919862, 1153368800641031, 1775772413220140 }
+  },
+  {
+    { 547036285871787, 2002468979873229, 1132424890166086, 136604638013560, 664387721246095 },
+    { 1304517784822193, 1430651666034031, 1924728018029076, 736369304009705, 3004372386002 },
+    { 1947208168676528, 1750536949518976, 835780038339521, 1802624114603814, 1867663782159356 }
+  },
+  {
+    { 267867967690637, 1132412577764720, 71131066313735, 1660817657158453, 554776769494619 },
+    { 847731813737569, 398133653202307, 931247096073091, 2120348411520248, 2124450702434442 },
+    { 1273923691469553, 1862566872300733, 2236121435313308, 274949363314112, 477088969758259 }
+  },
+  {
+    { 1965761504739774, 948410112529604, 1470368970845507, 1212419708620855, 1953662369491230 },
+    { 1106680482832796, 1563027304892563, 530204689676809, 299800282060962, 437037442251865 },
+    { 1946412430894973, 2031215026716789, 1150845535883051, 749273986980949, 1433091314912259 }
+  },
+  {
+    { 674994775520533, 266035846330789, 826951213393478, 1405007746162285, 1781791018620876 },
+    { 1001412661522686, 348196197067298, 1666614366723946, 888424995032760, 580747687801357 },
+    { 1939560076207777, 1409892634407635, 552574736069277, 383854338280405, 190706709864139 }
+  }
+},
+{ /* 7/25 */
+  {
+    { 1381495390544381, 584763141985101, 879705032985300, 313362758653765, 2037973653370615 },
+    { 1890742306105773, 171853555874878, 1636487436566592, 1018479096469591, 1049093089544630 },
+    { 762375715838646, 553562190209386, 1146347552263484, 824188464596685, 1830942666102590 }
+  },
+  {
+    { 1528297312537716, 2187935649407647, 715931603706163, 903221378972329, 1577434241618945 },
+    { 816944747089363, 1889295505677179, 1061560556919768, 681907473170465, 1031466762565130 },
+    { 1385713524190245, 153942078459639, 747467190641094, 1446053675113471, 429215290527338 }
+  },
+  {
+    { 2201062670972485, 265709142593639, 429860623330877, 2026769404043332, 1562746334284849 },
+    { 378121020022844, 825936872512952, 1650345619233699, 606283736757827, 1756067113723921 },
+    { 2029537774099989, 798336123274982, 962765795717174, 1441375461370721, 595792417755859 }
+  },
+  {
+    { 1219260086131915, 647169006596815, 79601124759706, 2161724213426748, 404861897060198 },
+    { 1327968293887866, 1335500852943256, 1401587164534264, 558137311952440, 1551360549268902 },
+    { 417621685193956, 1429953819744454, 396157358457099, 1940470778873255, 214000046234152 }
+  },
+  {
+    { 52405933174014, 129829098574336, 1287715254728848, 797300455234913, 136040202304140 },
+    { 1067823335481987, 699576431451255, 2247599170305995, 2136062757900704, 276795894988793 },
+    { 2090499387837281, 1738232489337197, 89628464572496, 330577247594545, 1509311339573925 }
+  },
+  {
+    { 759330834618807, 1980941059961292, 1007212016193707, 1897051116675950, 1314655091590608 },
+    { 853223378119015, 1541319514595021, 658867101298856, 1436759955980797, 1805479881384115 },
+    { 813923630382560, 2070308454618547, 1123753760701538, 125701858674237, 1639876691492174 }
+  },
+  {
+    { 660457766126717, 1899904872118576, 2214179562340732, 456995681364326, 662844695182908 },
+    { 435466159222517, 2187266940421609, 1321026749871315, 1523662413810968, 322350658778158 },
+    { 1138558219095340, 1151536604143443, 413388077302883, 2227565636724078, 1162237337050609 }
+  },
+  {
+    { 1268047918491973, 2172375426948536, 1533916099229249, 1761293575457130, 1590622667026765 },
+    { 1627072914981959, 2211603081280073, 1912369601616504, 1191770436221309, 2187309757525860 },
+    { 1149147819689533, 378692712667677, 828475842424202, 2218619146419342, 70688125792186 }
+  },
+  {
+    { 3413179823387, 480762486590101, 84191581355312, 628211443197933, 2213494099253629 },
+    { 1854765997888797, 336604586588444, 806854870907216, 1001949872861562, 570257099009375 },
+    { 834101398118966, 271022854369145, 1369674314861137, 1818916289496810, 1266134825749943 }
+  },
+  {
+    { 1410686222988228, 2104835708434440, 1261330834491682, 162817793919631, 1958863190823035 },
+    { 1496164884775817, 1088656408957049, 691739915757074, 138898825877781, 260953870717702 },
+    { 1038765404048732, 1369892669816941, 813245412145919, 1308696772712209, 983496888456019 }
+  },
+  {
+    { 1559922084281010, 818475325959040, 1641601040165538, 1447252870536279, 1567693711144484 },
+    { 475634818502575, 1175459439718422, 1996017460566560, 833004825516132, 185380122751190 },
+    { 264174388706200, 1255545285419248, 1209357159960639, 1360317857566816, 1165282760372820 }
+  },
+  {
+    { 1299739417079761, 1438616663452759, 1536729078504412, 2053896748919838, 1008421032591246 },
+    { 2040723824657366, 399555637875075, 632543375452995, 872649937008051, 1235394727030233 },
+    { 2211311599327900, 2139787259888175, 938706616835350, 12609661139114, 2081897930719789 }
+  },
+  {
+    { 1049539095917283, 405715750871589, 824822321927687, 698230211333844, 2237292610351351 },
+    { 2173807904350587, 1365814741026997, 736946937613060, 1072437565221240, 363894364314974 },
+    { 155657864174561, 1796953774276698, 223128301981749, 468121917293855, 996062976193721 }
+  },
+  {
+    { 863021006485300, 622374497077679, 17074488078781, 1889856903951957, 381275511918326 },
+    { 1559568743803463, 1247046487182599, 563362401041338, 35898887783896, 1178475398893754 },
+    { 2218193689512155, 2193971580116541, 1105913513779761, 1734221896008379, 548073641924556 }
+  },
+  {
+    { 229063000498590, 1314277778603795, 1398896159726879, 20280049240013, 1710170205754499 },
+    { 28369402532694, 2081122251401250, 196508071565830, 67080239900191, 182954550150590 },
+    { 2070257592538602, 1813898931317490, 1039206397473220, 2042478281991863, 943609113181435 }
+  },
+  {
+    { 1324994503390450, 336982330582631, 1183998925654177, 1091654665913274, 48727673971319 },
+    { 1845522914617879, 1222198248335542, 150841072760134, 1927029069940982, 1189913404498011 },
+    { 1079559557592645, 2215338383666441, 1903569501302605, 49033973033940, 305703433934152 }
+  }
+},
+{ /* 8/25 */
+  {
+    { 187989455492609, 681223515948275, 1933493571072456, 1872921007304880, 488162364135671 },
+    { 1413466089534451, 410844090765630, 1397263346404072, 408227143123410, 1594561803147811 },
+    { 2102170800973153, 719462588665004, 1479649438510153, 1097529543970028, 1302363283777685 }
+  },
+  {
+    { 942065717847195, 1069313679352961, 2007341951411051, 70973416446291, 1419433790163706 },
+    { 1146565545556377, 1661971299445212, 406681704748893, 564452436406089, 1109109865829139 },
+    { 2214421081775077, 1165671861210569, 1890453018796184, 3556249878661, 442116172656317 }
+  },
+  {
+    { 753830546620811, 1666955059895019, 1530775289309243, 1119987029104146, 2164156153857580 },
+    { 615171919212796, 1523849404854568, 854560460547503, 2067097370290715, 1765325848586042 },
+    { 1094538949313667, 1796592198908825, 870221004284388, 2025558921863561, 1699010892802384 }
+  },
+  {
+    { 1951351290725195, 1916457206844795, 198025184438026, 1909076887557595, 1938542290318919 },
+    { 1014323197538413, 869150639940606, 1756009942696599, 1334952557375672, 1544945379082874 },
+    { 764055910920305, 1603590757375439, 146805246592357, 1843313433854297, 954279890114939 }
+  },
+  {
+    { 80113526615750, 764536758732259, 1055139345100233, 469252651759390, 617897512431515 },
+    { 74497112547268, 740094153192149, 1745254631717581, 727713886503130, 1283034364416928 },
+    { 525892105991110, 1723776830270342, 1476444848991936, 573789489857760, 133864092632978 }
+  },
+  {
+    { 542611720192581, 1986812262899321, 1162535242465837, 481498966143464, 544600533583622 },
+    { 64123227344372, 1239927720647794, 1360722983445904, 222610813654661, 62429487187991 },
+    { 1793193323953132, 91096687857833, 70945970938921, 2158587638946380, 1537042406482111 }
+  },
+  {
+    { 1895854577604609, 1394895708949416, 1728548428495944, 1140864900240149, 563645333603061 },
+    { 141358280486863, 91435889572504, 1087208572552643, 1829599652522921, 1193307020643647 },
+    { 1611230858525381, 950720175540785, 499589887488610, 2001656988495019, 88977313255908 }
+  },
+  {
+    { 1189080501479658, 2184348804772597, 1040818725742319, 2018318290311834, 1712060030915354 },
+    { 873966876953756, 1090638350350440, 1708559325189137, 672344594801910, 1320437969700239 },
+    { 1508590048271766, 1131769479776094, 101550868699323, 428297785557897, 561791648661744 }
+  },
+  {
+    { 432920540217177, 290770592514699, 627484756484379, 824810409698118, 982836063036306 },
+    { 353355251740798, 1991816083101731, 531398365732334, 658525949984292, 2238278328356437 },
+    { 1857779135539838, 1774848070278290, 1383862392183037, 1948805685118077, 1143607656457264 }
+  },
+  {
+    { 1741735203658460, 2040511596280954, 994080127103494, 1750904751318661, 1289068422789788 },
+    { 1422369203246522, 971984599311858, 573014681621518, 918848094870590, 367659447629224 },
+    { 103031326341235, 1843731695283489, 1066974994445109, 1210433521778964, 118970268237578 }
+  },
+  {
+    { 1990983617046169, 854661065244784, 1275461113767737, 1443049000516840, 1724142301140669 },
+    { 526076300826364, 1586144386274444, 1604867537646151, 2047301186620175, 2088705035995344 },
+    { 888262946735860, 1859763056800716, 714395964694532, 57820586821189, 354182478325612 }
+  },
+  {
+    { 1658219197861206, 1494360717755939, 1921505970326949, 797586498581590, 223479569236846 },
+    { 1548525608040451, 1073757559082238, 1531369709327363, 922355437238401, 1843971892788743 },
+    { 1290766154788448, 1600589032610209, 784792370088015, 423204440383515, 459184860068298 }
+  },
+  {
+    { 2215101089214073, 1997062079162084, 1249116849924618, 465107085276733, 1293244424458276 },
+    { 1173405439078453, 736456899988215, 1888556478991842, 74794080134484, 755787171212360 },
+    { 880894898454805, 639667973647762, 200272726605326, 297199521205209, 1640420309599773 }
+  },
+  {
+    { 658635179203333, 1466091549480452, 1422016859604874, 2129566854376279, 1443087419989351 },
+    { 1772599462959424, 324607711577639, 2208191644070295, 1873852587641829, 1848483126905265 },
+    { 1532654097308642, 1958497386525981, 111717506991097, 1708848284574815, 1306115185198907 }
+  },
+  {
+    { 2039429018914652, 791346872047456, 1364716986897876, 1031303003048000, 1123429638631433 },
+    { 1608800116223605, 2230571150409028, 791905361408124, 396843532013026, 1950462527132799 },
+    { 765045651502510, 451621180435426, 15885268584069, 767513226653014, 768056106241896 }
+  },
+  {
+    { 464451590840864, 1631117916585970, 1763058100245834, 2213037729836095, 1396521499150134 },
+    { 1708891979933193, 193606038525586, 1981223293240314, 1300147684220123, 1415690962041537 },
+    { 296206175452724, 658879322369119, 97943562265366, 1761747874053347, 665498744562262 }
+  }
+},
+{ /* 9/25 */
+  {
+    { 122321229299801, 1022922077493685, 2001275453369484, 2017441881607947, 993205880778002 },
+    { 654925550560074, 1168810995576858, 575655959430926, 905758704861388, 496774564663534 },
+    { 1954109525779738, 2117022646152485, 338102630417180, 1194140505732026, 107881734943492 }
+  },
+  {
+    { 360275475604565, 547835731063078, 215360904187529, 596646739879007, 332709650425085 },
+    { 47602113726801, 1522314509708010, 437706261372925, 814035330438027, 335930650933545 },
+    { 1291597595523886, 1058020588994081, 402837842324045, 1363323695882781, 2105763393033193 }
+  },
+  {
+    { 1212935253295642, 2026300849238541, 1196083870541997, 1364910689032304, 767721080478219 },
+    { 1488819723619072, 35092073032524, 821532055319225, 241314925012301, 1469048576976071 },
+    { 2014517785153097, 1607430272140319, 1855018731367383, 2200629261829065, 987339037980209 }
+  },
+  {
+    { 831848399557275, 2203944328508070, 1205773492199750, 696100069920808, 1258775953756160 },
+    { 1536600197637719, 735192130338721, 1949638657621950, 1215398877067309, 196061350744259 },
+    { 801855642469056, 1726062700700587, 1064722548099106, 1128997468587175, 1368420390253860 }
+  },
+  {
+    { 1622804048544200, 915041952882907, 1930032922997884, 311056897392678, 169542458418274 },
+    { 287149663014406, 1833763257239198, 1928687648160027, 1196128746079943, 2063883975740239 },
+    { 1551335528577145, 1948004732325226, 1312662718768754, 210905365566252, 2058193794812140 }
+  },
+  {
+    { 142063894440228, 1372509542166385, 2168326442740084, 2125528633887315, 1476968897162639 },
+    { 785434002069208, 1744753979728712, 1078762096601858, 938403122376921, 1213343778825366 },
+    { 985903604801154, 1332886857023986, 2192903547363473, 1840653102523012, 429691169313138 }
+  },
+  {
+    { 1245320581556515, 1602979844911741, 2107281419587782, 1757218026844315, 108223170283648 },
+    { 892483078620071, 1282903740840521, 288486899223614, 1193037005255340, 329767062013699 },
+    { 963583404511934, 278128946441565, 1903533887155182, 978312868545893, 583354603016146 }
+  },
+  {
+    { 1095027470911861, 1309452919940954, 165563932177558, 1165431755382480, 1895316643922204 },
+    { 717156719298230, 1955979138243696, 2199791266029467, 1058002839738406, 1449532534254269 },
+    { 2142749866659158, 1962490102531981, 1691447155265793, 1827079035266074, 3803331638058 }
+  },
+  {
+    { 1504474042703954, 467427742958424, 352220297237610, 1309424200487215, 1912480544524107 },
+    { 88533347812538, 1294136033482022, 299596233956243, 60663199529242, 1787783363336769 },
+    { 1709235819232169, 567404565356497, 1995949931537830, 1908745429560797, 1214196194872047 }
+  },
+  {
+    { 1043353844971295, 2043211380513154, 1699222893347162, 315336060401577, 23499265425561 },
+    { 785211022797815, 131959333969695, 421003636399016, 1415026534724707, 259170718243180 },
+    { 299314826812781, 1973991302926879, 344270175372800, 1521436236341130, 978141399248076 }
+  },
+  {
+    { 2070740574932740, 1562735870397740, 1622391615341094, 1176158848322452, 1626784437347104 },
+    { 1249017755758050, 1702387957369772, 1220050705651008, 1761915687423485, 439848735585580 },
+    { 1518477574890767, 333492348816229, 1565883822704407, 197275889570220, 12999397458289 }
+  },
+  {
+    { 1104482724596124, 121997531441, 635349471659539, 1384857237573085, 1805272655273783 },
+    { 478069199145280, 1141170740207616, 940257554984262, 897591638444270, 1814438392415312 },
+    { 399619403797256, 1517816986720610, 1503473770785461, 1650204761619743, 2016574488970872 }
+  },
+  {
+    { 673134042556382, 263641146156934, 668703597909064, 2244629269026048, 863800061710589 },
+    { 28125822440725, 1321104715653731, 1855905220908873, 1642951583006543, 196278346766320 },
+    { 141001094563586, 745053268207009, 1933127088515518, 2223038166038791, 302137944312804 }
+  },
+  {
+    { 1892881056249351, 224718992791357, 886934504265812, 137854399320237, 2097768652942237 },
+    { 1311225750858844, 605951970544033, 43897084268518, 16238814867179, 1379802052960446 },
+    { 2114686272109070, 1740718345102266, 1294350645076173, 2163010864291133, 67178198006822 }
+  },
+  {
+    { 2098359993052422, 1268272578932237, 969418269919982, 1084550350165731, 346854656875689 },
+    { 903207516549054, 2127872093258697, 1937250219252355, 1400381839721648, 1947447086440430 },
+    { 1613697280682962, 426167043646607, 2237161612253816, 254293623066907, 2220839026298682 }
+  },
+  {
+    { 1452497321657782, 1539338328736177, 1904958092028386, 1587402592924884, 2189645592400953 },
+    { 1830872026784925, 1623034384028758, 2186083484441019, 1970420851072046, 64231867033146 },
+    { 481460971838645, 495603062939192, 2081146895236470, 971761350637757, 742727604094484 }
+  }
+},
+{ /* 10/25 */
+  {
+    { 1941100238292788, 1530763972357988, 689917761100876, 517834246099702, 1016501476684148 },
+    { 1361281020450455, 1270489161609055, 2229166815777130, 478093075579488, 1028298658754112 },
+    { 402477551873128, 1206353712079331, 1931900782149571, 353151698548753, 227661813611943 }
+  },
+  {
+    { 790360882582618, 1193039775906918, 457074437270605, 1880772252763311, 1647664574467171 },
+    { 1267345491545277, 1040955582161709, 944602568432597, 589216616145824, 2176282068300736 },
+    { 1801318854301087, 529217444026518, 41439150499132, 1819497139150034, 1914318279506430 }
+  },
+  {
+    { 1401592520352142, 2119290268348413, 1662789932544495, 1461053630461698, 1761023449047587 },
+    { 114244238715052, 1711673966360604, 27096215850346, 649231795386780, 1751566257090632 },
+    { 1892648843913435, 1079776332626104, 1111039290977790, 1827479485396386, 859677304170245 }
+  },
+  {
+    { 1955745180210476, 1703319703537271, 2019166049085294, 1111446728934944, 1621319325065514 },
+    { 1631515565881337, 74820660423111, 1234156086642234, 902000684785159, 479946197517415 },
+    { 1700391063795585, 361747633083750, 1216968456947850, 1993842710713264, 601267006969711 }
+  },
+  {
+    { 1335348453199749, 440896739279346, 991468498763434, 1958567111536423, 1194502970771976 },
+    { 421687194725601, 1452210447909774, 1972718778338361, 2245279220138677, 197097958178703 },
+    { 1656217138482787, 491628805607466, 1679451179466805, 970181505842258, 1534105889461948 }
+  },
+  {
+    { 1051919605857270, 437958703079032, 943831089706606, 69819660973933, 1445811115388040 },
+    { 1953169811593624, 587935880863229, 808215721544276, 1172930642871056, 933712923663396 },
+    { 1160289603260459, 1956223108351205, 1733312353955470, 208731931777063, 2163609865075088 }
+  },
+  {
+    { 353960863214443, 267136175486224, 1655039766011589, 100906939435905, 1606429966007504 },
+    { 1668322680159809, 1164890095728715, 2146980235097167, 1096904483609062, 290681949797038 },
+    { 1142834714776341, 85770505106288, 713866520631433, 440023537352050, 178697006218663 }
+  },
+  {
+    { 1815823837273367, 310953977328321, 1539789395052837, 1395950066391658, 1631063017998021 },
+    { 866175525108893, 724819292219605, 2068366674175907, 2097483603288131, 549017403202089 },
+    { 534961844628464, 1393583055120721, 1748351260324708, 1375538226727024, 2193309623120304 }
+  },
+  {
+    { 872424258749188, 1017619653704369, 2236476348626174, 2024356220545311, 646984149936138 },
+    { 2110712152071290, 1083061627849304, 1308479297196572, 433649975322, 1443470366414306 },
+    { 1239822839121281, 1734625037061034, 1644113104753887, 838912630061655, 2165081997489666 }
+  },
+  {
+    { 396778796084837, 1439044445648177, 2082598280716610, 312891228956027, 1346520144951774 },
+    { 216068533245512, 450632926011098, 1155704279830393, 1553096955694524, 1828326669367983 },
+    { 1979149515238517, 717801405945362, 2104011649567412, 1561125545440573, 2157118688047562 }
+  },
+  {
+    { 1808742790957812, 496003497932491, 1593506265293205, 1924084822718510, 13052705957492 },
+    { 1925374899754391, 927884555160724, 408803445586324, 1171415905577533, 1564029961010013 },
+    { 1767189866398838, 835676264200014, 201596448765126, 1979907908451931, 1442810524651041 }
+  },
+  {
+    { 128841748532646, 1898386240588450, 1005124623360433, 1767814929221709, 337338633748079 },
+    { 2157496244107467, 2094268061525907, 1207437550614157, 350199052205771, 2217008494975342 },
+    { 1077226425497346, 607378044682866, 1485491791574172, 1074180848747199, 1023053128705595 }
+  },
+  {
+    { 241559560479919, 212280779218940, 1933101226851634, 1880342534882667, 166117663538592 },
+    { 1301003651545236, 544228005900385, 507427038513644, 1330143538205517, 599967285393572 },
+    { 1284426144747169, 2005093245564178, 229493920382094, 1642769566056222, 1596652614163344 }
+  },
+  {
+    { 1238878967024320, 471172814059509, 1889926553697686, 374867419189059, 1454538201510031 },
+    { 2226701688930612, 602397011340505, 2055445995572607, 660393007609165, 2190683761654867 },
+    { 978951056774557, 1610590016630807, 2160020521521822, 2222969528403014, 1290838415735858 }
+  },
+  {
+    { 884223512975709, 943781670457040, 112700233686803, 978391045278572, 2088093684065312 },
+    { 1981595287959862, 256449212298126, 1168053390719568, 1303662603325176, 2043691383438785 },
+    { 319754006496675, 2078141843592369, 1381704035073408, 2135424637477137, 1217419566529670 }
+  },
+  {
+    { 356468809648877, 782373916933152, 1718002439402870, 1392222252219254, 663171266061951 },
+    { 759628738230460, 1012693474275852, 353780233086498, 246080061387552, 2030378857679162 },
+    { 2040672435071076, 888593182036908, 1298443657189359, 1804780278521327, 354070726137060 }
+  }
+},
+{ /* 11/25 */
+  {
+    { 1980868732324310, 208050273598170, 1500353534094478, 1977074025846907, 686785408890947 },
+    { 651709082505144, 1321036933983907, 1168392824733552, 893454319309249, 367099342904064 },
+    { 1977199595236300, 927859862391871, 2045825765550850, 1189431662969386, 451125616133550 }
+  },
+  {
+    { 1322932513703416, 348483708721842, 625435238632922, 1647316986471087, 1495874784707614 },
+    { 1382315411654289, 1155328561290128, 746170398588834, 1242063022588681, 1283807594473873 },
+    { 889518489432828, 1216748566987677, 2027061052060458, 268044074097160, 1539610510772867 }
+  },
+  {
+    { 21424958575818, 1223111129900150, 1584682650834635, 2022200125401455, 1373728084078920 },
+    { 865621295938646, 1209886026068106, 451706790235670, 54695233825741, 1098464777589440 },
+    { 913182622593832, 2001872744868184, 882970207556847, 299806317329996, 1726046908726060 }
+  },
+  {
+    { 2201150872731804, 2180241023425241, 97663456423163, 1633405770247824, 848945042443986 },
+    { 1173339555550611, 818605084277583, 47521504364289, 924108720564965, 735423405754506 },
+    { 830104860549448, 1886653193241086, 1600929509383773, 1475051275443631, 286679780900937 }
+  },
+  {
+    { 1850892492353316, 1684891071309520, 40385998826085, 2006298934163466, 1183254236076430 },
+    { 467345837679854, 1079963287879203, 1289481776488924, 1138995482850167, 2090075574715802 },
+    { 2078945761664379, 416819824388135, 1807168813952296, 1829119498211340, 1104898017158901 }
+  },
+  {
+    { 935515906104687, 1207071825389422, 2027424072446041, 872722513859541, 1919104755183505 },
+    { 974225782733251, 1716712557000811, 2213523695428657, 637866107816352, 2046217619948135 },
+    { 1856027684240449, 277191080330797, 547803870712495, 1929436393972708, 2108273376021333 }
+  },
+  {
+    { 2193164114891658, 2202998446167377, 830394820264895, 1122473769367725, 1358275184077328 },
+    { 1713875475414688, 1485870843394126, 2156404008253540, 957659398385731, 670525812145269 },
+    { 1061223351362795, 167181581911539, 875970769411976, 408514155038427, 1364760473892018 }
+  },
+  {
+    { 1577111294832995, 1030899169768747, 144900916293530, 1964672592979567, 568390100955250 },
+    { 278388655910247, 487143369099838, 927762205508727, 181017540174210, 1616886700741287 },
+    { 1191033906638969, 940823957346562, 1606870843663445, 861684761499847, 658674867251089 }
+  },
+  {
+    { 706309251516769, 903123598445940, 1911114154957759, 365310359666426, 1410153181499189 },
+    { 1117369287008216, 1992718956994807, 1623092030697625, 1463250338147353, 330895921813728 },
+    { 1338054819421554, 196025573340191, 1003479620781913, 428165015011426, 172997912189104 }
+  },
+  {
+    { 1535127854114396, 215946570783199, 1630290306081261, 1238983383730599, 2100751563233476 },
+    { 1667316455431685, 649264929690552, 1018034262215239, 451277049704889, 1928747937105228 },
+    { 380961780389541, 2178338328468620, 742870124831160, 1911375771211225, 997508847257641 }
+  },
+  {
+    { 1638960350895601, 1032597264122281, 59455789804027, 774449845818253, 652693409939925 },
+    { 986696988414426, 520410762989103, 548822543218748, 1464796292781984, 534586647076034 },
+    { 412044957208638, 2013913097048832, 709192743692058, 1189608839037433, 136231478615625 }
+  },
+  {
+    { 1875032594195546, 1427106132796197, 724736390962158, 901860512044740, 635268497268760 },
+    { 622869792298357, 1903919278950367, 1922588621661629, 1520574711600434, 1087100760174640 },
+    { 25465949416618, 1693639527318811, 1526153382657203, 125943137857169, 145276964043999 }
+  },
+  {
+    { 491608792008238, 1747425420458448, 208978581350024, 1442594140897164, 101338865333173 },
+    { 1189738651986660, 748480464495258, 1229045436584832, 830628367791864, 797900747288538 },
+    { 2241042174611096, 516782778349986, 605966420024022, 1192302264152749, 813851846433235 }
+  },
+  {
+    { 297577126578919, 1171468310850627, 1272686373561523, 67198984587162, 834305680938946 },
+    { 994425208143260, 647089363286802, 2080075552945492, 2059513965148651, 2080019008023479 },
+    { 2021142845793295, 675163321442635, 1715741717739842, 2195656578860181, 1505117053438698 }
+  },
+  {
+    { 812426979538914, 1359792553972802, 1646363050250158, 1327973772287868, 1257661852521111 },
+    { 1961768095612626, 1096257457085002, 925774241590656, 354027094600942, 683840632669427 },
+    { 553378032971487, 2245203556393359, 1726830610251330, 1269145696941890, 1213931530146204 }
+  },
+  {
+    { 214739857969358, 920212862967915, 1939901550972269, 1211862791775221, 85097515720120 },
+    { 2006245852772938, 734762734836159, 254642929763427, 1406213292755966, 239303749517686 },
+    { 1619678837192149, 1919424032779215, 1357391272956794, 1525634040073113, 1310226789796241 }
+  }
+},
+{ /* 12/25 */
+  {
+    { 2102881477513865, 1570274565945361, 1573617900503708, 18662635732583, 2232324307922098 },
+    { 1853931367696942, 8107973870707, 350214504129299, 775206934582587, 1752317649166792 },
+    { 1417148368003523, 721357181628282, 505725498207811, 373232277872983, 261634707184480 }
+  },
+  {
+    { 2186733281493267, 2250694917008620, 1014829812957440, 479998161452389, 83566193876474 },
+    { 1268116367301224, 560157088142809, 802626839600444, 2210189936605713, 1129993785579988 },
+    { 615183387352312, 917611676109240, 878893615973325, 978940963313282, 938686890583575 }
+  },
+  {
+    { 522024729211672, 1045059315315808, 1892245413707790, 1907891107684253, 2059998109500714 },
+    { 1799679152208884, 912132775900387, 25967768040979, 432130448590461, 274568990261996 },
+    { 98698809797682, 2144627600856209, 1907959298569602, 811491302610148, 1262481774981493 }
+  },
+  {
+    { 1791451399743152, 1713538728337276, 118349997257490, 1882306388849954, 158235232210248 },
+    { 1217809823321928, 2173947284933160, 1986927836272325, 1388114931125539, 12686131160169 },
+    { 1650875518872272, 1136263858253897, 1732115601395988, 734312880662190, 1252904681142109 }
+  },
+  {
+    { 372986456113865, 525430915458171, 2116279931702135, 501422713587815, 1907002872974925 },
+    { 803147181835288, 868941437997146, 316299302989663, 943495589630550, 571224287904572 },
+    { 227742695588364, 1776969298667369, 628602552821802, 457210915378118, 2041906378111140 }
+  },
+  {
+    { 815000523470260, 913085688728307, 1052060118271173, 1345536665214223, 541623413135555 },
+    { 1580216071604333, 1877997504342444, 857147161260913, 703522726778478, 2182763974211603 },
+    { 1870080310923419, 71988220958492, 1783225432016732, 615915287105016, 1035570475990230 }
+  },
+  {
+    { 730987750830150, 857613889540280, 1083813157271766, 1002817255970169, 1719228484436074 },
+    { 377616581647602, 1581980403078513, 804044118130621, 2034382823044191, 643844048472185 },
+    { 176957326463017, 1573744060478586, 528642225008045, 1816109618372371, 1515140189765006 }
+  },
+  {
+    { 1888911448245718, 1387110895611080, 1924503794066429, 1731539523700949, 2230378382645454 },
+    { 443392177002051, 233793396845137, 2199506622312416, 1011858706515937, 974676837063129 },
+    { 1846351103143623, 1949984838808427, 671247021915253, 1946756846184401, 1929296930380217 }
+  },
+  {
+    { 381355034133882, 121517988993168, 1975012837597447, 1280185854661457, 1002498273417023 },
+    { 2005892001358347, 83499497684844, 2127029513143904, 27184048741543, 584569873352834 },
+    { 1896123626988797, 1131351092678624, 1831358114864483, 1263257519094555, 153161823153575 }
+  },
+  {
+    { 624048240918892, 357280153851022, 969596300589996, 1330649045956929, 1828925625187427 },
+    { 510399560955873, 838451493226635, 1155275920204821, 489989960451518, 1166684509844369 },
+    { 85523512650066, 1145743424577874, 270900922559567, 1781500837265517, 1998986005265292 }
+  },
+  {
+    { 652428108160061, 2015564997958156, 1994336236107344, 2172724361186958, 602807242041445 },
+    { 2048515195716518, 116512496400958, 360961157331299, 800263965286847, 202949705751540 },
+    { 2127639189718319, 2205729457048157, 1849555339256920, 1751645797856968, 1883138982486949 }
+  },
+  {
+    { 762600272699983, 501698515094644, 1064616556970457, 526788695246362, 811067357256020 },
+    { 1738116206825469, 238341968077063, 710990074006746, 2099348516760835, 1176872657137975 },
+    { 1503368613839734, 2009362771486879, 495897391474535, 1905468005297555, 272387388531978 }
+  },
+  {
+    { 1830890930331384, 1576312455307437, 1643833878217310, 1105165451044480, 134942040296775 },
+    { 1309447273719093, 546833241593789, 201676040739723, 1944537215523573, 753556866822227 },
+    { 995710478389517, 1430833880042694, 1172677663947400, 1545257382741759, 1798260148494462 }
+  },
+  {
+    { 1276458355120913, 275388093173562, 1130163473530637, 1281375897896514, 2161750040536620 },
+    { 702250729336971, 183212241063726, 1113316565138576, 2243046267272772, 916046753452102 },
+    { 1025062667466023, 43711902086443, 2210112172846377, 233136450830559, 1412931651896051 }
+  },
+  {
+    { 196247865165891, 599053419172739, 828695260044478, 1198848441856845, 1359787207816262 },
+    { 1308541815353293, 41938375732191, 779669417711792, 313239720528728, 297947503568568 },
+    { 555971766815523, 2160228751293088, 266579216919501, 408880354152864, 2184471346102790 }
+  },
+  {
+    { 1895408474337392, 1335954976788533, 985141721217292, 126921816462693, 1461766309882915 },
+    { 1770583362798948, 2134249174371107, 1845225536958177, 623900187867507, 1068565274816080 },
+    { 1291953286798969, 2102679466898679, 1596002078575263, 1387588817990761, 2143444637427225 }
+  }
+},
+{ /* 13/25 */
+  {
+    { 271413961212179, 1353052061471651, 344711291283483, 2014925838520662, 2006221033113941 },
+    { 194583029968109, 514316781467765, 829677956235672, 1676415686873082, 810104584395840 },
+    { 1980510813313589, 1948645276483975, 152063780665900, 129968026417582, 256984195613935 }
+  },
+  {
+    { 1364621558265400, 1512388234908357, 1926731583198686, 2041482526432505, 920401122333774 },
+    { 1884844597333588, 601480070269079, 620203503079537, 1079527400117915, 1202076693132015 },
+    { 840922919763324, 727955812569642, 1303406629750194, 522898432152867, 294161410441865 }
+  },
+  {
+    { 808958715657431, 535960365684029, 560954557362549, 857395349585760, 922421985880169 },
+    { 599374483754862, 849006014614117, 2003053353607252, 1915076208941392, 189258423364169 },
+    { 1970356456788069, 1887106101566224, 2120741856788965, 1887465058487327, 166078852378175 }
+  },
+  {
+    { 1370912655100576, 28079262268111, 1535348789227131, 2242808749632369, 809642652295670 },
+    { 635991163691045, 570696406791013, 1609311709579718, 2034994939683182, 109989835041421 },
+    { 2128769772677977, 2142654242576520, 2016094652496998, 2132031230853467, 725434888027655 }
+  },
+  {
+    { 1754011114902342, 1412555657059790, 396104406402672, 38004008261123, 1625818784604548 },
+    { 1495850063352271, 668975197051914, 2065738832148257, 2030730567027161, 1400458471245021 },
+    { 1402433259125399, 542534891585658, 1215616393227078, 710196562400792, 306411035739055 }
+  },
+  {
+    { 336776966215760, 891392900539282, 239694810077395, 1972075498322545, 1912294604686715 },
+    { 1950601948212002, 2168476417486635, 576695936777704, 491248572731813, 1239724977676433 },
+    { 1833902199612236, 1936506556601833, 638510767562956, 2246407720069552, 2176643306867318 }
+  },
+  {
+    { 937874669026162, 800393277818670, 1266069468786691, 41417158564491, 2118488848214880 },
+    { 164005522423211, 317510693512490, 974608878840600, 33149043102477, 143708957409749 },
+    { 1490670543286601, 430568445984086, 585334374798343, 1745655864263916, 2134786216754222 }
+  },
+  {
+    { 2135073895739904, 1220642636112600, 1493509767807811, 1591839321329741, 1420071562059335 },
+    { 174203991396502, 770330841919696, 114371198672236, 1881281468795601, 79711356135445 },
+    { 1420603492551010, 679640550295814, 1617533903828801, 780154362635607, 1319780020899258 }
+  },
+  {
+    { 1595829256594686, 1914383836820299, 1922108176128921, 1211373143982220, 1580960353653125 },
+    { 1740729400681481, 1000429543436473, 1184259921493104, 1397075383883590, 1410526166628778 },
+    { 1722600034150460, 714845970096063, 1831107608794153, 1639437371802418, 1220490468485613 }
+  },
+  {
+    { 1765261809717466, 466014340570387, 1797681172978490, 1641912452244201, 40480733704652 },
+    { 1183490764738018, 1144576483538494, 357664143214093, 2048437324584307, 570764096014866 },
+    { 1324913735660836, 1780078730736800, 646879243983054, 676686368473452, 511548109776165 }
+  },
+  {
+    { 812944356405581, 1233328488262348, 2108459085024140, 1297889368538326, 942841728379898 },
+    { 777758421708838, 581055197318378, 601152807529804, 63937311507036, 1996745089755639 },
+    { 955419195962176, 148872587307355, 729445435686292, 2198313217932414, 1960359921350383 }
+  },
+  {
+    { 1443775398367956, 342649786021856, 491131145750945, 1161286236132679, 93221155048400 },
+    { 1685268313866105, 1091225057981324, 34738159867818, 1271578597078582, 933514586691351 },
+    { 194815921686333, 1256736762545940, 1408742447743650, 304562218341097, 2021464306176092 }
+  },
+  {
+    { 2081553424693574, 1987056468954746, 1355157044015672, 2086067500750093, 412214048259429 },
+    { 505468987109327, 2216983295022076, 1302378085121841, 1968348007944917, 450577481421464 },
+    { 2202930745260826, 2008297733323650, 2046253285222993, 1298134350748731, 134766833983364 }
+  },
+  {
+    { 627147299378105, 40948281875403, 1718874445886171, 1671656465729548, 1034831387866985 },
+    { 2063654282459101, 322618584522232, 1024908517705867, 1720749579766676, 1574407442838240 },
+    { 1594302786695407, 200904087716968, 1756225997348461, 1636782017753755, 830525839338811 }
+  },
+  {
+    { 2024222335824840, 198693876714545, 1298751258995829, 515968786019213, 61974934460123 },
+    { 681749003004951, 1941315835305904, 2070229014363911, 1374746952347758, 798833944119951 },
+    { 2229526303558773, 1928596485526016, 1381392825893124, 1461224479022449, 359109749545724 }
+  },
+  {
+    { 507963256544514, 472375505174555, 779257878153691, 1179390009947662, 709717330654464 },
+    { 960423152600264, 1015052059094369, 2084933873716193, 291273183388512, 2172369805610215 },
+    { 440075250919582, 694825884103652, 2159700403414911, 116894270435230, 1425927073727904 }
+  }
+},
+{ /* 14/25 */
+  {
+    { 2216608521812979, 1133671267609171, 1886801270451833, 693723450681229, 2177664326279079 },
+    { 1217176410618852, 1156758041567635, 584945597615208, 401700658526440, 188718999318719 },
+    { 2233307833752057, 720411965215730, 1519169695491573, 1249545629073374, 42274079495163 }
+  },
+  {
+    { 1028220431149045, 1318628129209811, 867598555050648, 391516159010623, 618793687544686 },
+    { 785648940778980, 1566075695368470, 2205885851017647, 372501423919883, 2042694981038794 },
+    { 354305362086679, 1512134460741612, 359672307646707, 182487842123724, 70434142068276 }
+  },
+  {
+    { 1024824838093574, 182044951578079, 539066115399189, 1963658167580139, 888614446782442 },
+    { 1693757839885659, 836292189541753, 950751758815067, 982651358735092, 221102476905845 },
+    { 46706548238824, 1986500518838735, 2027136585204085, 1143580830274421, 237034819567290 }
+  },
+  {
+    { 1210457740468652, 2215903401275260, 1545855048122212, 1560256833448838, 235678314205821 },
+    { 1677629762901748, 541583930343398, 1383717393793391, 951594759624156, 166785376717098 },
+    { 1032532177573683, 1507169914894481, 893954872249259, 1464210961075811, 2248024514969267 }
+  },
+  {
+    { 2215196432839229, 1453988298479780, 911159768469061, 1417180860727486, 1916001465630095 },
+    { 266073750133030, 1063660218646657, 2001496173067453, 1054570510340478, 1787320193554613 },
+    { 1593076635649167, 613414152324278, 1398118686752976, 1550186634066418, 2024312475795755 }
+  },
+  {
+    { 1611115816843085, 1564686497935112, 379643685080005, 291591976378398, 1070282314438177 },
+    { 20428272805067, 344278789324198, 839609851549831, 358979365865884, 847000176814724 },
+    { 1370619542022553, 13593976629245, 670888839522668, 29909561835083, 1113994299778657 }
+  },
+  {
+    { 210667856729798, 832581000901195, 979195344857408, 761623507948939, 102316955504785 },
+    { 743880451641798, 738115538583549, 1701458888198429, 1737802518950586, 1702048374090090 },
+    { 1653806661942935, 798938977173667, 1204504651898865, 2012775328403335, 959133953735021 }
+  },
+  {
+    { 1056291284182974, 186371978807430, 666572176305850, 2221533064225315, 1302577527793701 },
+    { 484740628192045, 1747162484279003, 1958227960728501, 2029226260228924, 1872489756569532 },
+    { 2246982488380161, 704048527252770, 449031029656446, 2000971659049725, 1830758195793359 }
+  },
+  {
+    { 800470433913435, 672404056812, 182281358307082, 420997384243032, 351090837625276 },
+    { 938875748136569, 2219220429343996, 514799483708317, 1488024780300031, 1997480530156815 },
+    { 2144671346446832, 542864631780587, 1155108742000404, 1404732713614448, 240293866423412 }
+  },
+  {
+    { 1307308592059221, 784383479594685, 1720750519626457, 1912081034355222, 2024784929774716 },
+    { 617781795775109, 330273540233799, 1776373520427011, 1020434679511389, 1726962726506212 },
+    { 22174994285057, 375276401373336, 1210941030392323, 1903374444438123, 1011323371888298 }
+  },
+  {
+    { 746994751609738, 2057935584763382, 647777410123614, 1519188817940760, 1842063844888831 },
+    { 294871001888273, 1688193754070267, 1716062938944823, 1038532713134574, 809665108008140 },
+    { 892208073348264, 1880270486117637, 1866139692669281, 577642276098528, 159304923876906 }
+  },
+  {
+    { 867017597014674, 1416293682313137, 1358642285736990, 1764897881567575, 1533248549446374 },
+    { 97434005500231, 1295654269286564, 1275504419230110, 1966673568091831, 562696536595372 },
+    { 841452637470330, 509851329084465, 315943768852800, 745051417948746, 1317978823624451 }
+  },
+  {
+    { 2216474880678668, 1883045416719140, 1305295773582612, 162452308176835, 767818455443584 },
+    { 708924451360549, 1329610096862545, 253976285864925, 1506333312168430, 221876871239889 },
+    { 1790146986408439, 1266311794146205, 923857310756466, 2043374401317120, 726369229085659 }
+  },
+  {
+    { 1047639500605479, 1016683765780036, 2206428670313251, 1688287562131353, 1668007864663417 },
+    { 374712944226317, 1970995153845960, 1069877565474913, 1154794696991644, 239532478102658 },
+    { 1777656298881359, 367886496899263, 1134571758927624, 161297709883194, 864111924164392 }
+  },
+  {
+    { 1207697025811178, 1172866796116673, 2087657719164010, 1359779659817200, 2226199443508324 },
+    { 267038019739146, 852980691069616, 1952810457772992, 748363570639034, 109263490233305 },
+    { 179962092093812, 1434865358203901, 1509301171184812, 465007053005824, 1606826267425619 }
+  },
+  {
+    { 278151578291475, 1810282338562947, 1771599529530998, 1383659409671631, 685373414471841 },
+    { 577009397403102, 1791440261786291, 2177643735971638, 174546149911960, 1412505077782326 },
+    { 893719721537457, 1201282458018197, 1522349501711173, 58011597740583, 1130406465887139 }
+  }
+},
+{ /* 15/25 */
+  {
+    { 394133855270478, 1022205784206132, 404819328296271, 1746214054851431, 801232833816448 },
+    { 1273141653286537, 600137967440787, 1108281665285822, 1607794127357251, 276080397056360 },
+    { 1625278703177771, 652272403287866, 1130860155562117, 1467718191751280, 170296377586353 }
+  },
+  {
+    { 1386180360119611, 1021274801195911, 1729880193705624, 2228606406348098, 1592392117444361 },
+    { 1689247777141059, 1987892221330336, 2238604025082286, 2061272829606697, 166862139432161 },
+    { 419731549689034, 1989626747750813, 1591278351630992, 1092786235861584, 177178675215960 }
+  },
+  {
+    { 874026063340854, 581394977884979, 554076247399451, 1693301763657948, 1873084195329208 },
+    { 6932090905729, 522370684247211, 2046750441884777, 198865291867578, 902267487290513 },
+    { 262642087469467, 394043452244726, 1877384193205089, 135064540003798, 932774458922892 }
+  },
+  {
+    { 155711679280656, 681100400509288, 389811735211209, 2135723811340709, 408733211204125 },
+    { 7813206966729, 194444201427550, 2071405409526507, 1065605076176312, 1645486789731291 },
+    { 16625790644959, 1647648827778410, 1579910185572704, 436452271048548, 121070048451050 }
+  },
+  {
+    { 571579876968632, 58797045989456, 1350176454179621, 342380021599803, 523609628126150 },
+    { 1501292725409308, 1238219522811892, 1552584937846753, 21794772566842, 1668786749206159 },
+    { 1923863876155286, 122199335211043, 1002707948758226, 36987619026769, 1150638264204758 }
+  },
+  {
+    { 1536097914487694, 1844505177101959, 1940885571305988, 1318446623468144, 1782894874034435 },
+    { 359951720530493, 43082453634541, 1257387399987992, 1812153804530322, 1702380259675676 },
+    { 1102198410065990, 2035958901082211, 663166579998017, 1280637581527414, 1834499895467312 }
+  },
+  {
+    { 586429640549219, 727606559420435, 1917560201809397, 1908489428490361, 803951954024708 },
+    { 1818874955050134, 2112640611543001, 1089194231603048, 648731096307394, 738240185226130 },
+    { 1297307734104486, 514187407473541, 1142383366347439, 531634506139746, 1603029940958430 }
+  },
+  {
+    { 1037263028552531, 568385780377829, 297953104144430, 1558584511931211, 2238221839292471 },
+    { 190565267697443, 672855706028058, 338796554369226, 337687268493904, 853246848691734 },
+    { 1763863028400139, 766498079432444, 1321118624818005, 69494294452268, 858786744165651 }
+  },
+  {
+    { 1907069441651104, 1553711702512373, 473673097773862, 1604344656451092, 1336905783950647 },
+    { 1681774815694295, 2368021108385, 348992161183226, 1944478486218296, 857526520836042 },
+    { 102687015928577, 704881233335847, 1821632459294712, 2241392167752086, 1756104171567289 }
+  },
+  {
+    { 368398655453847, 333745524646407, 653018818666239, 473366099464459, 570748713924715 },
+    { 2012503180736128, 1792315901656051, 1638756101860944, 423188131261520, 18691678230220 },
+    { 484344170797270, 1652682192070061, 851471825469954, 104376581681327, 180407874320785 }
+  },
+  {
+    { 94193764961673, 348487513405028, 2102797924162251, 2057790672735443, 1135022778581553 },
+    { 2212537369106131, 168056602082847, 850727966217538, 1334032445279205, 1954183215378874 },
+    { 1728117201567932, 1739767900202897, 2205333359753896, 1438103274967585, 1266651910298729 }
+  },
+  {
+    { 1292056768563024, 1456632109855638, 1100631247050184, 1386133165675321, 1232898350193752 },
+    { 366253102478259, 525676242508811, 1449610995265438, 1183300845322183, 185960306491545 },
+    { 28315355815982, 460422265558930, 1799675876678724, 1969256312504498, 1051823843138725 }
+  },
+  {
+    { 1935886106829149, 2124897705472473, 2183559664845685, 933798861657046, 2202504692241716 },
+    { 2043986259501968, 406218654486756, 1018408934859520, 1685727871997643, 900128405662108 },
+    { 1543736400146726, 809836145816917, 131615030311544, 1077644683422280, 1123541831087698 }
+  },
+  {
+    { 2244699475507971, 1961013703894917, 640654552204415, 1754829361909331, 1541140264027566 },
+    { 1099290108726274, 1541115973733393, 601197479661025, 1764621609824539, 1444181436548624 },
+    { 1038004499849138, 707540882141177, 1576365896690443, 2011328691034939, 25914862630834 }
+  },
+  {
+    { 1007313487333142, 1264528921249923, 291687873686320, 1962794999659014, 253465329246667 },
+    { 1957658575268486, 118295248511609, 249938722508612, 1558182223024144, 1059938522368481 },
+    { 1321965603743307, 435260719621130, 247595971200, 1174632212579447, 1663837356122307 }
+  },
+  {
+    { 156914999361983, 1606148405719949, 1665208410108430, 317643278692271, 1383783705665320 },
+    { 54684536365732, 2210010038536222, 1194984798155308, 535239027773705, 1516355079301361 },
+    { 1484387703771650, 198537510937949, 2186282186359116, 617687444857508, 647477376402122 }
+  }
+},
+{ /* 16/25 */
+  {
+    { 1899935429242705, 1602068751520477, 940583196550370, 82431069053859, 1540863155745696 },
+    { 2136688454840028, 2099509000964294, 1690800495246475, 1217643678575476, 828720645084218 },
+    { 765548025667841, 462473984016099, 998061409979798, 546353034089527, 2212508972466858 }
+  },
+  {
+    { 46575283771160, 892570971573071, 1281983193144090, 1491520128287375, 75847005908304 },
+    { 1801436127943107, 1734436817907890, 1268728090345068, 167003097070711, 2233597765834956 },
+    { 1997562060465113, 1048700225534011, 7615603985628, 1855310849546841, 2242557647635213 }
+  },
+  {
+    { 1161017320376250, 492624580169043, 2169815802355237, 976496781732542, 1770879511019629 },
+    { 1357044908364776, 729130645262438, 1762469072918979, 1365633616878458, 181282906404941 },
+    { 1080413443139865, 1155205815510486, 1848782073549786, 622566975152580, 124965574467971 }
+  },
+  {
+    { 1184526762066993, 247622751762817, 692129017206356, 820018689412496, 2188697339828085 },
+    { 2020536369003019, 202261491735136, 1053169669150884, 2056531979272544, 778165514694311 },
+    { 237404399610207, 1308324858405118, 1229680749538400, 720131409105291, 1958958863624906 }
+  },
+  {
+    { 515583508038846, 17656978857189, 1717918437373989, 1568052070792483, 46975803123923 },
+    { 281527309158085, 36970532401524, 866906920877543, 2222282602952734, 1289598729589882 },
+    { 1278207464902042, 494742455008756, 1262082121427081, 1577236621659884, 1888786707293291 }
+  },
+  {
+    { 353042527954210, 1830056151907359, 1111731275799225, 174960955838824, 404312815582675 },
+    { 2064251142068628, 1666421603389706, 1419271365315441, 468767774902855, 191535130366583 },
+    { 1716987058588002, 1859366439773457, 1767194234188234, 64476199777924, 1117233614485261 }
+  },
+  {
+    { 984292135520292, 135138246951259, 2220652137473167, 1722843421165029, 190482558012909 },
+    { 298845952651262, 1166086588952562, 1179896526238434, 1347812759398693, 1412945390096208 },
+    { 1143239552672925, 906436640714209, 2177000572812152, 2075299936108548, 325186347798433 }
+  },
+  {
+    { 721024854374772, 684487861263316, 1373438744094159, 2193186935276995, 1387043709851261 },
+    { 418098668140962, 715065997721283, 1471916138376055, 2168570337288357, 937812682637044 },
+    { 1043584187226485, 2143395746619356, 2209558562919611, 482427979307092, 847556718384018 }
+  },
+  {
+    { 149807506775174, 912267207660897, 545976734422637, 1401692837350637, 518614477171099 },
+    { 2036378377993918, 501805733304808, 2138481508169727, 1314165893238533, 633769691720883 },
+    { 904627574235583, 366582160013268, 1919276459982818, 683852563070972, 849013528013132 }
+  },
+  {
+    { 314313360314866, 1556311374160012, 1168603496880569, 1814168775579275, 1614132085719577 },
+    { 2131084209034260, 1079618267255989, 2221075635319892, 1767700624704351, 2211234254213298 },
+    { 2211811396782717, 1987727116500422, 1201194143426517, 1988979712261853, 884086138400803 }
+  },
+  {
+    { 905437535859381, 2087027997220234, 1635119994381095, 1685873597006198, 1012846163414573 },
+    { 1676395312121042, 3029220223268, 368206865668243, 964533673789594, 215376185876701 },
+    { 554990822829571, 1043610604169755, 239155874009083, 1207029530220679, 1248980877883503 }
+  },
+  {
+    { 69285391071238, 952699065262595, 1897195179818498, 2221896934640248, 2249233024322127 },
+    { 78809566929483, 779032012311147, 1427611596584513, 518873618952061, 1526917368222930 },
+    { 1100828805329651, 38323682820671, 233339076341529, 570439134676859, 373923102906827 }
+  },
+  {
+    { 650556138336187, 1140806781381529, 1319490550148986, 191418598917150, 2092597895198458 },
+    { 318870179835268, 74934950484033, 1562778480087512, 1707372248382077, 1218075494012839 },
+    { 24874372349398, 672413878008022, 2109618619032869, 617580455983017, 643082448965145 }
+  },
+  {
+    { 895116466708821, 59560718869665, 1331906084934492, 1442649827370867, 985339602059253 },
+    { 1451142689265254, 1969461860313708, 21715673478130, 528368101402583, 2160134848980621 },
+    { 1101806460504208, 48906420814555, 455540794156723, 777238833441277, 678815750013174 }
+  },
+  {
+    { 1203258470211606, 631466542942779, 1508156827359998, 1386471169744113, 1401834110583506 },
+    { 452617917293805, 2159217690799159, 1402674324629166, 651400501019098, 2161850530833241 },
+    { 928961391578986, 832907369443124, 468987297840672, 1558723144077997, 1418280592841651 }
+  },
+  {
+    { 997854281022512, 371412096455343, 385221936050652, 1659016544729114, 609442868038809 },
+    { 283947992808316, 906854516558219, 2004968339980078, 682646947000673, 252088188293511 },
+    { 1619428378651736, 1579845830028655, 3625310117685, 170605089295866, 1149673757755609 }
+  }
+},
+{ /* 17/25 */
+  {
+    { 1995325341336574, 911500251774648, 164010755403692, 855378419194762, 1573601397528842 },
+    { 241719380661528, 310028521317150, 1215881323380194, 1408214976493624, 2141142156467363 },
+    { 1315157046163473, 727368447885818, 1363466668108618, 1668921439990361, 1398483384337907 }
+  },
+  {
+    { 838432205560695, 1997703511451664, 1018791879907867, 1662001808174331, 78328132957753 },
+    { 739152638255629, 2074935399403557, 505483666745895, 1611883356514088, 628654635394878 },
+    { 1822054032121349, 643057948186973, 7306757352712, 577249257962099, 284735863382083 }
+  },
+  {
+    { 939988499217114, 1662632170533262, 1597931620617614, 816384760006537, 2103376627071646 },
+    { 153926091142038, 1765220518579265, 528407889482033, 1944774404468420, 55214660108975 },
+    { 98516339668203, 1987095201806236, 109825731538912, 249333174781555, 868887613476084 }
+  },
+  {
+    { 1912748982362695, 1220789150721713, 704177718050401, 723618635926708, 1539793845278548 },
+    { 797199596391742, 1640579499587252, 2249382671495029, 1509816099416416, 1287100489183999 },
+    { 2120957025321772, 1416788979770990, 1248163529640000, 1057479098339217, 1345904049070916 }
+  },
+  {
+    { 254121746213369, 1533500053409216, 635709488325464, 1143238478729669, 2134848088586068 },
+    { 1746879317691946, 686105653351478, 2043100616430503, 971699238203156, 104317575808346 },
+    { 852542705191174, 1773940944796397, 110837992325710, 2231703469430819, 349088851981013 }
+  },
+  {
+    { 793977705557061, 2021518417426778, 1732253271242201, 1293748598781831, 829319793069143 },
+    { 788535447152259, 1016555038491888, 990067004977538, 1321283029883181, 846580866043953 },
+    { 110555050492969, 701122633359978, 947827171315505, 1007083735220856, 2186736036162197 }
+  },
+  {
+    { 801046924791751, 1937826096094762, 901257692586611, 1929902598090714, 410680383194296 },
+    { 1511252350965953, 1242806839559772, 941190528770125, 848987521707247, 1770475079640735 },
+    { 1754633294428314, 2154502484623757, 2011608413039233, 1969957542290297, 1446257406201241 }
+  },
+  {
+    { 1020723204932740, 925702577219623, 993238884888760, 1734688533140183, 2122148469059677 },
+    { 91831374297454, 1526227336126975, 1355766749788798, 604694865815954, 179753894501239 },
+    { 1672839208916523, 1716495024680343, 1707076061183264, 765180466790910, 2017432747304428 }
+  },
+  {
+    { 756623766768775, 1991587084927598, 1373391401979308, 1665725475234083, 1968182055405121 },
+    { 592732400846588, 36261853172026, 300573459939186, 1097010826367826, 1187240170941336 },
+    { 1129939559093854, 115411381815159, 1643323027370752, 1057763109943669, 1215511282800683 }
+  },
+  {
+    { 979157969997640, 781365085180074, 2052217627248167, 626459442141542, 1446996452191635 },
+    { 508002240308955, 2182480398434935, 120365472791495, 175489098273257, 641728417129403 },
+    { 1233588463814759, 966863898273900, 1057975855925880, 967550326000152, 1411751114548341 }
+  },
+  {
+    { 1757700744775968, 684436626549586, 1290857595283177, 1292154319580064, 424310864381175 },
+    { 1190160684235692, 2216589841982445, 303448460297705, 413409541026783, 2183537752608363 },
+    { 1823832516176735, 118976325266904, 1997049946199681, 1488809896891393, 1997400624287774 }
+  },
+  {
+    { 162252707744707, 1593372837632109, 419105697539909, 1656407715094130, 112109013318476 },
+    { 1845211281712630, 314796716337139, 1084733734214267, 2030481699162822, 408225771371226 },
+    { 192171151121229, 1275967732855104, 1864584199775891, 1693406950762857, 451756333138903 }
+  },
+  {
+    { 1934941369331531, 388260373608175, 1304482939975309, 1529402531991965, 1498338899563392 },
+    { 434465565952568, 272333844056755, 526330323705288, 976329191188551, 735878981585166 },
+    { 486851592096970, 264537447834014, 1822054972903336, 238032531658386, 1678107842746402 }
+  },
+  {
+    { 2162140011651749, 1675927674210235, 436681937730684, 332739841506044, 1569242283000804 },
+    { 1245624909427148, 1055288224512918, 2245150738413630, 161261146568384, 1090651350647907 },
+    { 458134832756999, 939829782195586, 2250353956101998, 434064832994582, 338708936831109 }
+  },
+  {
+    { 2056018369491766, 1624971110356071, 1245644103099606, 212830559235017, 1964722912769135 },
+    { 1105151597870361, 2109200404659049, 2216073774113885, 1897978861200905, 1596357428289980 },
+    { 678725855212719, 57776089061085, 1925610488691950, 1367327322661409, 1290430534697304 }
+  },
+  {
+    { 1612422054090644, 2236845889213344, 111947795252003, 1594023725720587, 709352663553385 },
+    { 223618880166307, 2227771290802404, 11281894918949, 2094951662727146, 841799884322096 },
+    { 1485832258557624, 680071864680695, 1288498699771584, 258483455916573, 1782424270254224 }
+  }
+},
+{ /* 18/25 */
+  {
+    { 1638260469631934, 1786040878698661, 906589425735481, 1583514814511733, 161900944868234 },
+    { 821091239344879, 1029728218242611, 1785130220912361, 134891303686179, 1146812607647243 },
+    { 960395712488566, 1090263312831733, 1493488072165035, 718337273853885, 140550395520083 }
+  },
+  {
+    { 582009322268611, 1462939149444616, 1699035707213512, 1260336843200283, 22744545971108 },
+    { 66233320680397, 481500577921291, 1593046392900201, 1567890828749600, 494668490181439 },
+    { 447501697246828, 643764017641830, 598739660833153, 477276555234445, 722964385617133 }
+  },
+  {
+    { 1468688697571051, 679132917145459, 729559654398033, 216030070311676, 1572642054261960 },
+    { 1240274286914554, 1067294500855911, 1808099303249661, 2078686383903322, 1106012145326576 },
+    { 601523810297856, 895074627148937, 773977692709653, 1905383167427875, 1540507530397039 }
+  },
+  {
+    { 399548058429350, 1239727848347326, 910155210437028, 460253616151978, 1473384781489285 },
+    { 649661364881903, 490692502811334, 1079509849353758, 1289782120135506, 536543674034462 },
+    { 1148448246837183, 1915539016170074, 727268432049334, 838952046766961, 1100979659516489 }
+  },
+  {
+    { 549684439104063, 1308243333207399, 849363374624769, 650751688271388, 1782136170508092 },
+    { 2061989082911795, 1479591773633681, 978076246857124, 838517167558357, 354474530763849 },
+    { 1354449553272043, 1085110494903468, 2224048655022783, 1932600057639272, 200912869737304 }
+  },
+  {
+    { 768379161979195, 698528958407689, 1384131174334607, 573310211564337, 5045987379232 },
+    { 1737002989059736, 802467700141916, 1002869782075529, 704293791948409, 2201857958628929 },
+    { 1328818899805024, 1356396048253838, 60665341223248, 1567700157316511, 290562887661571 }
+  },
+  {
+    { 2083771618977947, 1607978129046189, 1586868936731179, 268756465778504, 2196980677006700 },
+    { 286239024641757, 487000093964479, 1365236543743062, 952492668921998, 305066005571225 },
+    { 1179288489475667, 394266093483806, 2023843107238627, 906600297586329, 1987935808498095 }
+  },
+  {
+    { 2190648163527070, 1182302286459911, 1698709705179966, 606253946341655, 512030280417032 },
+    { 348777384482283, 2016426622766719, 1222199716068557, 1918283401506759, 2245473746651968 },
+    { 1766029976663583, 578113072554872, 1407762358462124, 1251410333318914, 1519685697291309 }
+  },
+  {
+    { 2165465146173096, 1900611060212209, 1042730545588351, 2014093929109019, 1810920073473014 },
+    { 173411190973372, 967529309086102, 1908986490599312, 411938580678674, 356258419083572 },
+    { 2188210814895132, 862494540176239, 429026747909695, 420692388686242, 398456856483386 }
+  },
+  {
+    { 2182481135659358, 1214620204337280, 1322637461359405, 1356848297722186, 919105498759085 },
+    { 880514070070495, 1997526724728810, 1484288295863144, 272582074519933, 2088837521459658 },
+    { 825616994407031, 220978982016139, 419943662189285, 2047052177976116, 183513451940769 }
+  },
+  {
+    { 783125706449468, 306749525643676, 21770820613928, 103790913644674, 1721435535499275 },
+    { 2132053622782186, 1113268721076370, 128627570986857, 1755820574942708, 242159262066477 },
+    { 397259122369220, 1632965024772390, 1358524229763907, 634652123170537, 1300732316858513 }
+  },
+  {
+    { 959435621276742, 649442782529811, 632841582251763, 968805857393904, 1687384821034387 },
+    { 34122925272183, 2155153497888788, 244056216431944, 117474587239490, 152689635003290 },
+    { 596504540509310, 1411595783429460, 320205765945468, 1703829528897671, 791135694264620 }
+  },
+  {
+    { 654173403472873, 928661794238621, 1629853006863494, 1616810006326534, 2007934577851039 },
+    { 1683503690923416, 727988134240269, 2240507241051587, 1847468092528986, 1643341229966684 },
+    { 1723586093910128, 42167711405468, 711328489930847, 1802621686437750, 138939056743574 }
+  },
+  {
+    { 570251557550507, 1171790929970039, 580334044699877, 1197545364645877, 1343246277400449 },
+    { 1283485640594810, 1892074764812191, 2126737364321622, 680209267941507, 1777758743504942 },
+    { 201514708798683, 714458960438240, 193526864900221, 289856941669808, 677692044183495 }
+  },
+  {
+    { 815420529102355, 1318716141230896, 859940092247599, 545165849427436, 1325031219234521 },
+    { 1138573439840070, 1068378781077018, 1630139289265327, 1160984923403677, 1289616917811600 },
+    { 520206601828502, 827736556609109, 1548115289807569, 226762337353952, 901425653289102 }
+  },
+  {
+    { 453918449698368, 106406819929001, 2072540975937135, 308588860670238, 1304394580755385 },
+    { 1295082798350326, 2091844511495996, 1851348972587817, 3375039684596, 789440738712837 },
+    { 2083069137186154, 848523102004566, 993982213589257, 1405313299916317, 1532824818698468 }
+  }
+},
+{ /* 19/25 */
+  {
+    { 1025432551730846, 1648743746278575, 16684771081519, 347896520603035, 1136469383570497 },
+    { 1553077072086479, 778919053728455, 581206537360082, 2100029769810002, 192766048046100 },
+    { 437947250844137, 170970937295705, 294909197597269, 2210849722009323, 1802271999575202 }
+  },
+  {
+    { 345774063281888, 1248680369566159, 993767719430878, 632344407656797, 494002909476340 },
+    { 525302074276141, 241111491449954, 1218402302345939, 567375174674023, 525859655102473 },
+    { 1262037831799441, 1761445988918060, 1818282615037362, 643977010061831, 1670449776207217 }
+  },
+  {
+    { 105618528712651, 1599797957446168, 1723240952262061, 1521319741808023, 1244021174200017 },
+    { 154720291700703, 533958195082685, 801063430923359, 417051647072220, 91268681893473 },
+    { 1682663787527018, 508342182938395, 1334960042435994, 788285033210835, 1620852797020940 }
+  },
+  {
+    { 1632352921721536, 1833328609514701, 2092779091951987, 1923956201873226, 2210068022482919 },
+    { 35271216625062, 1712350667021807, 983664255668860, 98571260373038, 1232645608559836 },
+    { 1998172393429622, 1798947921427073, 784387737563581, 1589352214827263, 1589861734168180 }
+  },
+  {
+    { 1501008607154960, 1563686557608537, 609033933792108, 1536455301442641, 1828207280451471 },
+    { 1757463240890423, 1084586437565356, 674676257046313, 1797880867889069, 2163367554160634 },
+    { 1692634708765115, 1439394672846608, 1906726749038590, 841471569745445, 610983732913164 }
+  },
+  {
+    { 24859833299225, 1159089376385356, 756772521963176, 188739816336795, 972658746781390 },
+    { 1366090295712491, 509267435817523, 1595372259512299, 94186959707772, 1052764824068037 },
+    { 1380663358610302, 13527549633514, 1398584537173685, 1632720970065177, 1650958084279369 }
+  },
+  {
+    { 697987915176445, 133416785505936, 1449184407897135, 967865560071656, 85553524989298 },
+    { 1503272981057299, 1773600850082806, 1109725102365418, 1697982940339293, 68257764421792 },
+    { 1748179580274940, 534280555384699, 568941398869518, 127928105804569, 1098014024324994 }
+  },
+  {
+    { 1733739258725305, 31715717059538, 201969945218860, 992093044556990, 1194308773174556 },
+    { 846415389605137, 746163495539180, 829658752826080, 592067705956946, 957242537821393 },
+    { 1758148849754419, 619249044817679, 168089007997045, 1371497636330523, 1867101418880350 }
+  },
+  {
+    { 83285890529250, 2062114292303446, 1057339688664157, 883236001978485, 1425252631637430 },
+    { 1185679862698239, 1876936454661329, 588745622816003, 231168999595020, 874700109469248 },
+    { 838923892832926, 2058839223583505, 771385551534887, 332236222984821, 495351408098863 }
+  },
+  {
+    { 1134834255621136, 1919389365086497, 1528203891548067, 2029873700874765, 1953355553934260 },
+    { 1633754979199207, 484957469969036, 1760373405450096, 1860832728908965, 1492139386939155 },
+    { 593490584920710, 1146664983900373, 89382643176674, 1563731168417270, 158854757185262 }
+  },
+  {
+    { 1236450672664323, 396341254485838, 1808561961147467, 1792522203299614, 1605783007030001 },
+    { 268307540650494, 1324411112159005, 2017107463277532, 2137592127187254, 534920533756206 },
+    { 1275424231344290, 1460044005754998, 1880572567874046, 1133206707555448, 939501845742013 }
+  },
+  {
+    { 326633984209635, 261759506071016, 1700682323676193, 1577907266349064, 1217647663383016 },
+    { 1714182387328607, 1477856482074168, 574895689942184, 2159118410227270, 1555532449716575 },
+    { 853828206885131, 998498946036955, 1835887550391235, 207627336608048, 258363815956050 }
+  },
+  {
+    { 1313788342678762, 1315440055643720, 1214065368291679, 205111008935315, 1935736633676833 },
+    { 412596012173286, 687814750109884, 323232598907933, 2174060715461817, 1484501533614323 },
+    { 1008070842748440, 2099305694142085, 153179973673139, 567866478906802, 854143793130041 }
+  },
+  {
+    { 1373048109829047, 2142664138582800, 66806767921188, 432874256295668, 1546585422696486 },
+    { 191253205012271, 1997529964861273, 743585098448547, 916239483418126, 296912737750104 },
+    { 1047682554124367, 1329845026101429, 1648213048555504, 207137382784721, 1529805460897011 }
+  },
+  {
+    { 111184843100769, 825519965447365, 1340345892431139, 2093408782932033, 1852217741005440 },
+    { 915213787001391, 1245864590534520, 1205599863942461, 1428729912964141, 388662212190609 },
+    { 2006931247888232, 239131773624011, 2139365226926203, 1365864781727631, 1553167772238896 }
+  },
+  {
+    { 141141474651677, 1236728744905256, 643101419899887, 1646615130509173, 1208239602291765 },
+    { 1501663228068911, 1354879465566912, 1444432675498247, 897812463852601, 855062598754348 },
+    { 714380763546606, 1032824444965790, 1774073483745338, 1063840874947367, 1738680636537158 }
+  }
+},
+{ /* 20/25 */
+  {
+    { 1957943897155497, 1788667368028035, 137692910029106, 1039519607062, 826404763313028 },
+    { 1848942433095597, 1582009882530495, 1849292741020143, 1068498323302788, 2001402229799484 },
+    { 1528282417624269, 2142492439828191, 2179662545816034, 362568973150328, 1591374675250271 }
+  },
+  {
+    { 160026679434388, 232341189218716, 2149181472355545, 598041771119831, 183859001910173 },
+    { 2013278155187349, 662660471354454, 793981225706267, 411706605985744, 804490933124791 },
+    { 2051892037280204, 488391251096321, 2230187337030708, 930221970662692, 679002758255210 }
+  },
+  {
+    { 1530723630438670, 875873929577927, 341560134269988, 449903119530753, 1055551308214179 },
+    { 1461835919309432, 1955256480136428, 180866187813063, 1551979252664528, 557743861963950 },
+    { 359179641731115, 1324915145732949, 902828372691474, 294254275669987, 1887036027752957 }
+  },
+  {
+    { 2043271609454323, 2038225437857464, 1317528426475850, 1398989128982787, 2027639881006861 },
+    { 2072902725256516, 312132452743412, 309930885642209, 996244312618453, 1590501300352303 },
+    { 1397254305160710, 695734355138021, 2233992044438756, 1776180593969996, 1085588199351115 }
+  },
+  {
+    { 440567051331029, 254894786356681, 493869224930222, 1556322069683366, 1567456540319218 },
+    { 1950722461391320, 1907845598854797, 1822757481635527, 2121567704750244, 73811931471221 },
+    { 387139307395758, 2058036430315676, 1220915649965325, 1794832055328951, 1230009312169328 }
+  },
+  {
+    { 1765973779329517, 659344059446977, 19821901606666, 1301928341311214, 1116266004075885 },
+    { 1127572801181483, 1224743760571696, 1276219889847274, 1529738721702581, 1589819666871853 },
+    { 2181229378964934, 2190885205260020, 1511536077659137, 1246504208580490, 668883326494241 }
+  },
+  {
+    { 437866655573314, 669026411194768, 81896997980338, 523874406393178, 245052060935236 },
+    { 1975438052228868, 1071801519999806, 594652299224319, 1877697652668809, 1489635366987285 },
+    { 958592545673770, 233048016518599, 851568750216589, 567703851596087, 1740300006094761 }
+  },
+  {
+    { 2014540178270324, 192672779514432, 213877182641530, 2194819933853411, 1716422829364835 },
+    { 1540769606609725, 2148289943846077, 1597804156127445, 1230603716683868, 815423458809453 },
+    { 1738560251245018, 1779576754536888, 1783765347671392, 1880170990446751, 1088225159617541 }
+  },
+  {
+    { 664721818475248, 91312327011767, 1601700300762338, 1763148914953177, 456391161471011 },
+    { 2195895609043093, 166492702184777, 1092371516693134, 578271210922313, 705925854510151 },
+    { 1339021042945816, 1840804708066696, 877961221559635, 1281458842745501, 1950851850845276 }
+  },
+  {
+    { 1020393680308979, 1582912152861834, 70927142474335, 995949551108035, 783372565431893 },
+    { 283322707170508, 451425014068290, 737361158971158, 682830005338441, 480789621703915 },
+    { 2248087612518599, 173333799263920, 1744928838552182, 957368524885377, 1722980339454003 }
+  },
+  {
+    { 201864547473083, 1406864297960650, 2133047286876874, 639446786234013, 1077039773701842 },
+    { 1574426772816100, 481791842865072, 1454978574176907, 497439805624424, 1391685255696725 },
+    { 1403674776792037, 176114870970230, 204752269254815, 823265703401663, 973549049711641 }
+  },
+  {
+    { 1259707444932020, 89894521051155, 771378629688383, 1867652969448711, 1541883672814481 },
+    { 2176894488793201, 2027716283845645, 55230079721899, 3089796004320, 808927956992836 },
+    { 273175012476053, 353915697751570, 1920076197363975, 2096923665433891, 694182114426694 }
+  },
+  {
+    { 21358998325927, 1001970332300944, 1455430838863126, 1701216872600126, 1994907074166318 },
+    { 1932892271286750, 1882260467126736, 918979855287858, 2204507190024693, 2056499473043853 },
+    { 854928709890819, 247698160098706, 1293104197995963, 648230677212306, 784063325867838 }
+  },
+  {
+    { 743926857795135, 855124812601935, 466950880259927, 1017009452055371, 1129470954185504 },
+    { 437286598865, 946974580464584, 1538471761396184, 415268975404250, 852489282863133 },
+    { 2104894828289916, 873144584667742, 506537740149646, 646077767532773, 1966868865211605 }
+  },
+  {
+    { 17547209714618, 1910686315635228, 654955394153571, 605616689489840, 847850165913281 },
+    { 1544846481420274, 1020516003801535, 1913951223747635, 2079839202875825, 787722964414573 },
+    { 836953051260559, 1769743545147988, 699239118029628, 825806019782225, 1990070083297713 }
+  },
+  {
+    { 944214205150673, 113579352686446, 1305491360151613, 710549772492770, 1508433893219248 },
+    { 181463710138863, 324899312232426, 748437826404564, 1442893546327651, 882055388832311 },
+    { 99837384801727, 2128746966172064, 1728087272474317, 1660968164341303, 2094478837305487 }
+  }
+},
+{ /* 21/25 */
+  {
+    { 1653276489969630, 6081825167624, 1921777941170836, 1604139841794531, 861211053640641 },
+    { 996661541407379, 1455877387952927, 744312806857277, 139213896196746, 1000282908547789 },
+    { 1450817495603008, 1476865707053229, 1030490562252053, 620966950353376, 1744760161539058 }
+  },
+  {
+    { 1401939116319266, 335306339903072, 72046196085786, 862423201496006, 850518754531384 },
+    { 1234706593321979, 1083343891215917, 898273974314935, 1640859118399498, 157578398571149 },
+    { 1143483057726416, 1992614991758919, 674268662140796, 1773370048077526, 674318359920189 }
+  },
+  {
+    { 1844293295362215, 1524583677136176, 1827935191421177, 1761145652561373, 402445018996936 },
+    { 1359421012066407, 511008775933306, 1235661358650810, 121489457167998, 750643479014138 },
+    { 2163920127813722, 1809848067831371, 1226486593520438, 6568253441272, 318658165188350 }
+  },
+  {
+    { 1051236049852089, 838236098838683, 1401529863477899, 819561906490618, 1695547314615010 },
+    { 906923277717385, 1205267497856625, 1482990850447715, 814292408880760, 1285504246425383 },
+    { 342012360452061, 1887029215668228, 1155449753977691, 310762800506541, 1868750527042639 }
+  },
+  {
+    { 2045099649207179, 928566106329290, 1751707271775365, 243714904225769, 1697122639551309 },
+    { 1621210529396417, 473702830755356, 113967089143876, 2027996109593680, 334247609676783 },
+    { 65610840894268, 1859825165272831, 2126326856745773, 1697334161855958, 2126062257964925 }
+  },
+  {
+    { 2128931535981228, 1664649369637525, 827251760823705, 281379004955298, 2131845370502517 },
+    { 1549958968282246, 1414228225490689, 49341428489142, 1907649166629107, 2053446999937698 },
+    { 91328232413243, 1349171648880840, 1320143522454812, 2071016680285748, 1098830160269076 }
+  },
+  {
+    { 854573969898278, 918371593761593, 880440820932196, 330442526363771, 1985515427672874 },
+    { 371116706915478, 958241665679581, 1788343016949073, 2039742682106485, 617386814520640 },
+    { 1406636081701774, 1032905040983927, 1211964732051439, 783496875254481, 1256336848183949 }
+  },
+  {
+    { 446777329491613, 1182111476573108, 361578732926394, 969051558291558, 551871149504900 },
+    { 1502211512267751, 522814637298393, 2125300438723032, 2018782704272556, 1170472673030354 },
+    { 883746203814773, 276737323512287, 2229390196673160, 2155663378443822, 635390057802745 }
+  },
+  {
+    { 901746448893728, 535719694452731, 232367332688389, 1187239826444625, 1846767342985634 },
+    { 696694156725365, 486651037873822, 1801514994292338, 212132803137369, 361850231722772 },
+    { 830941077896381, 1322873948469225, 251496686218292, 318047334754654, 2222624896040938 }
+  },
+  {
+    { 1352880640834541, 360532727283478, 1159364083323608, 124995472839866, 1534041447364786 },
+    { 433411144892763, 1230530410714249, 1906292125361651, 1466765531131955, 919741938184793 },
+    { 1534635678949293, 1410766953739367, 418241675069218, 1896729587147142, 1827680478578861 }
+  },
+  {
+    { 308682750118944, 2191203377428859, 2246545138725771, 1754049138321491, 2156687129189500 },
+    { 881227328359103, 726015696236115, 1540593909497382, 1222487066053195, 802677171270674 },
+    { 1679686012578185, 1371607734878063, 138425201854233, 1476676924317623, 1374552427345337 }
+  },
+  {
+    { 840689961188280, 666855865921493, 2236632145763388, 553161305644429, 770093598280661 },
+    { 1845357083269366, 283024454100284, 1261058990950787, 83148423763794, 1614274061088985 },
+    { 1649953183870355, 2176771717569818, 1233096109604549, 1152511702037810, 560573824644263 }
+  },
+  {
+    { 2008352035910449, 3220462166446, 2227552503409279, 894520393273629, 148134799193470 },
+    { 875869235476678, 134925755531231, 675734772318499, 1459975059883042, 1758218695339523 },
+    { 1404434757101278, 182322009021126, 383952158933780, 1345632294052636, 160570997200964 }
+  },
+  {
+    { 1896557090818885, 2177967273225863, 688252864070162, 1162905249241173, 937700276968149 },
+    { 52817761712085, 1070719382900173, 1031179099999604, 1840566549419915, 1254523675887533 },
+    { 178945920129419, 2132448796881487, 1238333428203160, 12518861204367, 1635779697751396 }
+  },
+  {
+    { 1868460022584118, 477707895119178, 248251244708541, 809499157585398, 162751069089006 },
+    { 1092375135494391, 428349888689423, 1683929485226826, 1349279922257845, 1345709583824059 },
+    { 398018487814899, 1413472237113061, 242537396843158, 999253431182310, 2066990216613622 }
+  },
+  {
+    { 1027653299140521, 430869933716354, 39439958469758, 1392853852430383, 1280424544026220 },
+    { 1374992270629118, 886701324738892, 997915444084346, 1696807732220344, 949943622938188 },
+    { 380965098906693, 835788132761480, 2232989119976139, 2205277179143298, 1175904351372329 }
+  }
+},
+{ /* 22/25 */
+  {
+    { 708933751359100, 2107676482823116, 1657279889267301, 1609984394439769, 1082526754413784 },
+    { 1606753372548095, 1940797730019702, 2170465741030982, 557319246680918, 1999867966032864 },
+    { 1823622181083017, 408967151178094, 2033143529389867, 2209724434343478, 918118538477317 }
+  },
+  {
+    { 590468521603508, 1888183319191452, 1440689086131057, 1677336684221251, 1925080943820196 },
+    { 1585117306142537, 1612495744818187, 2023976907380213, 2224019669007289, 182352658157013 },
+    { 463491021439363, 1750609461077078, 1169967881279297, 474253519600450, 901070375860211 }
+  },
+  {
+    { 1234176672107405, 1118156106770039, 1401308706374344, 49246839018891, 129899069235955 },
+    { 2148892609267637, 156091090159501, 219195676377608, 1764671763402282, 1450853793183865 },
+    { 288029433804634, 1918327772711516, 1858109617364668, 1548745667412753, 1635036158704975 }
+  },
+  {
+    { 1915560744141480, 968144533182421, 1684794323668365, 813038486884416, 485174716721005 },
+    { 396318558702260, 1083473990827737, 904833535607248, 1965475057496774, 806903729265008 },
+    { 131383425958682, 1726194406199626, 1195125520329959, 1269440178344704, 1934708138886976 }
+  },
+  {
+    { 2185121667669569, 1115206785572251, 704158439711004, 2133851508118048, 1251130304627637 },
+    { 309139531546063, 2049522628380760, 1821330378737221, 2189050579333957, 379745028034240 },
+    { 1895230235031468, 1896812472261458, 768470747222158, 1996242383935516, 1420798451369434 }
+  },
+  {
+    { 1579856931436900, 195251954153981, 616268009970342, 1688893962924789, 2116170079089324 },
+    { 1336195493856024, 616151775822139, 132656637077528, 800859950704494, 523331976590323 },
+    { 556211501812000, 449190026847667, 2036295767110360, 128995208617458, 1118467502984960 }
+  },
+  {
+    { 1146590809115000, 1820230761045333, 438948341893375, 844036154978819, 278417404664415 },
+    { 1098861443862149, 1056118674042928, 602217524379356, 1351672530126771, 1647296273265328 },
+    { 1878982227582804, 1431346083601994, 1534977024077189, 2155113334662581, 1782950372830762 }
+  },
+  {
+    { 352512930664620, 200908289136568, 978667112601609, 2118488738947709, 52678658272637 },
+    { 194062342816527, 1511332321457621, 529868032979417, 655355508011806, 156865380492922 },
+    { 1390885694073460, 1816639772663275, 1066627353945560, 1454561122724455, 848860562366790 }
+  },
+  {
+    { 311990017335629, 1091918781323390, 7225575992672, 1392665428080843, 1419667725388688 },
+    { 1037229489569527, 1696948685764563, 756950827500384, 172789937573414, 2131746869365416 },
+    { 981545110828877, 510698765880228, 2161678679515528, 1436791773758609, 1673597748298096 }
+  },
+  {
+    { 1362423483981320, 1645590394493468, 560194225449327, 706889687388840, 112066720001886 },
+    { 2077913249267885, 435740348991502, 455102608277438, 1017083340491715, 1887945258539676 },
+    { 1294858674770242, 529668890256843, 2030539078163824, 294693146073477, 969527805905143 }
+  },
+  {
+    { 1176127152490464, 1894013131106171, 1812632908007715, 1499234933639326, 38073564802511 },
+    { 166771756371767, 1751136701203931, 463260219240212, 233141483231652, 257357799953754 },
+    { 61868149975749, 236120696290007, 608351327055311, 1829919587421069, 1627340269896729 }
+  },
+  {
+    { 1471096269274020, 1863222026681565, 2044934869352810, 1385880696113195, 1308481967864035 },
+    { 558660333338486, 437631012595498, 1856230475161709, 1064559516436452, 1138159299114818 },
+    { 1796753889379582, 2232245583163596, 176790521107364, 133826841897595, 1041041183235991 }
+  },
+  {
+    { 1172839421931844, 278706227560696, 950602465490964, 1867524240141887, 1078908361802522 },
+    { 1286134762329693, 746629033585650, 1285368254294412, 2031616339452574, 1293923059816597 },
+    { 1442655471934418, 1764674447040318, 316317796980033, 318184491515700, 1168933061547497 }
+  },
+  {
+    { 1580156396502051, 956444557002442, 223926404960590, 565074765027696, 2169726994764050 },
+    { 1348045269148289, 1645046732186345, 2051914281511704, 29227876891307, 1516962114670480 },
+    { 1942280341359651, 50425926664281, 1816034234875212, 880607828368837, 2092912650330571 }
+  },
+  {
+    { 1344167653424867, 1048535312223495, 1948741777806718, 820931006927219, 1645288196866884 },
+    { 1009166234092554, 1873916818816345, 420931069742281, 734656291044843, 1401802257793081 },
+    { 1745152490874503, 1836336442271605, 2042898833391948, 1540893062903555, 1183365031475960 }
+  },
+  {
+    { 1689713572022143, 593854559254373, 978095044791970, 1985127338729499, 1676069120347625 },
+    { 1557207018622683, 340631692799603, 1477725909476187, 614735951619419, 2033237123746766 },
+    { 968764929340557, 1225534776710944, 662967304013036, 1155521416178595, 791142883466590 }
+  }
+},
+{ /* 23/25 */
+  {
+    { 995506859453010, 174069429422226, 370685091406527, 2040657700179410, 1450858492090282 },
+    { 1421908854362862, 161715173892682, 1729749930861440, 1836384830865689, 48949287445656 },
+    { 1636572211186580, 2000987144770729, 1893417472062746, 196779160527558, 1557344243161357 }
+  },
+  {
+    { 1495731174651295, 280947107652162, 2156800382632015, 1987445924091844, 1196317565653296 },
+    { 2250306499911260, 1939747202154883, 1217632366505406, 177514286663808, 968879985948762 },
+    { 483117633444291, 1721449975252800, 2014677970681898, 2079902425951169, 117285229800651 }
+  },
+  {
+    { 1507079336277406, 16158670400411, 725842773817224, 2203610500470887, 1640888914156664 },
+    { 533526002845609, 2065287278461364, 2142958807833890, 917611533866144, 948962334848887 },
+    { 1753063336824455, 1632699439142352, 654655992711894, 254878945844677, 1142235737877277 }
+  },
+  {
+    { 471636015770351, 672455402793577, 1804995246884103, 1842309243470804, 1501862504981682 },
+    { 1013216974933691, 538921919682598, 1915776722521558, 1742822441583877, 1886550687916656 },
+    { 2094270000643336, 303971879192276, 40801275554748, 649448917027930, 1818544418535447 }
+  },
+  {
+    { 1148080446050112, 2132613961523904, 1250420090952542, 1073606637042265, 1136316631918667 },
+    { 432364473242774, 39743790059724, 220093305287024, 882695210228712, 1250284879006172 },
+    { 1308793608120261, 1449040386580588, 1101631154183215, 1497130864799324, 169852361549146 }
+  },
+  {
+    { 226003849082303, 601179975359759, 940631827741356, 1127612465735266, 1440820191536310 },
+    { 1495639527602816, 57301448208046, 1451497740129468, 55936708618434, 964571251189964 },
+    { 123418138995758, 1978567312772587, 1348730554478157, 544009099976318, 1458271200647609 }
+  },
+  {
+    { 2069974909117054, 1308061796902428, 18943199885610, 583641514327845, 1473321168223286 },
+    { 1178878122763439, 651039868237756, 1648769735446867, 222010915543153, 265722501450619 },
+    { 186894202868784, 669642538748472, 1751029408900890, 1452410162706295, 822484923996253 }
+  },
+  {
+    { 2241737709499165, 549397817447461, 838180519319392, 1725686958520781, 1705639080897747 },
+    { 1216074541925116, 50120933933509, 1565829004133810, 721728156134580, 349206064666188 },
+    { 948617110470858, 346222547451945, 1126511960599975, 1759386906004538, 493053284802266 }
+  },
+  {
+    { 280010732133130, 1127293372965981, 697004887613663, 1905238191128068, 59718893485038 },
+    { 1882853235706949, 1486349571810895, 315344009398372, 1720850569909845, 1885508469335244 },
+    { 302250423214367, 1199248533314516, 412562080741735, 342674503581715, 2011860141589142 }
+  },
+  {
+    { 1115724079290882, 996151854744842, 243820983295152, 195938920815985, 2033304248964972 },
+    { 139923192654984, 2107130100572776, 1240777965371817, 2103236269512710, 1663961419492268 },
+    { 1690516266667235, 1717206722742664, 2018042702156749, 464771311355946, 1988881378065658 }
+  },
+  {
+    { 1381412085068908, 732552219394798, 301501327778185, 724616833762094, 2176374340517301 },
+    { 1360232738930430, 1681103625656341, 1681678041101659, 1002066218704533, 974084946079387 },
+    { 851280348776322, 502663124878735, 236458711302258, 1405209842341265, 32876714630465 }
+  },
+  {
+    { 1454933046815146, 874696014266362, 1467170975468588, 1432316382418897, 2111710746366763 },
+    { 2105387117364450, 1996463405126433, 1303008614294500, 851908115948209, 1353742049788635 },
+    { 750300956351719, 1487736556065813, 15158817002104, 1511998221598392, 971739901354129 }
+  },
+  {
+    { 880882702716428, 1343016116845607, 673480262952192, 845417915536923, 1757668258348114 },
+    { 516635705924950, 389437712595068, 953767331309091, 85616409135632, 1899366837799687 },
+    { 1366945846088313, 397665071074633, 2041470664790369, 1336251042978385, 402822314074967 }
+  },
+  {
+    { 1766199893942014, 2222443124693628, 398404112948141, 2156049858134716, 724839098982177 },
+    { 1571960295737743, 741550805159082, 2210044322631075, 2049659627493195, 1095433159356314 },
+    { 1240686409044907, 1039246640562740, 873168255244058, 843905570744233, 770445828097935 }
+  },
+  {
+    { 134089861572677, 1170046804773399, 1042699677041134, 1452901496172787, 1342772147908152 },
+    { 1976930657209303, 604256764565367, 942565869803012, 1969793213537015, 287887744771686 },
+    { 1734092303337487, 655166109590567, 169444734753546, 107887918923613, 1936609614094343 }
+  },
+  {
+    { 1874648163531693, 2124487685930551, 1810030029384882, 918400043048335, 586348627300650 },
+    { 1235084464747900, 1166111146432082, 1745394857881591, 1405516473883040, 4463504151617 },
+    { 1663810156463827, 327797390285791, 1341846161759410, 1964121122800605, 1747470312055380 }
+  }
+},
+{ /* 24/25 */
+  {
+    { 2237039662793603, 2249022333361206, 2058613546633703, 149454094845279, 2215176649164582 },
+    { 79472182719605, 1851130257050174, 1825744808933107, 821667333481068, 781795293511946 },
+    { 755822026485370, 152464789723500, 1178207602290608, 410307889503239, 156581253571278 }
+  },
+  {
+    { 1418185496130297, 484520167728613, 1646737281442950, 1401487684670265, 1349185550126961 },
+    { 1495380034400429, 325049476417173, 46346894893933, 1553408840354856, 828980101835683 },
+    { 1280337889310282, 2070832742866672, 1640940617225222, 2098284908289951, 450929509534434 }
+  },
+  {
+    { 407703353998781, 126572141483652, 286039827513621, 1999255076709338, 2030511179441770 },
+    { 1254958221100483, 1153235960999843, 942907704968834, 637105404087392, 1149293270147267 },
+    { 894249020470196, 400291701616810, 406878712230981, 1599128793487393, 1145868722604026 }
+  },
+  {
+    { 1497955250203334, 110116344653260, 1128535642171976, 1900106496009660, 129792717460909 },
+    { 452487513298665, 1352120549024569, 1173495883910956, 1999111705922009, 367328130454226 },
+    { 1717539401269642, 1475188995688487, 891921989653942, 836824441505699, 1885988485608364 }
+  },
+  {
+    { 1241784121422547, 187337051947583, 1118481812236193, 428747751936362, 30358898927325 },
+    { 2022432361201842, 1088816090685051, 1977843398539868, 1854834215890724, 564238862029357 },
+    { 938868489100585, 1100285072929025, 1017806255688848, 1957262154788833, 152787950560442 }
+  },
+  {
+    { 867319417678923, 620471962942542, 226032203305716, 342001443957629, 1761675818237336 },
+    { 1295072362439987, 931227904689414, 1355731432641687, 922235735834035, 892227229410209 },
+    { 1680989767906154, 535362787031440, 2136691276706570, 1942228485381244, 1267350086882274 }
+  },
+  {
+    { 366018233770527, 432660629755596, 126409707644535, 1973842949591662, 645627343442376 },
+    { 535509430575217, 546885533737322, 1524675609547799, 2138095752851703, 1260738089896827 },
+    { 1159906385590467, 2198530004321610, 714559485023225, 81880727882151, 1484020820037082 }
+  },
+  {
+    { 1377485731340769, 2046328105512000, 1802058637158797, 62146136768173, 1356993908853901 },
+    { 2013612215646735, 1830770575920375, 536135310219832, 609272325580394, 270684344495013 },
+    { 1237542585982777, 2228682050256790, 1385281931622824, 593183794882890, 493654978552689 }
+  },
+  {
+    { 1448933928004639, 2019165860436684, 839545028551310, 954045289946680, 605871795457102 },
+    { 2181948027120817, 1469821966663216, 495537385849601, 447095384662436, 711932068643874 },
+    { 2031235379883797, 946220755552074, 1457648474415011, 1222951728743327, 1610191601040290 }
+  },
+  {
+    { 1461436857021091, 1708249553383011, 1441184960961852, 2138372449656361, 2208801341603864 },
+    { 1910495819629329, 243904881001403, 916503175988358, 737664162956505, 148512866676450 },
+    { 743176047113998, 1210025633688996, 1298930577649249, 2241929289171655, 319185600078644 }
+  },
+  {
+    { 109955663596505, 1668279743409002, 1772761852174941, 2188727617473580, 1972330964627961 },
+    { 211874206232687, 299241082919300, 1560447662280358, 777739777537607, 1611135468853981 },
+    { 2224894613062235, 459022333460366, 853633232091964, 42662368548958, 1428459390829900 }
+  },
+  {
+    { 1888400628800904, 994643156686671, 2048876033526184, 418388094414663, 2174354817875660 },
+    { 1373340083891363, 979957454916983, 1089096356271731, 237603348017998, 995178316184850 },
+    { 1865410028261408, 627467389699032, 146077987303115, 1698467014229834, 2014393109530681 }
+  },
+  {
+    { 418844978152214, 399963620508069, 33220232591578, 2227807589256769, 1464013488829088 },
+    { 1087327009286572, 1463860919773049, 407789662304423, 1950415221080672, 1074473983968709 },
+    { 1806473647942365, 538787999504182, 512973154409687, 1944932181085518, 1069910541821032 }
+  },
+  {
+    { 342138165311106, 157664552291421, 2076140577147017, 2175301861378049, 1879995664155907 },
+    { 382958515679658, 355913288431307, 424788048423920, 2186335772603459, 1408707358783051 },
+    { 407209884855019, 2088464831333939, 2111856537862679, 1631244096914416, 1074707055277992 }
+  },
+  {
+    { 502401202015822, 2110371415921011, 277866920771080, 515443390912203, 89974392681169 },
+    { 2127890637662291, 1895922559173190, 1539875255118981, 1579085739040792, 980339195955319 },
+    { 1547018311600067, 615783499206767, 485547569767288, 1517514580034299, 457611163959317 }
+  },
+  {
+    { 1941635877650350, 41136794015779, 802548087270427, 553714331402352, 386035892408446 },
+    { 1253759950575250, 1509487323905258, 578311512025850, 212916427969408, 1753384794452412 },
+    { 1415499622184076, 11739232724558, 1448526577403933, 77973485783393, 148463223858677 }
+  }
+},
+{ /* 25/25 */
+  {
+    { 160425464456957, 950394373239689, 430497123340934, 711676555398832, 320964687779005 },
+    { 988979367990485, 1359729327576302, 1301834257246029, 294141160829308, 29348272277475 },
+    { 1434382743317910, 100082049942065, 221102347892623, 186982837860588, 1305765053501834 }
+  },
+  {
+    { 1050627428414972, 1955849529137135, 2171162376368357, 91745868298214, 447733118757826 },
+    { 1287181461435438, 622722465530711, 880952150571872, 741035693459198, 311565274989772 },
+    { 1003649078149734, 545233927396469, 1849786171789880, 1318943684880434, 280345687170552 }
+  },
+  {
+    { 2006252393530958, 1508680571996938, 954356197543577, 1837108886184047, 759769646125864 },
+    { 2172698567966722, 2118345352277226, 2051996099547069, 169753363515973, 1287452493356373 },
+    { 1187304510804619, 1384816718516187, 514455602674227, 392638325371554, 588228521113051 }
+  },
+  {
+    { 1650059244213943, 1415687339027798, 1500141786956787, 2204874486713657, 1294277876097258 },
+    { 137033802346169, 2184552721577514, 539064280617532, 2076540099477398, 2066610116555437 },
+    { 1247200432261975, 265507035905438, 1620404126253617, 117362009527087, 1746435297969059 }
+  },
+  {
+    { 1825437392176699, 907686900853553, 913817474999877, 376847311554936, 952900901511161 },
+    { 16460943316339, 865363558338269, 1081126913053728, 1984198566210168, 693911739678591 },
+    { 1735892608800937, 252059696064385, 2231277656792353, 190315520487156, 1578798653560771 }
+  },
+  {
+    { 1517000678259824, 1483997169941967, 519539722731871, 2033134998312037, 1358032943031124 },
+    { 1528712817748752, 2017766428018612, 1162174112266416, 1812385611328308, 2144712073347724 },
+    { 1731716537145363, 1794467547859624, 1646162317162994, 364913230037059, 415641914630240 }
+  },
+  {
+    { 867102314969295, 177204163640709, 932706101724694, 895760037431074, 1926657328393370 },
+    { 1615507189218466, 2553618189771, 29515181389582, 2060787976858393, 452569105748765 },
+    { 2164447073692030, 2235474886627512, 1180432651596109, 840434165754520, 17225464249081 }
+  },
+  {
+    { 1068629703061668, 984762690851450, 1229949103789232, 2110232841828031, 1092532788851750 },
+    { 837136640501665, 1043670615489504, 2155335349713680, 1236566668693657, 1494720534426543 },
+    { 1306097687903586, 1372543655508231, 1658076721821581, 2200003583698537, 780636112677937 }
+  },
+  {
+    { 2117492307368618, 1709168226535565, 233762331859812, 425438867395335, 1601057748246597 },
+    { 1793659836722917, 791157320000450, 1901380703911097, 671210109200346, 409461673241960 },
+    { 845069008464407, 979039615485579, 193913017996729, 449879767959326, 372738561109212 }
+  },
+  {
+    { 2213523598938004, 242589778847459, 1840956814213720, 1295450969278652, 543389038840695 },
+    { 1502648328069200, 1891078433514958, 74786055052185, 656832420233058, 390753562081660 },
+    { 1195481634064188, 1329844785302194, 1313462918982248, 1107475649619426, 7376324807793 }
+  },
+  {
+    { 1395918219101738, 521559556798277, 2189317053846815, 1618186630396527, 1208380551587558 },
+    { 1404241202649408, 1571994130452022, 1929757983495880, 2092872400096433, 1055397564628322 },
+    { 324936075779920, 1871771077744824, 760721314708887, 2236253813618340, 1107848804577326 }
+  },
+  {
+    { 814536290823781, 63061116467332, 804840198178091, 8292666531281, 2073254466378785 },
+    { 722478309804879, 1188829196206039, 1185414523406556, 1657025426781102, 1841660092890563 },
+    { 479894784370716, 1925880613677947, 2183487522494884, 625094381313712, 854845126872293 }
+  },
+  {
+    { 1127107758910429, 963256815453345, 978307767128825, 1110718515966990, 1940414529352487 },
+    { 1111964474543301, 224153643182257, 745303967966921, 2180916147150830, 808318254462192 },
+    { 859228221529707, 1739781089337288, 1717872097995933, 1768216878921818, 2055937047555311 }
+  },
+  {
+    { 346901336251706, 522666938795821, 407326620676165, 524211963138110, 1927605057667425 },
+    { 295157005295797, 1746357151504686, 2161437362296206, 820950684322906, 693759980607742 },
+    { 1888381489837910, 196623655731183, 1928045727190681, 647052441821743, 272992419588845 }
+  },
+  {
+    { 1138008309343278, 1286256331388491, 1263031548713040, 1987411587031699, 1325648720658323 },
+    { 48319968529799, 1333709797519536, 433601958427117, 995311274909489, 1648361620654503 },
+    { 614829280308208, 1807262149284119, 168113001819420, 1469257028090658, 1941994949215280 }
+  },
+  {
+    { 817093479351430, 1836962122101804, 919916971324812, 476742058422480, 1520644895959803 },
+    { 694018530392140, 2181664308275944, 1008881841276548, 1869175821107034, 1331662548691003 },
+    { 1207982418891449, 1577854720087533, 2009037012572541, 1476807775109585, 764858983320152 }
+  }
+}
@@ -0,0 +1,200 @@
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "private/common.h"
+#include "utils.h"
+
+#if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+
+# ifdef __GNUC__
+#  pragma GCC target("sse2")
+#  pragma GCC target("ssse3")
+#  pragma GCC target("sse4.1")
+#  pragma GCC target("avx2")
+# endif
+
+# include <emmintrin.h>
+# include <immintrin.h>
+# include <smmintrin.h>
+# include <tmmintrin.h>
+
+# include "sha256_avx2.h"
+
+static const uint32_t Krnd[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static const uint32_t sha256_initial_state[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static const unsigned char zero_block[64];
+
+# define ADD(x, y) _mm256_add_epi32((x), (y))
+# define XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+# define ROTR(x, n) \
+    _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+# define SHR(x, n) _mm256_srli_epi32((x), (n))
+
+# define Ch(x, y, z) \
+    _mm256_xor_si256(_mm256_and_si256((x), _mm256_xor_si256((y), (z))), (z))
+# define Maj(x, y, z)                                                        \
+    _mm256_or_si256(_mm256_and_si256((x), _mm256_or_si256((y), (z))),        \
+                    _mm256_and_si256((y), (z)))
+# define S0(x) XOR3(ROTR((x), 2), ROTR((x), 13), ROTR((x), 22))
+# define S1(x) XOR3(ROTR((x), 6), ROTR((x), 11), ROTR((x), 25))
+# define s0(x) XOR3(ROTR((x), 7), ROTR((x), 18), SHR((x), 3))
+# define s1(x) XOR3(ROTR((x), 17), ROTR((x), 19), SHR((x), 10))
+
+/* Loads 8 consecutive big-endian words from each lane, one word per vector */
+static void
+load_transposed(__m256i w[8], const unsigned char *const p[8], size_t offset)
+{
+    const __m256i bswap = _mm256_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+                                          4, 5, 6, 7, 0, 1, 2, 3,
+                                          12, 13, 14, 15, 8, 9, 10, 11,
+                                          4, 5, 6, 7, 0, 1, 2, 3);
+    __m256i       r[8], t[8], u[8];
+    int           i;
+
+    for (i = 0; i < 8; i++) {
+        r[i] = _mm256_loadu_si256((const __m256i *) (const void *) (p[i] + offset));
+    }
+    for (i = 0; i < 8; i += 2) {
+        t[i]     = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    for (i = 0; i < 8; i += 4) {
+        u[i]     = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (i = 0; i < 4; i++) {
+        w[i]     = _mm256_shuffle_epi8(
+            _mm256_permute2x128_si256(u[i], u[i + 4], 0x20), bswap);
+        w[i + 4] = _mm256_shuffle_epi8(
+            _mm256_permute2x128_si256(u[i], u[i + 4], 0x31), bswap);
+    }
+}
+
+static void
+sha256_blocks8(__m256i state[8], const unsigned char *const p[8],
+               __m256i active, __m256i W[64])
+{
+    __m256i S[8];
+    __m256i t0, t1;
+    int     i;
+
+    load_transposed(&W[0], p, 0);
+    load_transposed(&W[8], p, 32);
+    for (i = 16; i < 64; i++) {
+        W[i] = ADD(ADD(s1(W[i - 2]), W[i - 7]), ADD(s0(W[i - 15]), W[i - 16]));
+    }
+    memcpy(S, state, sizeof S);
+    for (i = 0; i < 64; i++) {
+        t0 = ADD(ADD(S[7], S1(S[4])),
+                 ADD(Ch(S[4], S[5], S[6]),
+                     ADD(_mm256_set1_epi32((int) Krnd[i]), W[i])));
+        t1 = ADD(S0(S[0]), Maj(S[0], S[1], S[2]));
+        S[7] = S[6];
+        S[6] = S[5];
+        S[5] = S[4];
+        S[4] = ADD(S[3], t0);
+        S[3] = S[2];
+        S[2] = S[1];
+        S[1] = S[0];
+        S[0] = ADD(t0, t1);
+    }
+    for (i = 0; i < 8; i++) {
+        state[i] = _mm256_blendv_epi8(state[i], ADD(state[i], S[i]), active);
+    }
+}
+
+/* Hashes count <= 8 independent messages, one per 32-bit lane. Each lane
+ * reads its full blocks from the message, then one or two padded blocks
+ * from a local copy of its tail; lanes with fewer blocks idle on a zero
+ * block and keep their state. */
+void
+sha256_hash_avx2(unsigned char *out, const unsigned char *const *in,
+                 const unsigned long long *inlen, size_t count)
+{
+    CRYPTO_ALIGN(32) uint32_t digests[8][8];
+    unsigned char             tail[8][128];
+    __m256i                   W[64];
+    __m256i                   state[8];
+    const unsigned char      *p[8];
+    unsigned long long        full[8];
+    unsigned long long        blocks[8];
+    unsigned long long        max_blocks = 0U;
+    unsigned long long        b;
+    size_t                    i;
+    size_t                    r;
+
+    memset(tail, 0, sizeof tail);
+    for (i = 0; i < 8; i++) {
+        full[i] = blocks[i] = 0U;
+        if (i >= count) {
+            continue;
+        }
+        full[i] = inlen[i] / 64U;
+        r       = (size_t) (inlen[i] & 63U);
+        if (r > 0U) {
+            memcpy(tail[i], in[i] + full[i] * 64U, r);
+        }
+        tail[i][r] = 0x80;
+        blocks[i]  = full[i] + (r < 56U ? 1U : 2U);
+        STORE64_BE(&tail[i][(blocks[i] - full[i]) * 64U - 8U],
+                   (uint64_t) inlen[i] << 3);
+        if (blocks[i] > max_blocks) {
+            max_blocks = blocks[i];
+        }
+    }
+    for (i = 0; i < 8; i++) {
+        state[i] = _mm256_set1_epi32((int) sha256_initial_state[i]);
+    }
+    for (b = 0U; b < max_blocks; b++) {
+        for (i = 0; i < 8; i++) {
+            if (b < full[i]) {
+                p[i] = in[i] + b * 64U;
+            } else if (b < blocks[i]) {
+                p[i] = tail[i] + (b - full[i]) * 64U;
+            } else {
+                p[i] = zero_block;
+            }
+        }
+        sha256_blocks8(state, p,
+                       _mm256_set_epi32(-(int) (b < blocks[7]), -(int) (b < blocks[6]),
+                                        -(int) (b < blocks[5]), -(int) (b < blocks[4]),
+                                        -(int) (b < blocks[3]), -(int) (b < blocks[2]),
+                                        -(int) (b < blocks[1]), -(int) (b < blocks[0])),
+                       W);
+    }
+    for (i = 0; i < 8; i++) {
+        _mm256_store_si256((__m256i *) (void *) digests[i], state[i]);
+    }
+    for (i = 0; i < count; i++) {
+        for (r = 0; r < 8; r++) {
+            STORE32_BE(out + i * 32U + r * 4U, digests[r][i]);
+        }
+    }
+    sodium_memzero(W, sizeof W);
+    sodium_memzero(tail, sizeof tail);
+    sodium_memzero(digests, sizeof digests);
+}
+
+#endif
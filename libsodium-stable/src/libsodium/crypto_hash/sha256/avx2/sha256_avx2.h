@@ -0,0 +1,11 @@
+#ifndef sha256_avx2_H
+#define sha256_avx2_H
+
+#include <stddef.h>
+
+#define SHA256_AVX2_LANES 8U
+
+void sha256_hash_avx2(unsigned char *out, const unsigned char *const *in,
+                      const unsigned long long *inlen, size_t count);
+
+#endif
@@ -35,8 +35,22 @@
 
 #include "crypto_hash_sha256.h"
 #include "private/common.h"
+#include "private/implementations.h"
+#include "runtime.h"
 #include "utils.h"
 
+#include "../avx2/sha256_avx2.h"
+#include "../shani/sha256_shani.h"
+
+#if defined(HAVE_SHAINTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+# define HAVE_SHA256_SHANI 1
+#endif
+#if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+# define HAVE_SHA256_AVX2 1
+#endif
+
 static void
 be32enc_vect(unsigned char *dst, const uint32_t *src, size_t len)
 {
@@ -144,6 +158,44 @@ SHA256_Transform(uint32_t state[8], const uint8_t block[64], uint32_t W[64],
     }
 }
 
+typedef void (*sha256_transform_fn)(uint32_t state[8], const uint8_t *in,
+                                    size_t blocks, uint32_t tmp32[64 + 8]);
+
+static void
+SHA256_Transform_ref(uint32_t state[8], const uint8_t *in, size_t blocks,
+                     uint32_t tmp32[64 + 8])
+{
+    while (blocks-- > 0U) {
+        SHA256_Transform(state, in, &tmp32[0], &tmp32[64]);
+        in += 64;
+    }
+}
+
+#ifdef HAVE_SHA256_SHANI
+static void
+SHA256_Transform_shani(uint32_t state[8], const uint8_t *in, size_t blocks,
+                       uint32_t tmp32[64 + 8])
+{
+    (void) tmp32;
+    sha256_transform_shani(state, in, blocks);
+}
+#endif
+
+static sha256_transform_fn SHA256_Transform_blocks = SHA256_Transform_ref;
+
+/* Hashes up to SHA256_lanes independent messages at once, NULL if that
+ * wouldn't be faster than hashing them one after the other */
+typedef void (*sha256_hash_lanes_fn)(unsigned char *out,
+                                    const unsigned char *const *in,
+                                    const unsigned long long *inlen,
+                                    size_t count);
+
+static sha256_hash_lanes_fn SHA256_hash_lanes = NULL;
+static size_t               SHA256_lanes      = 1U;
+
+/* Fewer messages are hashed one by one */
+#define SHA256_BATCH_MIN 2U
+
 static const uint8_t PAD[64] = { 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
                                  0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
                                  0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -165,11 +217,11 @@ SHA256_Pad(crypto_hash_sha256_state *state, uint32_t tmp32[64 + 8])
         for (i = 0; i < 64 - r; i++) {
             state->buf[r + i] = PAD[i];
         }
-        SHA256_Transform(state->state, state->buf, &tmp32[0], &tmp32[64]);
+        SHA256_Transform_blocks(state->state, state->buf, 1U, tmp32);
         memset(&state->buf[0], 0, 56);
     }
     STORE64_BE(&state->buf[56], state->count);
-    SHA256_Transform(state->state, state->buf, &tmp32[0], &tmp32[64]);
+    SHA256_Transform_blocks(state->state, state->buf, 1U, tmp32);
 }
 
 int
@@ -209,14 +261,13 @@ crypto_hash_sha256_update(crypto_hash_sha256_state *state,
     for (i = 0; i < 64 - r; i++) {
         state->buf[r + i] = in[i];
     }
-    SHA256_Transform(state->state, state->buf, &tmp32[0], &tmp32[64]);
+    SHA256_Transform_blocks(state->state, state->buf, 1U, tmp32);
     in += 64 - r;
     inlen -= 64 - r;
 
-    while (inlen >= 64) {
-        SHA256_Transform(state->state, in, &tmp32[0], &tmp32[64]);
-        in += 64;
-        inlen -= 64;
+    if (inlen >= 64) {
+        SHA256_Transform_blocks(state->state, in, (size_t) (inlen / 64), tmp32);
+        in += inlen & ~(unsigned long long) 63;
     }
     inlen &= 63;
     for (i = 0; i < inlen; i++) {
@@ -252,3 +303,75 @@ crypto_hash_sha256(unsigned char *out, const unsigned char *in,
 
     return 0;
 }
+
+int
+crypto_hash_sha256_batch(unsigned char *out, const unsigned char *const *in,
+                         const unsigned long long *inlen, size_t count)
+{
+    size_t n;
+
+    while (count > 0U) {
+        if (SHA256_hash_lanes != NULL && count >= SHA256_BATCH_MIN) {
+            n = count < SHA256_lanes ? count : SHA256_lanes;
+            SHA256_hash_lanes(out, in, inlen, n);
+        } else {
+            n = 1U;
+            crypto_hash_sha256(out, in[0], inlen[0]);
+        }
+        out += n * crypto_hash_sha256_BYTES;
+        in += n;
+        inlen += n;
+        count -= n;
+    }
+    return 0;
+}
+
+int
+_crypto_hash_sha256_pick_best_implementation(void)
+{
+/* LCOV_EXCL_START */
+    /* One message at a time with SHA-NI beats 8 lanes of AVX2 */
+    if (_crypto_hash_sha256_set_implementation(CRYPTO_HASH_IMPL_SHANI) != 0 &&
+        _crypto_hash_sha256_set_implementation(CRYPTO_HASH_IMPL_AVX2) != 0) {
+        _crypto_hash_sha256_set_implementation(CRYPTO_HASH_IMPL_REF);
+    }
+    return 0;
+/* LCOV_EXCL_STOP */
+}
+
+int
+_crypto_hash_sha256_set_implementation(int impl)
+{
+    switch (impl) {
+    case CRYPTO_HASH_IMPL_BEST:
+        return _crypto_hash_sha256_pick_best_implementation();
+    case CRYPTO_HASH_IMPL_REF:
+        SHA256_Transform_blocks = SHA256_Transform_ref;
+        SHA256_hash_lanes       = NULL;
+        SHA256_lanes            = 1U;
+        return 0;
+#ifdef HAVE_SHA256_SHANI
+    case CRYPTO_HASH_IMPL_SHANI:
+        if (!sodium_runtime_has_shani()) {
+            break;
+        }
+        SHA256_Transform_blocks = SHA256_Transform_shani;
+        SHA256_hash_lanes       = NULL;
+        SHA256_lanes            = 1U;
+        return 0;
+#endif
+#ifdef HAVE_SHA256_AVX2
+    case CRYPTO_HASH_IMPL_AVX2:
+        if (!sodium_runtime_has_avx2()) {
+            break;
+        }
+        SHA256_Transform_blocks = SHA256_Transform_ref;
+        SHA256_hash_lanes       = sha256_hash_avx2;
+        SHA256_lanes            = SHA256_AVX2_LANES;
+        return 0;
+#endif
+    default:
+        break;
+    }
+    return -1;
+}
@@ -0,0 +1,129 @@
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "private/common.h"
+
+#if defined(HAVE_SHAINTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+
+# ifdef __GNUC__
+#  pragma GCC target("sse2")
+#  pragma GCC target("ssse3")
+#  pragma GCC target("sse4.1")
+#  pragma GCC target("sha")
+# endif
+
+# include <emmintrin.h>
+# include <immintrin.h>
+# include <smmintrin.h>
+# include <tmmintrin.h>
+
+# include "sha256_shani.h"
+
+CRYPTO_ALIGN(16)
+static const uint32_t Krnd[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/* Four rounds with message words M, two per sha256rnds2 */
+# define RNDS4(M, I)                                                         \
+    do {                                                                     \
+        msg    = _mm_add_epi32((M), _mm_load_si128((const __m128i *) &Krnd[I])); \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);                 \
+        msg    = _mm_shuffle_epi32(msg, 0x0e);                               \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, msg);                 \
+    } while (0)
+
+/* Completes the next message words NEXT from the current ones CUR and the
+ * previous ones PREV, then starts the schedule of PREV's successors */
+# define SCHED(CUR, PREV, NEXT)                                              \
+    do {                                                                     \
+        NEXT = _mm_add_epi32(NEXT, _mm_alignr_epi8(CUR, PREV, 4));           \
+        NEXT = _mm_sha256msg2_epu32(NEXT, CUR);                              \
+        PREV = _mm_sha256msg1_epu32(PREV, CUR);                              \
+    } while (0)
+
+void
+sha256_transform_shani(uint32_t state[8], const unsigned char *in,
+                       size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11,
+                                       4, 5, 6, 7, 0, 1, 2, 3);
+    __m128i       state0, state1, abef, cdgh;
+    __m128i       msg, m0, m1, m2, m3;
+    __m128i       t;
+
+    /* ABCD EFGH -> ABEF CDGH, the layout sha256rnds2 works on */
+    t      = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[0]),
+                               0xb1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *) &state[4]),
+                               0x1b);
+    state0 = _mm_alignr_epi8(t, state1, 8);
+    state1 = _mm_blend_epi16(state1, t, 0xf0);
+
+    while (blocks-- > 0U) {
+        abef = state0;
+        cdgh = state1;
+
+        m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 0)), bswap);
+        m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 16)), bswap);
+        m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 32)), bswap);
+        m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + 48)), bswap);
+
+        RNDS4(m0, 0);
+        RNDS4(m1, 4);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        RNDS4(m2, 8);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+        RNDS4(m3, 12);
+        SCHED(m3, m2, m0);
+        RNDS4(m0, 16);
+        SCHED(m0, m3, m1);
+        RNDS4(m1, 20);
+        SCHED(m1, m0, m2);
+        RNDS4(m2, 24);
+        SCHED(m2, m1, m3);
+        RNDS4(m3, 28);
+        SCHED(m3, m2, m0);
+        RNDS4(m0, 32);
+        SCHED(m0, m3, m1);
+        RNDS4(m1, 36);
+        SCHED(m1, m0, m2);
+        RNDS4(m2, 40);
+        SCHED(m2, m1, m3);
+        RNDS4(m3, 44);
+        SCHED(m3, m2, m0);
+        RNDS4(m0, 48);
+        SCHED(m0, m3, m1);
+        RNDS4(m1, 52);
+        m2 = _mm_add_epi32(m2, _mm_alignr_epi8(m1, m0, 4));
+        m2 = _mm_sha256msg2_epu32(m2, m1);
+        RNDS4(m2, 56);
+        m3 = _mm_add_epi32(m3, _mm_alignr_epi8(m2, m1, 4));
+        m3 = _mm_sha256msg2_epu32(m3, m2);
+        RNDS4(m3, 60);
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        in += 64;
+    }
+
+    /* ABEF CDGH -> ABCD EFGH */
+    t      = _mm_shuffle_epi32(state0, 0x1b);
+    state1 = _mm_shuffle_epi32(state1, 0xb1);
+    _mm_storeu_si128((__m128i *) &state[0], _mm_blend_epi16(t, state1, 0xf0));
+    _mm_storeu_si128((__m128i *) &state[4], _mm_alignr_epi8(state1, t, 8));
+}
+
+#endif
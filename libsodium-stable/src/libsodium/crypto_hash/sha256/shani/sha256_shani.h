@@ -0,0 +1,10 @@
+#ifndef sha256_shani_H
+#define sha256_shani_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+void sha256_transform_shani(uint32_t state[8], const unsigned char *in,
+                            size_t blocks);
+
+#endif
@@ -0,0 +1,210 @@
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "private/common.h"
+#include "utils.h"
+
+#if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+
+# ifdef __GNUC__
+#  pragma GCC target("sse2")
+#  pragma GCC target("ssse3")
+#  pragma GCC target("sse4.1")
+#  pragma GCC target("avx2")
+# endif
+
+# include <emmintrin.h>
+# include <immintrin.h>
+# include <smmintrin.h>
+# include <tmmintrin.h>
+
+# include "sha512_avx2.h"
+
+static const uint64_t Krnd[80] = {
+    0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL,
+    0xe9b5dba58189dbbcULL, 0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL,
+    0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL, 0xd807aa98a3030242ULL,
+    0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+    0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL,
+    0xc19bf174cf692694ULL, 0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL,
+    0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL, 0x2de92c6f592b0275ULL,
+    0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+    0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL,
+    0xbf597fc7beef0ee4ULL, 0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL,
+    0x06ca6351e003826fULL, 0x142929670a0e6e70ULL, 0x27b70a8546d22ffcULL,
+    0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+    0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL,
+    0x92722c851482353bULL, 0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL,
+    0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL, 0xd192e819d6ef5218ULL,
+    0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+    0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL,
+    0x34b0bcb5e19b48a8ULL, 0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL,
+    0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL, 0x748f82ee5defb2fcULL,
+    0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+    0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL,
+    0xc67178f2e372532bULL, 0xca273eceea26619cULL, 0xd186b8c721c0c207ULL,
+    0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL, 0x06f067aa72176fbaULL,
+    0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+    0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL,
+    0x431d67c49c100d4cULL, 0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL,
+    0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL
+};
+
+static const uint64_t sha512_initial_state[8] = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
+    0xa54ff53a5f1d36f1ULL, 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+static const unsigned char zero_block[128];
+
+# define ADD(x, y) _mm256_add_epi64((x), (y))
+# define XOR3(x, y, z) _mm256_xor_si256(_mm256_xor_si256((x), (y)), (z))
+# define ROTR(x, n) \
+    _mm256_or_si256(_mm256_srli_epi64((x), (n)), _mm256_slli_epi64((x), 64 - (n)))
+# define SHR(x, n) _mm256_srli_epi64((x), (n))
+
+# define Ch(x, y, z) \
+    _mm256_xor_si256(_mm256_and_si256((x), _mm256_xor_si256((y), (z))), (z))
+# define Maj(x, y, z)                                                        \
+    _mm256_or_si256(_mm256_and_si256((x), _mm256_or_si256((y), (z))),        \
+                    _mm256_and_si256((y), (z)))
+# define S0(x) XOR3(ROTR((x), 28), ROTR((x), 34), ROTR((x), 39))
+# define S1(x) XOR3(ROTR((x), 14), ROTR((x), 18), ROTR((x), 41))
+# define s0(x) XOR3(ROTR((x), 1), ROTR((x), 8), SHR((x), 7))
+# define s1(x) XOR3(ROTR((x), 19), ROTR((x), 61), SHR((x), 6))
+
+/* Loads 4 consecutive big-endian words from each lane, one word per vector */
+static void
+load_transposed(__m256i w[4], const unsigned char *const p[4], size_t offset)
+{
+    const __m256i bswap = _mm256_set_epi8(8, 9, 10, 11, 12, 13, 14, 15,
+                                          0, 1, 2, 3, 4, 5, 6, 7,
+                                          8, 9, 10, 11, 12, 13, 14, 15,
+                                          0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i       r[4], t[4];
+    int           i;
+
+    for (i = 0; i < 4; i++) {
+        r[i] = _mm256_loadu_si256((const __m256i *) (const void *) (p[i] + offset));
+    }
+    t[0] = _mm256_unpacklo_epi64(r[0], r[1]);
+    t[1] = _mm256_unpackhi_epi64(r[0], r[1]);
+    t[2] = _mm256_unpacklo_epi64(r[2], r[3]);
+    t[3] = _mm256_unpackhi_epi64(r[2], r[3]);
+    w[0] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t[0], t[2], 0x20), bswap);
+    w[1] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t[1], t[3], 0x20), bswap);
+    w[2] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t[0], t[2], 0x31), bswap);
+    w[3] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(t[1], t[3], 0x31), bswap);
+}
+
+static void
+sha512_blocks4(__m256i state[8], const unsigned char *const p[4],
+               __m256i active, __m256i W[80])
+{
+    __m256i S[8];
+    __m256i t0, t1;
+    int     i;
+
+    for (i = 0; i < 16; i += 4) {
+        load_transposed(&W[i], p, (size_t) i * 8U);
+    }
+    for (i = 16; i < 80; i++) {
+        W[i] = ADD(ADD(s1(W[i - 2]), W[i - 7]), ADD(s0(W[i - 15]), W[i - 16]));
+    }
+    memcpy(S, state, sizeof S);
+    for (i = 0; i < 80; i++) {
+        t0 = ADD(ADD(S[7], S1(S[4])),
+                 ADD(Ch(S[4], S[5], S[6]),
+                     ADD(_mm256_set1_epi64x((long long) Krnd[i]), W[i])));
+        t1 = ADD(S0(S[0]), Maj(S[0], S[1], S[2]));
+        S[7] = S[6];
+        S[6] = S[5];
+        S[5] = S[4];
+        S[4] = ADD(S[3], t0);
+        S[3] = S[2];
+        S[2] = S[1];
+        S[1] = S[0];
+        S[0] = ADD(t0, t1);
+    }
+    for (i = 0; i < 8; i++) {
+        state[i] = _mm256_blendv_epi8(state[i], ADD(state[i], S[i]), active);
+    }
+}
+
+/* Hashes count <= 4 independent messages, one per 64-bit lane, the same
+ * way as sha256_hash_avx2() */
+void
+sha512_hash_avx2(unsigned char *out, const unsigned char *const *in,
+                 const unsigned long long *inlen, size_t count)
+{
+    CRYPTO_ALIGN(32) uint64_t digests[8][4];
+    unsigned char             tail[4][256];
+    __m256i                   W[80];
+    __m256i                   state[8];
+    const unsigned char      *p[4];
+    unsigned long long        full[4];
+    unsigned long long        blocks[4];
+    unsigned long long        max_blocks = 0U;
+    unsigned long long        b;
+    size_t                    i;
+    size_t                    r;
+    size_t                    end;
+
+    memset(tail, 0, sizeof tail);
+    for (i = 0; i < 4; i++) {
+        full[i] = blocks[i] = 0U;
+        if (i >= count) {
+            continue;
+        }
+        full[i] = inlen[i] / 128U;
+        r       = (size_t) (inlen[i] & 127U);
+        if (r > 0U) {
+            memcpy(tail[i], in[i] + full[i] * 128U, r);
+        }
+        tail[i][r] = 0x80;
+        blocks[i]  = full[i] + (r < 112U ? 1U : 2U);
+        end        = (size_t) (blocks[i] - full[i]) * 128U;
+        STORE64_BE(&tail[i][end - 16U], (uint64_t) (inlen[i] >> 61));
+        STORE64_BE(&tail[i][end - 8U], (uint64_t) inlen[i] << 3);
+        if (blocks[i] > max_blocks) {
+            max_blocks = blocks[i];
+        }
+    }
+    for (i = 0; i < 8; i++) {
+        state[i] = _mm256_set1_epi64x((long long) sha512_initial_state[i]);
+    }
+    for (b = 0U; b < max_blocks; b++) {
+        for (i = 0; i < 4; i++) {
+            if (b < full[i]) {
+                p[i] = in[i] + b * 128U;
+            } else if (b < blocks[i]) {
+                p[i] = tail[i] + (b - full[i]) * 128U;
+            } else {
+                p[i] = zero_block;
+            }
+        }
+        sha512_blocks4(state, p,
+                       _mm256_set_epi64x(-(long long) (b < blocks[3]),
+                                         -(long long) (b < blocks[2]),
+                                         -(long long) (b < blocks[1]),
+                                         -(long long) (b < blocks[0])),
+                       W);
+    }
+    for (i = 0; i < 8; i++) {
+        _mm256_store_si256((__m256i *) (void *) digests[i], state[i]);
+    }
+    for (i = 0; i < count; i++) {
+        for (r = 0; r < 8; r++) {
+            STORE64_BE(out + i * 64U + r * 8U, digests[r][i]);
+        }
+    }
+    sodium_memzero(W, sizeof W);
+    sodium_memzero(tail, sizeof tail);
+    sodium_memzero(digests, sizeof digests);
+}
+
+#endif
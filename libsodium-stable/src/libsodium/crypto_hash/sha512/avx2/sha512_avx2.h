@@ -0,0 +1,11 @@
+#ifndef sha512_avx2_H
+#define sha512_avx2_H
+
+#include <stddef.h>
+
+#define SHA512_AVX2_LANES 4U
+
+void sha512_hash_avx2(unsigned char *out, const unsigned char *const *in,
+                      const unsigned long long *inlen, size_t count);
+
+#endif
@@ -35,8 +35,17 @@
 
 #include "crypto_hash_sha512.h"
 #include "private/common.h"
+#include "private/implementations.h"
+#include "runtime.h"
 #include "utils.h"
 
+#include "../avx2/sha512_avx2.h"
+
+#if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+# define HAVE_SHA512_AVX2 1
+#endif
+
 static void
 be64enc_vect(unsigned char *dst, const uint64_t *src, size_t len)
 {
@@ -160,6 +169,19 @@ SHA512_Transform(uint64_t *state, const uint8_t block[128], uint64_t W[80],
     }
 }
 
+/* Hashes up to SHA512_lanes independent messages at once, NULL if that
+ * wouldn't be faster than hashing them one after the other */
+typedef void (*sha512_hash_lanes_fn)(unsigned char *out,
+                                    const unsigned char *const *in,
+                                    const unsigned long long *inlen,
+                                    size_t count);
+
+static sha512_hash_lanes_fn SHA512_hash_lanes = NULL;
+static size_t               SHA512_lanes      = 1U;
+
+/* Fewer messages are hashed one by one */
+#define SHA512_BATCH_MIN 2U
+
 static const uint8_t PAD[128] = {
     0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
     0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
@@ -280,3 +302,61 @@ crypto_hash_sha512(unsigned char *out, const unsigned char *in,
 
     return 0;
 }
+
+int
+crypto_hash_sha512_batch(unsigned char *out, const unsigned char *const *in,
+                         const unsigned long long *inlen, size_t count)
+{
+    size_t n;
+
+    while (count > 0U) {
+        if (SHA512_hash_lanes != NULL && count >= SHA512_BATCH_MIN) {
+            n = count < SHA512_lanes ? count : SHA512_lanes;
+            SHA512_hash_lanes(out, in, inlen, n);
+        } else {
+            n = 1U;
+            crypto_hash_sha512(out, in[0], inlen[0]);
+        }
+        out += n * crypto_hash_sha512_BYTES;
+        in += n;
+        inlen += n;
+        count -= n;
+    }
+    return 0;
+}
+
+int
+_crypto_hash_sha512_pick_best_implementation(void)
+{
+/* LCOV_EXCL_START */
+    if (_crypto_hash_sha512_set_implementation(CRYPTO_HASH_IMPL_AVX2) != 0) {
+        _crypto_hash_sha512_set_implementation(CRYPTO_HASH_IMPL_REF);
+    }
+    return 0;
+/* LCOV_EXCL_STOP */
+}
+
+int
+_crypto_hash_sha512_set_implementation(int impl)
+{
+    switch (impl) {
+    case CRYPTO_HASH_IMPL_BEST:
+        return _crypto_hash_sha512_pick_best_implementation();
+    case CRYPTO_HASH_IMPL_REF:
+        SHA512_hash_lanes = NULL;
+        SHA512_lanes      = 1U;
+        return 0;
+#ifdef HAVE_SHA512_AVX2
+    case CRYPTO_HASH_IMPL_AVX2:
+        if (!sodium_runtime_has_avx2()) {
+            break;
+        }
+        SHA512_hash_lanes = sha512_hash_avx2;
+        SHA512_lanes      = SHA512_AVX2_LANES;
+        return 0;
+#endif
+    default:
+        break;
+    }
+    return -1;
+}
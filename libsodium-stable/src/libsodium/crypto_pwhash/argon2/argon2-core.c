@@ -21,6 +21,13 @@
 #ifdef HAVE_SYS_MMAN_H
 # include <sys/mman.h>
 #endif
+#if defined(HAVE_PTHREAD) && !defined(__EMSCRIPTEN__)
+# include <pthread.h>
+# ifndef _WIN32
+#  include <unistd.h>
+# endif
+# define ARGON2_HAVE_FILL_THREADS 1
+#endif
 
 #include "crypto_generichash_blake2b.h"
 #include "private/common.h"
@@ -244,6 +251,198 @@ argon2_fill_memory_blocks(argon2_instance_t *instance, uint32_t pass)
     }
 }
 
+#ifdef ARGON2_HAVE_FILL_THREADS
+
+/* Upper bound on the number of threads filling one instance. The parallelism
+ * of a verified hash comes from the (possibly untrusted) encoded string, so it
+ * must not decide alone how many threads get created: lanes beyond the bound
+ * are spread over the threads, and every lane is still filled. */
+# define ARGON2_MAX_FILL_THREADS 16U
+
+typedef struct Argon2_fill_pool {
+    pthread_mutex_t mutex;
+    pthread_cond_t  cond;
+    uint32_t        threads;    /* including the calling thread */
+    uint32_t        waiting;    /* threads waiting at the barrier */
+    uint32_t        generation; /* barriers crossed so far */
+    int             started;
+} argon2_fill_pool;
+
+typedef struct Argon2_fill_worker {
+    argon2_fill_pool *pool;
+    argon2_instance_t instance; /* copy with its own pseudo_rands */
+    uint32_t          index;
+    pthread_t         thread;
+} argon2_fill_worker;
+
+/* Waits until every thread of the pool has reached the barrier. Crossing it
+ * also publishes the blocks written before to all threads. */
+static void
+fill_pool_barrier(argon2_fill_pool *pool)
+{
+    uint32_t generation;
+
+    pthread_mutex_lock(&pool->mutex);
+    generation = pool->generation;
+    if (++pool->waiting == pool->threads) {
+        pool->waiting = 0U;
+        pool->generation++;
+        pthread_cond_broadcast(&pool->cond);
+    } else {
+        while (generation == pool->generation) {
+            pthread_cond_wait(&pool->cond, &pool->mutex);
+        }
+    }
+    pthread_mutex_unlock(&pool->mutex);
+}
+
+/* Thread i fills lanes i, i + threads, ... of every slice of every pass.
+ * Segments of the same slice only reference blocks of earlier slices, so
+ * they can be computed concurrently between two barriers. */
+static void *
+fill_pool_worker(void *arg)
+{
+    argon2_fill_worker *worker = (argon2_fill_worker *) arg;
+    argon2_fill_pool   *pool = worker->pool;
+    argon2_position_t   position;
+    uint32_t            threads;
+    uint32_t            l;
+    uint32_t            s;
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->started == 0) {
+        pthread_cond_wait(&pool->cond, &pool->mutex);
+    }
+    threads = pool->threads;
+    pthread_mutex_unlock(&pool->mutex);
+
+    for (position.pass = 0; position.pass < worker->instance.passes;
+         position.pass++) {
+        for (s = 0; s < ARGON2_SYNC_POINTS; ++s) {
+            position.slice = (uint8_t) s;
+            for (l = worker->index; l < worker->instance.lanes; l += threads) {
+                position.lane  = l;
+                position.index = 0;
+                fill_segment(&worker->instance, position);
+            }
+            fill_pool_barrier(pool);
+        }
+    }
+    return NULL;
+}
+
+/* Runs every pass on up to instance->threads threads, and no more than
+ * ARGON2_MAX_FILL_THREADS or the number of online CPUs. Returns -1 without
+ * having touched the memory if not even a second thread could be started. */
+static int
+fill_memory_blocks_threaded(argon2_instance_t *instance)
+{
+    argon2_fill_pool    pool;
+    argon2_fill_worker *workers;
+    uint32_t            threads;
+    uint32_t            started;
+    uint32_t            i;
+
+    threads = instance->threads;
+    if (threads > instance->lanes) {
+        threads = instance->lanes;
+    }
+    if (threads > ARGON2_MAX_FILL_THREADS) {
+        threads = ARGON2_MAX_FILL_THREADS;
+    }
+#ifdef _SC_NPROCESSORS_ONLN
+    {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        if (cpus > 0 && (unsigned long) cpus < (unsigned long) threads) {
+            threads = (uint32_t) cpus;
+        }
+    }
+#endif
+    if (threads < 2U) {
+        return -1;
+    }
+    if ((workers = (argon2_fill_worker *)
+         calloc(threads, sizeof *workers)) == NULL) {
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    if (pthread_mutex_init(&pool.mutex, NULL) != 0) {
+        free(workers); /* LCOV_EXCL_LINE */
+        return -1; /* LCOV_EXCL_LINE */
+    }
+    if (pthread_cond_init(&pool.cond, NULL) != 0) {
+        /* LCOV_EXCL_START */
+        pthread_mutex_destroy(&pool.mutex);
+        free(workers);
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+    pool.threads    = threads;
+    pool.waiting    = 0U;
+    pool.generation = 0U;
+    pool.started    = 0;
+
+    workers[0].pool     = &pool;
+    workers[0].instance = *instance;
+    workers[0].index    = 0U;
+    for (started = 1U; started < threads; started++) {
+        argon2_fill_worker *worker = &workers[started];
+
+        worker->pool     = &pool;
+        worker->instance = *instance;
+        worker->index    = started;
+        if ((worker->instance.pseudo_rands = (uint64_t *)
+             malloc(sizeof(uint64_t) * instance->segment_length)) == NULL) {
+            break; /* LCOV_EXCL_LINE */
+        }
+        if (pthread_create(&worker->thread, NULL, fill_pool_worker,
+                           worker) != 0) {
+            free(worker->instance.pseudo_rands); /* LCOV_EXCL_LINE */
+            break; /* LCOV_EXCL_LINE */
+        }
+    }
+
+    /* The lanes are spread over the threads that could actually be started */
+    pthread_mutex_lock(&pool.mutex);
+    pool.threads = started;
+    pool.started = 1;
+    pthread_cond_broadcast(&pool.cond);
+    pthread_mutex_unlock(&pool.mutex);
+
+    if (started > 1U) {
+        fill_pool_worker(&workers[0]);
+    }
+    for (i = 1U; i < started; i++) {
+        pthread_join(workers[i].thread, NULL);
+        sodium_memzero(workers[i].instance.pseudo_rands,
+                       sizeof(uint64_t) * instance->segment_length);
+        free(workers[i].instance.pseudo_rands);
+    }
+    pthread_cond_destroy(&pool.cond);
+    pthread_mutex_destroy(&pool.mutex);
+    free(workers);
+
+    return started > 1U ? 0 : -1;
+}
+
+#endif
+
+void
+argon2_fill_memory(argon2_instance_t *instance)
+{
+    uint32_t pass;
+
+#ifdef ARGON2_HAVE_FILL_THREADS
+    if (instance->threads > 1U && instance->lanes > 1U &&
+        fill_memory_blocks_threaded(instance) == 0) {
+        return;
+    }
+#endif
+    for (pass = 0; pass < instance->passes; pass++) {
+        argon2_fill_memory_blocks(instance, pass);
+    }
+}
+
 int
 argon2_validate_inputs(const argon2_context *context)
 {
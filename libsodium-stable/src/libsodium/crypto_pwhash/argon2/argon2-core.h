@@ -268,4 +268,13 @@ void argon2_fill_segment_ref(const argon2_instance_t *instance,
  */
 void argon2_fill_memory_blocks(argon2_instance_t *instance, uint32_t pass);
 
+/*
+ * Function that runs all the passes, filling the lanes of each slice
+ * concurrently on up to instance->threads threads when threads are available,
+ * and sequentially otherwise. Both produce the same memory. The number of
+ * threads is capped at 16 and at the number of online CPUs.
+ * @param instance Pointer to the current instance
+ */
+void argon2_fill_memory(argon2_instance_t *instance);
+
 #endif
@@ -29,7 +29,6 @@ argon2_ctx(argon2_context *context, argon2_type type)
     /* 1. Validate all inputs */
     int               result = argon2_validate_inputs(context);
     uint32_t          memory_blocks, segment_length;
-    uint32_t          pass;
     argon2_instance_t instance;
 
     if (ARGON2_OK != result) {
@@ -72,9 +71,7 @@ argon2_ctx(argon2_context *context, argon2_type type)
     }
 
     /* 4. Filling memory */
-    for (pass = 0; pass < instance.passes; pass++) {
-        argon2_fill_memory_blocks(&instance, pass);
-    }
+    argon2_fill_memory(&instance);
 
     /* 5. Finalization */
     argon2_finalize(context, &instance);
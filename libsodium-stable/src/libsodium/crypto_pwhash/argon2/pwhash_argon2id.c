@@ -96,6 +96,20 @@ crypto_pwhash_argon2id_memlimit_max(void)
     return crypto_pwhash_argon2id_MEMLIMIT_MAX;
 }
 
+size_t
+crypto_pwhash_argon2id_parallelism_min(void)
+{
+    COMPILER_ASSERT(crypto_pwhash_argon2id_PARALLELISM_MIN >= ARGON2_MIN_LANES);
+    return crypto_pwhash_argon2id_PARALLELISM_MIN;
+}
+
+size_t
+crypto_pwhash_argon2id_parallelism_max(void)
+{
+    COMPILER_ASSERT(crypto_pwhash_argon2id_PARALLELISM_MAX <= ARGON2_MAX_LANES);
+    return crypto_pwhash_argon2id_PARALLELISM_MAX;
+}
+
 size_t
 crypto_pwhash_argon2id_opslimit_interactive(void)
 {
@@ -133,10 +147,13 @@ crypto_pwhash_argon2id_memlimit_sensitive(void)
 }
 
 int
-crypto_pwhash_argon2id(unsigned char *const out, unsigned long long outlen,
-                       const char *const passwd, unsigned long long passwdlen,
-                       const unsigned char *const salt,
-                       unsigned long long opslimit, size_t memlimit, int alg)
+crypto_pwhash_argon2id_parallel(unsigned char *const out,
+                                unsigned long long outlen,
+                                const char *const passwd,
+                                unsigned long long passwdlen,
+                                const unsigned char *const salt,
+                                unsigned long long opslimit, size_t memlimit,
+                                unsigned int parallelism, int alg)
 {
     memset(out, 0, outlen);
     if (outlen > crypto_pwhash_argon2id_BYTES_MAX) {
@@ -159,6 +176,15 @@ crypto_pwhash_argon2id(unsigned char *const out, unsigned long long outlen,
         errno = EINVAL;
         return -1;
     }
+    if (parallelism > crypto_pwhash_argon2id_PARALLELISM_MAX) {
+        errno = EFBIG;
+        return -1;
+    }
+    if (parallelism < crypto_pwhash_argon2id_PARALLELISM_MIN ||
+        memlimit / 1024U < 8U * (size_t) parallelism) {
+        errno = EINVAL;
+        return -1;
+    }
     if ((const void *) out == (const void *) passwd) {
         errno = EINVAL;
         return -1;
@@ -166,7 +192,7 @@ crypto_pwhash_argon2id(unsigned char *const out, unsigned long long outlen,
     switch (alg) {
     case crypto_pwhash_argon2id_ALG_ARGON2ID13:
         if (argon2id_hash_raw((uint32_t) opslimit, (uint32_t) (memlimit / 1024U),
-                              (uint32_t) 1U, passwd, (size_t) passwdlen, salt,
+                              (uint32_t) parallelism, passwd, (size_t) passwdlen, salt,
                               (size_t) crypto_pwhash_argon2id_SALTBYTES, out,
                               (size_t) outlen) != ARGON2_OK) {
             return -1; /* LCOV_EXCL_LINE */
@@ -179,10 +205,21 @@ crypto_pwhash_argon2id(unsigned char *const out, unsigned long long outlen,
 }
 
 int
-crypto_pwhash_argon2id_str(char out[crypto_pwhash_argon2id_STRBYTES],
-                           const char *const passwd,
-                           unsigned long long passwdlen,
-                           unsigned long long opslimit, size_t memlimit)
+crypto_pwhash_argon2id(unsigned char *const out, unsigned long long outlen,
+                       const char *const passwd, unsigned long long passwdlen,
+                       const unsigned char *const salt,
+                       unsigned long long opslimit, size_t memlimit, int alg)
+{
+    return crypto_pwhash_argon2id_parallel(out, outlen, passwd, passwdlen, salt,
+                                           opslimit, memlimit, 1U, alg);
+}
+
+int
+crypto_pwhash_argon2id_str_parallel(char out[crypto_pwhash_argon2id_STRBYTES],
+                                    const char *const passwd,
+                                    unsigned long long passwdlen,
+                                    unsigned long long opslimit, size_t memlimit,
+                                    unsigned int parallelism)
 {
     unsigned char salt[crypto_pwhash_argon2id_SALTBYTES];
 
@@ -199,9 +236,18 @@ crypto_pwhash_argon2id_str(char out[crypto_pwhash_argon2id_STRBYTES],
         errno = EINVAL;
         return -1;
     }
+    if (parallelism > crypto_pwhash_argon2id_PARALLELISM_MAX) {
+        errno = EFBIG;
+        return -1;
+    }
+    if (parallelism < crypto_pwhash_argon2id_PARALLELISM_MIN ||
+        memlimit / 1024U < 8U * (size_t) parallelism) {
+        errno = EINVAL;
+        return -1;
+    }
     randombytes_buf(salt, sizeof salt);
     if (argon2id_hash_encoded((uint32_t) opslimit, (uint32_t) (memlimit / 1024U),
-                              (uint32_t) 1U, passwd, (size_t) passwdlen, salt,
+                              (uint32_t) parallelism, passwd, (size_t) passwdlen, salt,
                               sizeof salt, STR_HASHBYTES, out,
                               crypto_pwhash_argon2id_STRBYTES) != ARGON2_OK) {
         return -1; /* LCOV_EXCL_LINE */
@@ -209,6 +255,16 @@ crypto_pwhash_argon2id_str(char out[crypto_pwhash_argon2id_STRBYTES],
     return 0;
 }
 
+int
+crypto_pwhash_argon2id_str(char out[crypto_pwhash_argon2id_STRBYTES],
+                           const char *const passwd,
+                           unsigned long long passwdlen,
+                           unsigned long long opslimit, size_t memlimit)
+{
+    return crypto_pwhash_argon2id_str_parallel(out, passwd, passwdlen,
+                                               opslimit, memlimit, 1U);
+}
+
 int
 crypto_pwhash_argon2id_str_verify(const char str[crypto_pwhash_argon2id_STRBYTES],
                                   const char *const  passwd,
@@ -0,0 +1,557 @@
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "private/common.h"
+#include "utils.h"
+
+#if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+
+# ifdef __GNUC__
+#  pragma GCC target("sse2")
+#  pragma GCC target("ssse3")
+#  pragma GCC target("sse4.1")
+#  pragma GCC target("avx2")
+# endif
+
+# include <emmintrin.h>
+# include <immintrin.h>
+# include <smmintrin.h>
+# include <tmmintrin.h>
+
+# include "x25519_avx2.h"
+
+/*
+ * Four Montgomery ladders, one per 64-bit lane.
+ *
+ * Field elements have 10 unsigned limbs of alternately 26 and 25 bits, and
+ * limb i of all four elements is kept in the same vector, so that a field
+ * multiplication is 100 independent 32x32->64 bit vpmuludq products.
+ *
+ * Carried limbs are below 2^26 (even) and 2^25 + 2^17 (odd). fe4_add() and
+ * fe4_sub() don't carry, and their results stay below 3*2^26, so that
+ * 19 times a limb still fits in 32 bits for the next multiplication.
+ */
+
+typedef __m256i fe4[10];
+
+static const unsigned int limb_offsets[10] = {
+    0, 26, 51, 77, 102, 128, 153, 179, 204, 230
+};
+
+# define ADD(x, y) _mm256_add_epi64((x), (y))
+# define MUL(x, y) _mm256_mul_epu32((x), (y))
+
+static void
+fe4_0(fe4 h)
+{
+    unsigned int i;
+
+    for (i = 0; i < 10; i++) {
+        h[i] = _mm256_setzero_si256();
+    }
+}
+
+static void
+fe4_1(fe4 h)
+{
+    fe4_0(h);
+    h[0] = _mm256_set1_epi64x(1);
+}
+
+static void
+fe4_copy(fe4 h, const fe4 f)
+{
+    memcpy(h, f, sizeof(fe4));
+}
+
+static void
+fe4_add(fe4 h, const fe4 f, const fe4 g)
+{
+    unsigned int i;
+
+    for (i = 0; i < 10; i++) {
+        h[i] = ADD(f[i], g[i]);
+    }
+}
+
+/* h = f + 2p - g */
+static void
+fe4_sub(fe4 h, const fe4 f, const fe4 g)
+{
+    const __m256i two_p0   = _mm256_set1_epi64x(0x7ffffda);
+    const __m256i two_p_25 = _mm256_set1_epi64x(0x3fffffe);
+    const __m256i two_p_26 = _mm256_set1_epi64x(0x7fffffe);
+    unsigned int  i;
+
+    h[0] = _mm256_sub_epi64(ADD(f[0], two_p0), g[0]);
+    h[1] = _mm256_sub_epi64(ADD(f[1], two_p_25), g[1]);
+    for (i = 2; i < 10; i += 2) {
+        h[i]     = _mm256_sub_epi64(ADD(f[i], two_p_26), g[i]);
+        h[i + 1] = _mm256_sub_epi64(ADD(f[i + 1], two_p_25), g[i + 1]);
+    }
+}
+
+static void
+fe4_cswap(fe4 f, fe4 g, __m256i mask)
+{
+    __m256i      x;
+    unsigned int i;
+
+    for (i = 0; i < 10; i++) {
+        x    = _mm256_and_si256(_mm256_xor_si256(f[i], g[i]), mask);
+        f[i] = _mm256_xor_si256(f[i], x);
+        g[i] = _mm256_xor_si256(g[i], x);
+    }
+}
+
+# define CARRY(i, j, bits)                              \
+    do {                                                \
+        c    = _mm256_srli_epi64(h[i], (bits));         \
+        h[j] = ADD(h[j], c);                            \
+        h[i] = _mm256_and_si256(h[i], mask##bits);      \
+    } while (0)
+
+static void
+fe4_carry(fe4 h)
+{
+    const __m256i mask25 = _mm256_set1_epi64x((1 << 25) - 1);
+    const __m256i mask26 = _mm256_set1_epi64x((1 << 26) - 1);
+    __m256i       c;
+
+    CARRY(0, 1, 26);
+    CARRY(4, 5, 26);
+    CARRY(1, 2, 25);
+    CARRY(5, 6, 25);
+    CARRY(2, 3, 26);
+    CARRY(6, 7, 26);
+    CARRY(3, 4, 25);
+    CARRY(7, 8, 25);
+    CARRY(4, 5, 26);
+    CARRY(8, 9, 26);
+    c    = _mm256_srli_epi64(h[9], 25);
+    h[9] = _mm256_and_si256(h[9], mask25);
+    h[0] = ADD(h[0], ADD(ADD(c, _mm256_slli_epi64(c, 1)),
+                         _mm256_slli_epi64(c, 4)));
+    CARRY(0, 1, 26);
+}
+
+static void
+fe4_mul(fe4 h, const fe4 f, const fe4 g)
+{
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    const __m256i f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    const __m256i f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+    const __m256i g0 = g[0], g1 = g[1], g2 = g[2], g3 = g[3], g4 = g[4];
+    const __m256i g5 = g[5], g6 = g[6], g7 = g[7], g8 = g[8], g9 = g[9];
+    const __m256i f1_2  = ADD(f1, f1);
+    const __m256i f3_2  = ADD(f3, f3);
+    const __m256i f5_2  = ADD(f5, f5);
+    const __m256i f7_2  = ADD(f7, f7);
+    const __m256i f9_2  = ADD(f9, f9);
+    const __m256i g1_19 = MUL(g1, nineteen);
+    const __m256i g2_19 = MUL(g2, nineteen);
+    const __m256i g3_19 = MUL(g3, nineteen);
+    const __m256i g4_19 = MUL(g4, nineteen);
+    const __m256i g5_19 = MUL(g5, nineteen);
+    const __m256i g6_19 = MUL(g6, nineteen);
+    const __m256i g7_19 = MUL(g7, nineteen);
+    const __m256i g8_19 = MUL(g8, nineteen);
+    const __m256i g9_19 = MUL(g9, nineteen);
+
+    h[0] = MUL(f0, g0);
+    h[0] = ADD(h[0], MUL(f1_2, g9_19));
+    h[0] = ADD(h[0], MUL(f2, g8_19));
+    h[0] = ADD(h[0], MUL(f3_2, g7_19));
+    h[0] = ADD(h[0], MUL(f4, g6_19));
+    h[0] = ADD(h[0], MUL(f5_2, g5_19));
+    h[0] = ADD(h[0], MUL(f6, g4_19));
+    h[0] = ADD(h[0], MUL(f7_2, g3_19));
+    h[0] = ADD(h[0], MUL(f8, g2_19));
+    h[0] = ADD(h[0], MUL(f9_2, g1_19));
+    h[1] = MUL(f0, g1);
+    h[1] = ADD(h[1], MUL(f1, g0));
+    h[1] = ADD(h[1], MUL(f2, g9_19));
+    h[1] = ADD(h[1], MUL(f3, g8_19));
+    h[1] = ADD(h[1], MUL(f4, g7_19));
+    h[1] = ADD(h[1], MUL(f5, g6_19));
+    h[1] = ADD(h[1], MUL(f6, g5_19));
+    h[1] = ADD(h[1], MUL(f7, g4_19));
+    h[1] = ADD(h[1], MUL(f8, g3_19));
+    h[1] = ADD(h[1], MUL(f9, g2_19));
+    h[2] = MUL(f0, g2);
+    h[2] = ADD(h[2], MUL(f1_2, g1));
+    h[2] = ADD(h[2], MUL(f2, g0));
+    h[2] = ADD(h[2], MUL(f3_2, g9_19));
+    h[2] = ADD(h[2], MUL(f4, g8_19));
+    h[2] = ADD(h[2], MUL(f5_2, g7_19));
+    h[2] = ADD(h[2], MUL(f6, g6_19));
+    h[2] = ADD(h[2], MUL(f7_2, g5_19));
+    h[2] = ADD(h[2], MUL(f8, g4_19));
+    h[2] = ADD(h[2], MUL(f9_2, g3_19));
+    h[3] = MUL(f0, g3);
+    h[3] = ADD(h[3], MUL(f1, g2));
+    h[3] = ADD(h[3], MUL(f2, g1));
+    h[3] = ADD(h[3], MUL(f3, g0));
+    h[3] = ADD(h[3], MUL(f4, g9_19));
+    h[3] = ADD(h[3], MUL(f5, g8_19));
+    h[3] = ADD(h[3], MUL(f6, g7_19));
+    h[3] = ADD(h[3], MUL(f7, g6_19));
+    h[3] = ADD(h[3], MUL(f8, g5_19));
+    h[3] = ADD(h[3], MUL(f9, g4_19));
+    h[4] = MUL(f0, g4);
+    h[4] = ADD(h[4], MUL(f1_2, g3));
+    h[4] = ADD(h[4], MUL(f2, g2));
+    h[4] = ADD(h[4], MUL(f3_2, g1));
+    h[4] = ADD(h[4], MUL(f4, g0));
+    h[4] = ADD(h[4], MUL(f5_2, g9_19));
+    h[4] = ADD(h[4], MUL(f6, g8_19));
+    h[4] = ADD(h[4], MUL(f7_2, g7_19));
+    h[4] = ADD(h[4], MUL(f8, g6_19));
+    h[4] = ADD(h[4], MUL(f9_2, g5_19));
+    h[5] = MUL(f0, g5);
+    h[5] = ADD(h[5], MUL(f1, g4));
+    h[5] = ADD(h[5], MUL(f2, g3));
+    h[5] = ADD(h[5], MUL(f3, g2));
+    h[5] = ADD(h[5], MUL(f4, g1));
+    h[5] = ADD(h[5], MUL(f5, g0));
+    h[5] = ADD(h[5], MUL(f6, g9_19));
+    h[5] = ADD(h[5], MUL(f7, g8_19));
+    h[5] = ADD(h[5], MUL(f8, g7_19));
+    h[5] = ADD(h[5], MUL(f9, g6_19));
+    h[6] = MUL(f0, g6);
+    h[6] = ADD(h[6], MUL(f1_2, g5));
+    h[6] = ADD(h[6], MUL(f2, g4));
+    h[6] = ADD(h[6], MUL(f3_2, g3));
+    h[6] = ADD(h[6], MUL(f4, g2));
+    h[6] = ADD(h[6], MUL(f5_2, g1));
+    h[6] = ADD(h[6], MUL(f6, g0));
+    h[6] = ADD(h[6], MUL(f7_2, g9_19));
+    h[6] = ADD(h[6], MUL(f8, g8_19));
+    h[6] = ADD(h[6], MUL(f9_2, g7_19));
+    h[7] = MUL(f0, g7);
+    h[7] = ADD(h[7], MUL(f1, g6));
+    h[7] = ADD(h[7], MUL(f2, g5));
+    h[7] = ADD(h[7], MUL(f3, g4));
+    h[7] = ADD(h[7], MUL(f4, g3));
+    h[7] = ADD(h[7], MUL(f5, g2));
+    h[7] = ADD(h[7], MUL(f6, g1));
+    h[7] = ADD(h[7], MUL(f7, g0));
+    h[7] = ADD(h[7], MUL(f8, g9_19));
+    h[7] = ADD(h[7], MUL(f9, g8_19));
+    h[8] = MUL(f0, g8);
+    h[8] = ADD(h[8], MUL(f1_2, g7));
+    h[8] = ADD(h[8], MUL(f2, g6));
+    h[8] = ADD(h[8], MUL(f3_2, g5));
+    h[8] = ADD(h[8], MUL(f4, g4));
+    h[8] = ADD(h[8], MUL(f5_2, g3));
+    h[8] = ADD(h[8], MUL(f6, g2));
+    h[8] = ADD(h[8], MUL(f7_2, g1));
+    h[8] = ADD(h[8], MUL(f8, g0));
+    h[8] = ADD(h[8], MUL(f9_2, g9_19));
+    h[9] = MUL(f0, g9);
+    h[9] = ADD(h[9], MUL(f1, g8));
+    h[9] = ADD(h[9], MUL(f2, g7));
+    h[9] = ADD(h[9], MUL(f3, g6));
+    h[9] = ADD(h[9], MUL(f4, g5));
+    h[9] = ADD(h[9], MUL(f5, g4));
+    h[9] = ADD(h[9], MUL(f6, g3));
+    h[9] = ADD(h[9], MUL(f7, g2));
+    h[9] = ADD(h[9], MUL(f8, g1));
+    h[9] = ADD(h[9], MUL(f9, g0));
+
+    fe4_carry(h);
+}
+
+static void
+fe4_sq(fe4 h, const fe4 f)
+{
+    const __m256i nineteen = _mm256_set1_epi64x(19);
+    const __m256i f0 = f[0], f1 = f[1], f2 = f[2], f3 = f[3], f4 = f[4];
+    const __m256i f5 = f[5], f6 = f[6], f7 = f[7], f8 = f[8], f9 = f[9];
+    const __m256i f0_2  = ADD(f0, f0);
+    const __m256i f1_2  = ADD(f1, f1);
+    const __m256i f2_2  = ADD(f2, f2);
+    const __m256i f3_2  = ADD(f3, f3);
+    const __m256i f4_2  = ADD(f4, f4);
+    const __m256i f5_2  = ADD(f5, f5);
+    const __m256i f6_2  = ADD(f6, f6);
+    const __m256i f7_2  = ADD(f7, f7);
+    const __m256i f8_2  = ADD(f8, f8);
+    const __m256i f9_2  = ADD(f9, f9);
+    const __m256i f1_4  = ADD(f1_2, f1_2);
+    const __m256i f3_4  = ADD(f3_2, f3_2);
+    const __m256i f5_4  = ADD(f5_2, f5_2);
+    const __m256i f7_4  = ADD(f7_2, f7_2);
+    const __m256i f5_19 = MUL(f5, nineteen);
+    const __m256i f6_19 = MUL(f6, nineteen);
+    const __m256i f7_19 = MUL(f7, nineteen);
+    const __m256i f8_19 = MUL(f8, nineteen);
+    const __m256i f9_19 = MUL(f9, nineteen);
+
+    h[0] = MUL(f0, f0);
+    h[0] = ADD(h[0], MUL(f1_4, f9_19));
+    h[0] = ADD(h[0], MUL(f2_2, f8_19));
+    h[0] = ADD(h[0], MUL(f3_4, f7_19));
+    h[0] = ADD(h[0], MUL(f4_2, f6_19));
+    h[0] = ADD(h[0], MUL(f5_2, f5_19));
+    h[1] = MUL(f0_2, f1);
+    h[1] = ADD(h[1], MUL(f2_2, f9_19));
+    h[1] = ADD(h[1], MUL(f3_2, f8_19));
+    h[1] = ADD(h[1], MUL(f4_2, f7_19));
+    h[1] = ADD(h[1], MUL(f5_2, f6_19));
+    h[2] = MUL(f0_2, f2);
+    h[2] = ADD(h[2], MUL(f1_2, f1));
+    h[2] = ADD(h[2], MUL(f3_4, f9_19));
+    h[2] = ADD(h[2], MUL(f4_2, f8_19));
+    h[2] = ADD(h[2], MUL(f5_4, f7_19));
+    h[2] = ADD(h[2], MUL(f6, f6_19));
+    h[3] = MUL(f0_2, f3);
+    h[3] = ADD(h[3], MUL(f1_2, f2));
+    h[3] = ADD(h[3], MUL(f4_2, f9_19));
+    h[3] = ADD(h[3], MUL(f5_2, f8_19));
+    h[3] = ADD(h[3], MUL(f6_2, f7_19));
+    h[4] = MUL(f0_2, f4);
+    h[4] = ADD(h[4], MUL(f1_4, f3));
+    h[4] = ADD(h[4], MUL(f2, f2));
+    h[4] = ADD(h[4], MUL(f5_4, f9_19));
+    h[4] = ADD(h[4], MUL(f6_2, f8_19));
+    h[4] = ADD(h[4], MUL(f7_2, f7_19));
+    h[5] = MUL(f0_2, f5);
+    h[5] = ADD(h[5], MUL(f1_2, f4));
+    h[5] = ADD(h[5], MUL(f2_2, f3));
+    h[5] = ADD(h[5], MUL(f6_2, f9_19));
+    h[5] = ADD(h[5], MUL(f7_2, f8_19));
+    h[6] = MUL(f0_2, f6);
+    h[6] = ADD(h[6], MUL(f1_4, f5));
+    h[6] = ADD(h[6], MUL(f2_2, f4));
+    h[6] = ADD(h[6], MUL(f3_2, f3));
+    h[6] = ADD(h[6], MUL(f7_4, f9_19));
+    h[6] = ADD(h[6], MUL(f8, f8_19));
+    h[7] = MUL(f0_2, f7);
+    h[7] = ADD(h[7], MUL(f1_2, f6));
+    h[7] = ADD(h[7], MUL(f2_2, f5));
+    h[7] = ADD(h[7], MUL(f3_2, f4));
+    h[7] = ADD(h[7], MUL(f8_2, f9_19));
+    h[8] = MUL(f0_2, f8);
+    h[8] = ADD(h[8], MUL(f1_4, f7));
+    h[8] = ADD(h[8], MUL(f2_2, f6));
+    h[8] = ADD(h[8], MUL(f3_4, f5));
+    h[8] = ADD(h[8], MUL(f4, f4));
+    h[8] = ADD(h[8], MUL(f9_2, f9_19));
+    h[9] = MUL(f0_2, f9);
+    h[9] = ADD(h[9], MUL(f1_2, f8));
+    h[9] = ADD(h[9], MUL(f2_2, f7));
+    h[9] = ADD(h[9], MUL(f3_2, f6));
+    h[9] = ADD(h[9], MUL(f4_2, f5));
+
+    fe4_carry(h);
+}
+
+static void
+fe4_mul121666(fe4 h, const fe4 f)
+{
+    const __m256i k = _mm256_set1_epi64x(121666);
+    unsigned int  i;
+
+    for (i = 0; i < 10; i++) {
+        h[i] = MUL(f[i], k);
+    }
+    fe4_carry(h);
+}
+
+static void
+fe4_sqn(fe4 h, const fe4 f, unsigned int n)
+{
+    fe4_sq(h, f);
+    while (--n > 0U) {
+        fe4_sq(h, h);
+    }
+}
+
+/* h = z^(p-2), with the same chain as fe25519_invert() */
+static void
+fe4_invert(fe4 h, const fe4 z)
+{
+    fe4 t0, t1, t2, t3;
+
+    fe4_sq(t0, z);
+    fe4_sqn(t1, t0, 2);
+    fe4_mul(t1, z, t1);
+    fe4_mul(t0, t0, t1);
+    fe4_sq(t2, t0);
+    fe4_mul(t1, t1, t2);
+    fe4_sqn(t2, t1, 5);
+    fe4_mul(t1, t2, t1);
+    fe4_sqn(t2, t1, 10);
+    fe4_mul(t2, t2, t1);
+    fe4_sqn(t3, t2, 20);
+    fe4_mul(t2, t3, t2);
+    fe4_sqn(t2, t2, 10);
+    fe4_mul(t1, t2, t1);
+    fe4_sqn(t2, t1, 50);
+    fe4_mul(t2, t2, t1);
+    fe4_sqn(t3, t2, 100);
+    fe4_mul(t2, t3, t2);
+    fe4_sqn(t2, t2, 50);
+    fe4_mul(t1, t2, t1);
+    fe4_sqn(t1, t1, 5);
+    fe4_mul(h, t1, t0);
+}
+
+/* The top bit is ignored, and non-canonical encodings are accepted */
+static void
+fe4_frombytes(fe4 h, const unsigned char s[4][32])
+{
+    unsigned char t[4][40];
+    uint32_t      l[4];
+    unsigned int  i;
+    unsigned int  j;
+
+    memset(t, 0, sizeof t);
+    for (j = 0; j < 4; j++) {
+        memcpy(t[j], s[j], 32);
+        t[j][31] &= 127;
+    }
+    for (i = 0; i < 10; i++) {
+        for (j = 0; j < 4; j++) {
+            l[j] = (uint32_t) (LOAD64_LE(&t[j][limb_offsets[i] / 8]) >>
+                               (limb_offsets[i] & 7)) &
+                   ((i & 1) ? 0x1ffffff : 0x3ffffff);
+        }
+        h[i] = _mm256_set_epi32(0, (int) l[3], 0, (int) l[2],
+                                0, (int) l[1], 0, (int) l[0]);
+    }
+}
+
+/* Canonical encoding of carried limbs */
+static void
+limbs_tobytes(unsigned char s[32], const uint64_t h[10])
+{
+    uint64_t     t[10];
+    uint64_t     q;
+    uint64_t     v;
+    unsigned int i;
+    unsigned int k;
+
+    memcpy(t, h, sizeof t);
+    for (i = 0; i < 9; i++) {
+        t[i + 1] += t[i] >> ((i & 1) ? 25 : 26);
+        t[i] &= (i & 1) ? 0x1ffffff : 0x3ffffff;
+    }
+    t[0] += 19 * (t[9] >> 25);
+    t[9] &= 0x1ffffff;
+
+    /* q = 1 if h >= p, that is if h + 19 >= 2^255 */
+    q = (t[0] + 19) >> 26;
+    for (i = 1; i < 10; i++) {
+        q = (t[i] + q) >> ((i & 1) ? 25 : 26);
+    }
+    t[0] += 19 * q;
+    for (i = 0; i < 9; i++) {
+        t[i + 1] += t[i] >> ((i & 1) ? 25 : 26);
+        t[i] &= (i & 1) ? 0x1ffffff : 0x3ffffff;
+    }
+    t[9] &= 0x1ffffff;
+
+    memset(s, 0, 32);
+    for (i = 0; i < 10; i++) {
+        v = t[i] << (limb_offsets[i] & 7);
+        for (k = limb_offsets[i] / 8; k < limb_offsets[i] / 8 + 5U && k < 32U;
+             k++) {
+            s[k] |= (unsigned char) v;
+            v >>= 8;
+        }
+    }
+    sodium_memzero(t, sizeof t);
+}
+
+void
+x25519_avx2(unsigned char *q, const unsigned char *n, const unsigned char *p,
+            size_t count)
+{
+    CRYPTO_ALIGN(32) uint64_t limbs[10][4];
+    unsigned char             e[4][32];
+    unsigned char             u[4][32];
+    uint64_t                  h[10];
+    fe4                       x1, x2, z2, x3, z3, tmp0, tmp1;
+    __m256i                   mask;
+    unsigned int              swap[4] = { 0 };
+    unsigned int              b[4];
+    unsigned int              i;
+    unsigned int              j;
+    int                       pos;
+
+    /* unused lanes compute the same thing as the first one */
+    for (j = 0; j < 4; j++) {
+        i = j < count ? j : 0;
+        memcpy(e[j], n + i * 32U, 32);
+        memcpy(u[j], p + i * 32U, 32);
+        e[j][0] &= 248;
+        e[j][31] &= 127;
+        e[j][31] |= 64;
+    }
+    fe4_frombytes(x1, u);
+    fe4_1(x2);
+    fe4_0(z2);
+    fe4_copy(x3, x1);
+    fe4_1(z3);
+
+    for (pos = 254; pos >= 0; --pos) {
+        for (j = 0; j < 4; j++) {
+            b[j] = (e[j][pos / 8] >> (pos & 7)) & 1;
+            swap[j] ^= b[j];
+        }
+        mask = _mm256_set_epi32(-(int) swap[3], -(int) swap[3],
+                                -(int) swap[2], -(int) swap[2],
+                                -(int) swap[1], -(int) swap[1],
+                                -(int) swap[0], -(int) swap[0]);
+        fe4_cswap(x2, x3, mask);
+        fe4_cswap(z2, z3, mask);
+        memcpy(swap, b, sizeof swap);
+
+        fe4_sub(tmp0, x3, z3);
+        fe4_sub(tmp1, x2, z2);
+        fe4_add(x2, x2, z2);
+        fe4_add(z2, x3, z3);
+        fe4_mul(z3, tmp0, x2);
+        fe4_mul(z2, z2, tmp1);
+        fe4_sq(tmp0, tmp1);
+        fe4_sq(tmp1, x2);
+        fe4_add(x3, z3, z2);
+        fe4_sub(z2, z3, z2);
+        fe4_mul(x2, tmp1, tmp0);
+        fe4_sub(tmp1, tmp1, tmp0);
+        fe4_sq(z2, z2);
+        fe4_mul121666(z3, tmp1);
+        fe4_sq(x3, x3);
+        fe4_add(tmp0, tmp0, z3);
+        fe4_mul(z3, x1, z2);
+        fe4_mul(z2, tmp1, tmp0);
+    }
+    mask = _mm256_set_epi32(-(int) swap[3], -(int) swap[3],
+                            -(int) swap[2], -(int) swap[2],
+                            -(int) swap[1], -(int) swap[1],
+                            -(int) swap[0], -(int) swap[0]);
+    fe4_cswap(x2, x3, mask);
+    fe4_cswap(z2, z3, mask);
+    fe4_invert(z2, z2);
+    fe4_mul(x2, x2, z2);
+
+    for (i = 0; i < 10; i++) {
+        _mm256_store_si256((__m256i *) (void *) limbs[i], x2[i]);
+    }
+    for (j = 0; j < count; j++) {
+        for (i = 0; i < 10; i++) {
+            h[i] = limbs[i][j];
+        }
+        limbs_tobytes(q + j * 32U, h);
+    }
+    sodium_memzero(e, sizeof e);
+    sodium_memzero(limbs, sizeof limbs);
+    sodium_memzero(h, sizeof h);
+}
+
+#endif
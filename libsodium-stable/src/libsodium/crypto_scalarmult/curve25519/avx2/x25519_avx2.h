@@ -0,0 +1,11 @@
+#ifndef x25519_avx2_H
+#define x25519_avx2_H
+
+#include <stddef.h>
+
+#define X25519_AVX2_LANES 4U
+
+void x25519_avx2(unsigned char *q, const unsigned char *n,
+                 const unsigned char *p, size_t count);
+
+#endif
@@ -1,4 +1,6 @@
 
+#include <string.h>
+
 #include "crypto_scalarmult_curve25519.h"
 #include "private/implementations.h"
 #include "scalarmult_curve25519.h"
@@ -7,10 +9,28 @@
 #ifdef HAVE_AVX_ASM
 # include "sandy2x/curve25519_sandy2x.h"
 #endif
+#include "avx2/x25519_avx2.h"
 #include "ref10/x25519_ref10.h"
+
+#if defined(HAVE_AVX2INTRIN_H) && defined(HAVE_EMMINTRIN_H) && \
+    defined(HAVE_TMMINTRIN_H) && defined(HAVE_SMMINTRIN_H)
+# define HAVE_X25519_AVX2 1
+#endif
+
 static const crypto_scalarmult_curve25519_implementation *implementation =
     &crypto_scalarmult_curve25519_ref10_implementation;
 
+/* Computes up to x25519_lanes independent scalar multiplications at once,
+ * NULL if that wouldn't be faster than computing them one after the other */
+typedef void (*x25519_lanes_fn)(unsigned char *q, const unsigned char *n,
+                                const unsigned char *p, size_t count);
+
+static x25519_lanes_fn x25519_mult_lanes = NULL;
+static size_t          x25519_lanes      = 1U;
+
+/* Fewer points are multiplied one by one */
+#define X25519_BATCH_MIN 3U
+
 int
 crypto_scalarmult_curve25519(unsigned char *q, const unsigned char *n,
                              const unsigned char *p)
@@ -27,6 +47,41 @@ crypto_scalarmult_curve25519(unsigned char *q, const unsigned char *n,
     return -(1 & ((d - 1) >> 8));
 }
 
+int
+crypto_scalarmult_curve25519_batch(unsigned char *q, const unsigned char *n,
+                                   const unsigned char *p, size_t count)
+{
+    size_t                 i;
+    size_t                 j;
+    size_t                 k;
+    volatile unsigned char d;
+    unsigned int           bad = 0U;
+
+    while (count > 0U) {
+        if (x25519_mult_lanes != NULL && count >= X25519_BATCH_MIN) {
+            k = count < x25519_lanes ? count : x25519_lanes;
+            x25519_mult_lanes(q, n, p, k);
+        } else {
+            k = 1U;
+            if (implementation->mult(q, n, p) != 0) {
+                memset(q, 0, crypto_scalarmult_curve25519_BYTES);
+            }
+        }
+        for (j = 0; j < k; j++) {
+            d = 0;
+            for (i = 0; i < crypto_scalarmult_curve25519_BYTES; i++) {
+                d |= q[i];
+            }
+            bad |= 1 & ((d - 1) >> 8);
+            q += crypto_scalarmult_curve25519_BYTES;
+        }
+        n += k * crypto_scalarmult_curve25519_SCALARBYTES;
+        p += k * crypto_scalarmult_curve25519_BYTES;
+        count -= k;
+    }
+    return -(int) bad;
+}
+
 int
 crypto_scalarmult_curve25519_base(unsigned char *q, const unsigned char *n)
 {
@@ -49,12 +104,20 @@ crypto_scalarmult_curve25519_scalarbytes(void)
 int
 _crypto_scalarmult_curve25519_pick_best_implementation(void)
 {
-    implementation = &crypto_scalarmult_curve25519_ref10_implementation;
+    implementation    = &crypto_scalarmult_curve25519_ref10_implementation;
+    x25519_mult_lanes = NULL;
+    x25519_lanes      = 1U;
 
 #ifdef HAVE_AVX_ASM
     if (sodium_runtime_has_avx()) {
         implementation = &crypto_scalarmult_curve25519_sandy2x_implementation;
     }
+#endif
+#ifdef HAVE_X25519_AVX2
+    if (sodium_runtime_has_avx2()) {
+        x25519_mult_lanes = x25519_avx2;
+        x25519_lanes      = X25519_AVX2_LANES;
+    }
 #endif
     return 0;
 }
@@ -1,4 +1,6 @@
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "crypto_scalarmult_ed25519.h"
@@ -108,6 +110,137 @@ crypto_scalarmult_ed25519_base_noclamp(unsigned char *q,
     return _crypto_scalarmult_ed25519_base(q, n, 0);
 }
 
+#define ED25519_BASE_BATCH 32U
+
+static int
+_crypto_scalarmult_ed25519_base_batch(unsigned char *q, const unsigned char *n,
+                                      size_t count, const int clamp)
+{
+    unsigned char t[32];
+    ge25519_p3    Q[ED25519_BASE_BATCH];
+    size_t        i;
+    size_t        k;
+    size_t        m;
+    int           ret = 0;
+
+    for (i = 0; i < count; i += m) {
+        m = count - i;
+        if (m > ED25519_BASE_BATCH) {
+            m = ED25519_BASE_BATCH;
+        }
+        for (k = 0; k < m; k++) {
+            memcpy(t, &n[(i + k) * 32U], 32U);
+            if (clamp != 0) {
+                _crypto_scalarmult_ed25519_clamp(t);
+            }
+            t[31] &= 127;
+            ge25519_scalarmult_base(&Q[k], t);
+        }
+        ge25519_p3_tobytes_batch(&q[i * 32U], Q, m);
+        for (k = 0; k < m; k++) {
+            if (_crypto_scalarmult_ed25519_is_inf(&q[(i + k) * 32U]) != 0 ||
+                sodium_is_zero(&n[(i + k) * 32U], 32)) {
+                ret = -1;
+            }
+        }
+    }
+    sodium_memzero(t, sizeof t);
+
+    return ret;
+}
+
+int
+crypto_scalarmult_ed25519_base_batch(unsigned char *q, const unsigned char *n,
+                                     size_t count)
+{
+    return _crypto_scalarmult_ed25519_base_batch(q, n, count, 1);
+}
+
+int
+crypto_scalarmult_ed25519_base_noclamp_batch(unsigned char *q,
+                                             const unsigned char *n,
+                                             size_t count)
+{
+    return _crypto_scalarmult_ed25519_base_batch(q, n, count, 0);
+}
+
+static int
+_crypto_scalarmult_ed25519_multi(unsigned char *q, const unsigned char *n,
+                                 const unsigned char *p, size_t count,
+                                 const int vartime)
+{
+    unsigned char *t;
+    ge25519_p3    *P;
+    ge25519_p3     Q;
+    size_t         i;
+    int            ret;
+
+    if (count <= 0U || count > SIZE_MAX / sizeof *P) {
+        return -1;
+    }
+    P = (ge25519_p3 *) malloc(count * sizeof *P);
+    t = (unsigned char *) malloc(count * 32U);
+    if (P == NULL || t == NULL) {
+        /* LCOV_EXCL_START */
+        free(P);
+        free(t);
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+    ret = 0;
+    for (i = 0; i < count; i++) {
+        if (ge25519_is_canonical(&p[i * 32U]) == 0 ||
+            ge25519_has_small_order(&p[i * 32U]) != 0) {
+            ret = -1;
+        }
+        memcpy(&t[i * 32U], &n[i * 32U], 32U);
+        t[i * 32U + 31U] &= 127;
+    }
+    if (ret == 0) {
+        ret = ge25519_frombytes_batch(P, p, count, NULL);
+    }
+    for (i = 0; ret == 0 && i < count; i++) {
+        if (ge25519_is_on_main_subgroup(&P[i]) == 0) {
+            ret = -1;
+        }
+    }
+    if (ret == 0) {
+        if (vartime != 0) {
+            ret = ge25519_multi_scalarmult_vartime(&Q, t, P, count);
+        } else {
+            ret = ge25519_multi_scalarmult(&Q, t, P, count);
+        }
+    }
+    sodium_memzero(t, count * 32U);
+    free(t);
+    free(P);
+    if (ret != 0) {
+        return -1;
+    }
+    ge25519_p3_tobytes(q, &Q);
+    if (_crypto_scalarmult_ed25519_is_inf(q) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+int
+crypto_scalarmult_ed25519_multi_noclamp(unsigned char *q,
+                                        const unsigned char *n,
+                                        const unsigned char *p, size_t count)
+{
+    return _crypto_scalarmult_ed25519_multi(q, n, p, count, 0);
+}
+
+int
+crypto_scalarmult_ed25519_multi_noclamp_vartime(unsigned char *q,
+                                                const unsigned char *n,
+                                                const unsigned char *p,
+                                                size_t count)
+{
+    return _crypto_scalarmult_ed25519_multi(q, n, p, count, 1);
+}
+
 size_t
 crypto_scalarmult_ed25519_bytes(void)
 {
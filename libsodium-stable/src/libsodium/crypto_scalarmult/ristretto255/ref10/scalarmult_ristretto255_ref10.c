@@ -1,4 +1,6 @@
 
+#include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "crypto_scalarmult_ed25519.h"
@@ -50,6 +52,106 @@ crypto_scalarmult_ristretto255_base(unsigned char *q,
     return 0;
 }
 
+#define RISTRETTO255_BASE_BATCH 32U
+
+int
+crypto_scalarmult_ristretto255_base_batch(unsigned char *q,
+                                          const unsigned char *n,
+                                          size_t count)
+{
+    unsigned char t[32];
+    ge25519_p3    Q[RISTRETTO255_BASE_BATCH];
+    size_t        i;
+    size_t        k;
+    size_t        m;
+    int           ret = 0;
+
+    for (i = 0; i < count; i += m) {
+        m = count - i;
+        if (m > RISTRETTO255_BASE_BATCH) {
+            m = RISTRETTO255_BASE_BATCH;
+        }
+        for (k = 0; k < m; k++) {
+            memcpy(t, &n[(i + k) * 32U], 32U);
+            t[31] &= 127;
+            ge25519_scalarmult_base(&Q[k], t);
+        }
+        ristretto255_p3_tobytes_batch(&q[i * 32U], Q, m);
+        for (k = 0; k < m; k++) {
+            if (sodium_is_zero(&q[(i + k) * 32U], 32)) {
+                ret = -1;
+            }
+        }
+    }
+    sodium_memzero(t, sizeof t);
+
+    return ret;
+}
+
+static int
+_crypto_scalarmult_ristretto255_multi(unsigned char *q, const unsigned char *n,
+                                      const unsigned char *p, size_t count,
+                                      const int vartime)
+{
+    unsigned char *t;
+    ge25519_p3    *P;
+    ge25519_p3     Q;
+    size_t         i;
+    int            ret;
+
+    if (count <= 0U || count > SIZE_MAX / sizeof *P) {
+        return -1;
+    }
+    P = (ge25519_p3 *) malloc(count * sizeof *P);
+    t = (unsigned char *) malloc(count * 32U);
+    if (P == NULL || t == NULL) {
+        /* LCOV_EXCL_START */
+        free(P);
+        free(t);
+        return -1;
+        /* LCOV_EXCL_STOP */
+    }
+    for (i = 0; i < count; i++) {
+        memcpy(&t[i * 32U], &n[i * 32U], 32U);
+        t[i * 32U + 31U] &= 127;
+    }
+    ret = ristretto255_frombytes_batch(P, p, count, NULL);
+    if (ret == 0) {
+        if (vartime != 0) {
+            ret = ge25519_multi_scalarmult_vartime(&Q, t, P, count);
+        } else {
+            ret = ge25519_multi_scalarmult(&Q, t, P, count);
+        }
+    }
+    sodium_memzero(t, count * 32U);
+    free(t);
+    free(P);
+    if (ret != 0) {
+        return -1;
+    }
+    ristretto255_p3_tobytes(q, &Q);
+    if (sodium_is_zero(q, 32)) {
+        return -1;
+    }
+    return 0;
+}
+
+int
+crypto_scalarmult_ristretto255_multi(unsigned char *q, const unsigned char *n,
+                                     const unsigned char *p, size_t count)
+{
+    return _crypto_scalarmult_ristretto255_multi(q, n, p, count, 0);
+}
+
+int
+crypto_scalarmult_ristretto255_multi_vartime(unsigned char *q,
+                                             const unsigned char *n,
+                                             const unsigned char *p,
+                                             size_t count)
+{
+    return _crypto_scalarmult_ristretto255_multi(q, n, p, count, 1);
+}
+
 size_t
 crypto_scalarmult_ristretto255_bytes(void)
 {
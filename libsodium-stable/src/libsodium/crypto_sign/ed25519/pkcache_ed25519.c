@@ -0,0 +1,211 @@
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "crypto_shorthash_siphash24.h"
+#include "crypto_sign_ed25519.h"
+#include "randombytes.h"
+#include "utils.h"
+
+/*
+ * Prepared keys are found through a hash table keyed with SipHash and a
+ * random key, so that chosen public keys can't all land in the same
+ * bucket, and are kept in a doubly linked list from the most to the least
+ * recently used one.
+ */
+
+#define PKCACHE_NONE SIZE_MAX
+
+typedef struct pkcache_entry_ {
+    crypto_sign_ed25519_preparedkey prepared;
+    unsigned char                   pk[crypto_sign_ed25519_PUBLICKEYBYTES];
+    size_t                          bucket;
+    size_t                          chain; /* next entry in the same bucket */
+    size_t                          prev;
+    size_t                          next;
+} pkcache_entry;
+
+struct crypto_sign_ed25519_pkcache {
+    unsigned char  key[crypto_shorthash_siphash24_KEYBYTES];
+    void          *base;
+    pkcache_entry *entries;
+    size_t        *buckets;
+    size_t         bucket_mask;
+    size_t         capacity;
+    size_t         count;
+    size_t         head;
+    size_t         tail;
+    uint64_t       hits;
+    uint64_t       misses;
+};
+
+static size_t
+pkcache_bucket(const crypto_sign_ed25519_pkcache *cache,
+               const unsigned char *pk)
+{
+    unsigned char h[crypto_shorthash_siphash24_BYTES];
+    uint64_t      v;
+
+    crypto_shorthash_siphash24(h, pk, crypto_sign_ed25519_PUBLICKEYBYTES,
+                               cache->key);
+    memcpy(&v, h, sizeof v);
+
+    return (size_t) v & cache->bucket_mask;
+}
+
+static void
+pkcache_unlink(crypto_sign_ed25519_pkcache *cache, size_t i)
+{
+    pkcache_entry *e = &cache->entries[i];
+
+    if (e->prev != PKCACHE_NONE) {
+        cache->entries[e->prev].next = e->next;
+    } else {
+        cache->head = e->next;
+    }
+    if (e->next != PKCACHE_NONE) {
+        cache->entries[e->next].prev = e->prev;
+    } else {
+        cache->tail = e->prev;
+    }
+}
+
+static void
+pkcache_push_front(crypto_sign_ed25519_pkcache *cache, size_t i)
+{
+    pkcache_entry *e = &cache->entries[i];
+
+    e->prev = PKCACHE_NONE;
+    e->next = cache->head;
+    if (cache->head != PKCACHE_NONE) {
+        cache->entries[cache->head].prev = i;
+    } else {
+        cache->tail = i;
+    }
+    cache->head = i;
+}
+
+static void
+pkcache_remove_from_bucket(crypto_sign_ed25519_pkcache *cache, size_t i)
+{
+    size_t *link = &cache->buckets[cache->entries[i].bucket];
+
+    while (*link != i) {
+        link = &cache->entries[*link].chain;
+    }
+    *link = cache->entries[i].chain;
+}
+
+crypto_sign_ed25519_pkcache *
+crypto_sign_ed25519_pkcache_new(size_t capacity)
+{
+    crypto_sign_ed25519_pkcache *cache;
+    size_t                       nbuckets = 1U;
+    size_t                       i;
+
+    if (capacity <= 0U ||
+        capacity > (SIZE_MAX - 15U) / sizeof(pkcache_entry) ||
+        capacity > SIZE_MAX / 2U / sizeof(size_t)) {
+        errno = EINVAL;
+        return NULL;
+    }
+    while (nbuckets < capacity) {
+        nbuckets <<= 1;
+    }
+    if ((cache = (crypto_sign_ed25519_pkcache *) malloc(sizeof *cache)) == NULL) {
+        return NULL;
+    }
+    cache->base    = malloc(capacity * sizeof(pkcache_entry) + 15U);
+    cache->buckets = (size_t *) malloc(nbuckets * sizeof(size_t));
+    if (cache->base == NULL || cache->buckets == NULL) {
+        free(cache->base);
+        free(cache->buckets);
+        free(cache);
+        return NULL;
+    }
+    cache->entries = (pkcache_entry *) (void *)
+        (((uintptr_t) cache->base + 15U) & ~(uintptr_t) 15U);
+    for (i = 0; i < nbuckets; i++) {
+        cache->buckets[i] = PKCACHE_NONE;
+    }
+    randombytes_buf(cache->key, sizeof cache->key);
+    cache->bucket_mask = nbuckets - 1U;
+    cache->capacity    = capacity;
+    cache->count       = 0U;
+    cache->head = cache->tail = PKCACHE_NONE;
+    cache->hits = cache->misses = 0U;
+
+    return cache;
+}
+
+void
+crypto_sign_ed25519_pkcache_free(crypto_sign_ed25519_pkcache *cache)
+{
+    if (cache == NULL) {
+        return;
+    }
+    free(cache->base);
+    free(cache->buckets);
+    sodium_memzero(cache->key, sizeof cache->key);
+    free(cache);
+}
+
+void
+crypto_sign_ed25519_pkcache_stats(const crypto_sign_ed25519_pkcache *cache,
+                                  uint64_t *hits, uint64_t *misses)
+{
+    *hits   = cache->hits;
+    *misses = cache->misses;
+}
+
+int
+crypto_sign_ed25519_verify_detached_cached(crypto_sign_ed25519_pkcache *cache,
+                                           const unsigned char *sig,
+                                           const unsigned char *m,
+                                           unsigned long long mlen,
+                                           const unsigned char *pk)
+{
+    crypto_sign_ed25519_preparedkey prepared;
+    pkcache_entry                  *e;
+    size_t                          bucket;
+    size_t                          i;
+
+    bucket = pkcache_bucket(cache, pk);
+    for (i = cache->buckets[bucket]; i != PKCACHE_NONE;
+         i = cache->entries[i].chain) {
+        if (memcmp(cache->entries[i].pk, pk,
+                   crypto_sign_ed25519_PUBLICKEYBYTES) == 0) {
+            cache->hits++;
+            if (cache->head != i) {
+                pkcache_unlink(cache, i);
+                pkcache_push_front(cache, i);
+            }
+            return crypto_sign_ed25519_verify_detached_prepared(
+                sig, m, mlen, &cache->entries[i].prepared);
+        }
+    }
+    cache->misses++;
+    /* invalid keys are not cached, so they can't evict valid ones */
+    if (crypto_sign_ed25519_pk_prepare(&prepared, pk) != 0) {
+        return -1;
+    }
+    if (cache->count < cache->capacity) {
+        i = cache->count++;
+    } else {
+        i = cache->tail;
+        pkcache_unlink(cache, i);
+        pkcache_remove_from_bucket(cache, i);
+    }
+    e = &cache->entries[i];
+    memcpy(&e->prepared, &prepared, sizeof prepared);
+    memcpy(e->pk, pk, crypto_sign_ed25519_PUBLICKEYBYTES);
+    e->bucket = bucket;
+    e->chain  = cache->buckets[bucket];
+    cache->buckets[bucket] = i;
+    pkcache_push_front(cache, i);
+
+    return crypto_sign_ed25519_verify_detached_prepared(sig, m, mlen,
+                                                        &e->prepared);
+}
@@ -1,26 +1,54 @@
 
 #include <limits.h>
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "crypto_hash_sha512.h"
 #include "crypto_sign_ed25519.h"
 #include "crypto_verify_32.h"
+#include "randombytes.h"
 #include "sign_ed25519_ref10.h"
+#include "private/common.h"
 #include "private/ed25519_ref10.h"
 #include "utils.h"
 
-int
-_crypto_sign_ed25519_verify_detached(const unsigned char *sig,
+typedef struct ed25519_preparedkey_ {
+    ge25519_cached Ai[8]; /* -A,-3A,-5A,-7A,-9A,-11A,-13A,-15A */
+    unsigned char  pk[32];
+} ed25519_preparedkey;
+
+static int
+_crypto_sign_ed25519_pk_prepare(ed25519_preparedkey *prepared,
+                                const unsigned char *pk)
+{
+    ge25519_p3 A;
+
+#ifndef ED25519_COMPAT
+    if (ge25519_is_canonical(pk) == 0 ||
+        ge25519_has_small_order(pk) != 0) {
+        return -1;
+    }
+#endif
+    if (ge25519_frombytes_negate_vartime(&A, pk) != 0) {
+        return -1;
+    }
+    ge25519_odd_multiples(prepared->Ai, &A);
+    memcpy(prepared->pk, pk, 32);
+
+    return 0;
+}
+
+static int
+_crypto_sign_ed25519_verify_prepared(const unsigned char *sig,
                                      const unsigned char *m,
                                      unsigned long long   mlen,
-                                     const unsigned char *pk,
+                                     const ed25519_preparedkey *prepared,
                                      int prehashed)
 {
     crypto_hash_sha512_state hs;
     unsigned char            h[64];
     unsigned char            rcheck[32];
-    ge25519_p3               A;
     ge25519_p2               R;
 
 #ifdef ED25519_COMPAT
@@ -32,28 +60,37 @@ _crypto_sign_ed25519_verify_detached(const unsigned char *sig,
         ge25519_has_small_order(sig) != 0) {
         return -1;
     }
-    if (ge25519_is_canonical(pk) == 0 ||
-        ge25519_has_small_order(pk) != 0) {
-        return -1;
-    }
 #endif
-    if (ge25519_frombytes_negate_vartime(&A, pk) != 0) {
-        return -1;
-    }
     _crypto_sign_ed25519_ref10_hinit(&hs, prehashed);
     crypto_hash_sha512_update(&hs, sig, 32);
-    crypto_hash_sha512_update(&hs, pk, 32);
+    crypto_hash_sha512_update(&hs, prepared->pk, 32);
     crypto_hash_sha512_update(&hs, m, mlen);
     crypto_hash_sha512_final(&hs, h);
     sc25519_reduce(h);
 
-    ge25519_double_scalarmult_vartime(&R, h, &A, sig + 32);
+    ge25519_double_scalarmult_vartime_precomp(&R, h, prepared->Ai, sig + 32);
     ge25519_tobytes(rcheck, &R);
 
     return crypto_verify_32(rcheck, sig) | (-(rcheck == sig)) |
            sodium_memcmp(sig, rcheck, 32);
 }
 
+int
+_crypto_sign_ed25519_verify_detached(const unsigned char *sig,
+                                     const unsigned char *m,
+                                     unsigned long long   mlen,
+                                     const unsigned char *pk,
+                                     int prehashed)
+{
+    ed25519_preparedkey prepared;
+
+    if (_crypto_sign_ed25519_pk_prepare(&prepared, pk) != 0) {
+        return -1;
+    }
+    return _crypto_sign_ed25519_verify_prepared(sig, m, mlen, &prepared,
+                                                prehashed);
+}
+
 int
 crypto_sign_ed25519_verify_detached(const unsigned char *sig,
                                     const unsigned char *m,
@@ -63,6 +100,188 @@ crypto_sign_ed25519_verify_detached(const unsigned char *sig,
     return _crypto_sign_ed25519_verify_detached(sig, m, mlen, pk, 0);
 }
 
+int
+crypto_sign_ed25519_pk_prepare(crypto_sign_ed25519_preparedkey *prepared,
+                               const unsigned char *pk)
+{
+    COMPILER_ASSERT(sizeof(crypto_sign_ed25519_preparedkey) >=
+                    sizeof(ed25519_preparedkey));
+    return _crypto_sign_ed25519_pk_prepare(
+        (ed25519_preparedkey *) (void *) prepared, pk);
+}
+
+int
+crypto_sign_ed25519_verify_detached_prepared(
+    const unsigned char *sig, const unsigned char *m, unsigned long long mlen,
+    const crypto_sign_ed25519_preparedkey *prepared)
+{
+    return _crypto_sign_ed25519_verify_prepared(
+        sig, m, mlen, (const ed25519_preparedkey *) (const void *) prepared, 0);
+}
+
+/*
+ Signatures are checked together in chunks of up to ED25519_BATCH_MAX:
+ sum z_i (S_i B - R_i - H(R_i || A_i || m_i) A_i) = 0 for random 128-bit z_i,
+ with a single multi-scalar multiplication. If a chunk doesn't pass as a
+ whole, its signatures are verified one by one with
+ crypto_sign_ed25519_verify_detached() to find the bad ones.
+
+ Each signature gets the same encoding and small-order checks as
+ crypto_sign_ed25519_verify_detached(), and the equation is cofactorless like
+ the one it checks, so a chunk of signatures it accepts always passes. The
+ only way for a chunk to pass with a signature it rejects is for an R_i or A_i
+ with a small-order component to leave a residue that the z_i happen to
+ cancel, which they do with probability at most 1/2; honest signers never
+ produce such points.
+ */
+
+#define ED25519_BATCH_MAX 256U
+
+static int
+_crypto_sign_ed25519_verify_batch_chunk(const unsigned char * const *sigs,
+                                        const unsigned char * const *ms,
+                                        const unsigned long long *mlens,
+                                        const unsigned char * const *pks,
+                                        size_t count)
+{
+    crypto_hash_sha512_state hs;
+    ge25519_p3              *points;
+    unsigned char           *scalars;
+    unsigned char            h[64];
+    unsigned char            z[32];
+    unsigned char            s[32];
+    ge25519_cached           c;
+    ge25519_p1p1             t;
+    ge25519_p3               P;
+    ge25519_p3               SB;
+    fe25519                  y_minus_z;
+    size_t                   i;
+    int                      ret = -1;
+
+    points  = (ge25519_p3 *) malloc(2U * count * sizeof *points);
+    scalars = (unsigned char *) malloc(2U * count * 32U);
+    if (points == NULL || scalars == NULL) {
+        goto out; /* LCOV_EXCL_LINE */
+    }
+    for (i = 0; i < count; i++) {
+        const unsigned char *sig = sigs[i];
+        const unsigned char *pk  = pks[i];
+
+#ifdef ED25519_COMPAT
+        if (sig[63] & 224) {
+            goto out;
+        }
+#else
+        if (sc25519_is_canonical(sig + 32) == 0 ||
+            ge25519_has_small_order(sig) != 0) {
+            goto out;
+        }
+        if (ge25519_is_canonical(pk) == 0 ||
+            ge25519_has_small_order(pk) != 0) {
+            goto out;
+        }
+#endif
+        /* R is compared as bytes when verifying a single signature */
+        if (ge25519_is_canonical(sig) == 0) {
+            goto out;
+        }
+        /* the encoded points are decoded all at once, then replaced with
+         * their scalars */
+        memcpy(&scalars[2 * i * 32], sig, 32);
+        memcpy(&scalars[(2 * i + 1) * 32], pk, 32);
+    }
+    if (ge25519_frombytes_batch(points, scalars, 2U * count, NULL) != 0) {
+        goto out;
+    }
+    memset(z, 0, sizeof z);
+    memset(s, 0, sizeof s);
+    for (i = 0; i < count; i++) {
+        const unsigned char *sig = sigs[i];
+        const unsigned char *pk  = pks[i];
+
+        fe25519_neg(points[2 * i].X, points[2 * i].X);
+        fe25519_neg(points[2 * i].T, points[2 * i].T);
+        fe25519_neg(points[2 * i + 1].X, points[2 * i + 1].X);
+        fe25519_neg(points[2 * i + 1].T, points[2 * i + 1].T);
+
+        _crypto_sign_ed25519_ref10_hinit(&hs, 0);
+        crypto_hash_sha512_update(&hs, sig, 32);
+        crypto_hash_sha512_update(&hs, pk, 32);
+        crypto_hash_sha512_update(&hs, ms[i], mlens[i]);
+        crypto_hash_sha512_final(&hs, h);
+        sc25519_reduce(h);
+
+        randombytes_buf(z, 16);
+        memcpy(&scalars[2 * i * 32], z, 32);
+        sc25519_mul(&scalars[(2 * i + 1) * 32], z, h);
+        sc25519_muladd(s, z, sig + 32, s);
+    }
+    if (ge25519_multi_scalarmult_vartime(&P, scalars, points,
+                                         2U * count) != 0) {
+        goto out; /* LCOV_EXCL_LINE */
+    }
+    ge25519_scalarmult_base(&SB, s);
+    ge25519_p3_to_cached(&c, &SB);
+    ge25519_add(&t, &P, &c);
+    ge25519_p1p1_to_p3(&P, &t);
+
+    fe25519_sub(y_minus_z, P.Y, P.Z);
+    ret = (fe25519_iszero(P.X) & fe25519_iszero(y_minus_z)) - 1;
+
+out:
+    free(points);
+    free(scalars);
+
+    return ret;
+}
+
+int
+crypto_sign_ed25519_verify_detached_batch(const unsigned char * const *sigs,
+                                          const unsigned char * const *ms,
+                                          const unsigned long long *mlens,
+                                          const unsigned char * const *pks,
+                                          size_t count, int *results)
+{
+    size_t chunk;
+    size_t i;
+    int    ret = 0;
+
+    while (count > 0U) {
+        chunk = count < ED25519_BATCH_MAX ? count : ED25519_BATCH_MAX;
+        if (_crypto_sign_ed25519_verify_batch_chunk(sigs, ms, mlens, pks,
+                                                    chunk) == 0) {
+            if (results != NULL) {
+                for (i = 0; i < chunk; i++) {
+                    results[i] = 0;
+                }
+            }
+        } else {
+            for (i = 0; i < chunk; i++) {
+                if (crypto_sign_ed25519_verify_detached(sigs[i], ms[i],
+                                                        mlens[i],
+                                                        pks[i]) != 0) {
+                    ret = -1;
+                    if (results == NULL) {
+                        return ret;
+                    }
+                    results[i] = -1;
+                } else if (results != NULL) {
+                    results[i] = 0;
+                }
+            }
+        }
+        sigs += chunk;
+        ms += chunk;
+        mlens += chunk;
+        pks += chunk;
+        if (results != NULL) {
+            results += chunk;
+        }
+        count -= chunk;
+    }
+    return ret;
+}
+
 int
 crypto_sign_ed25519_open(unsigned char *m, unsigned long long *mlen_p,
                          const unsigned char *sm, unsigned long long smlen,
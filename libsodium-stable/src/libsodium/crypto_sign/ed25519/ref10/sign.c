@@ -61,30 +61,34 @@ _crypto_sign_ed25519_synthetic_r_hv(crypto_hash_sha512_state *hs,
 }
 #endif
 
+/*
+ esk = clamped scalar || nonce prefix || public key, as returned by
+ crypto_sign_ed25519_sk_to_expanded()
+ */
 int
-_crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
-                              const unsigned char *m, unsigned long long mlen,
-                              const unsigned char *sk, int prehashed)
+_crypto_sign_ed25519_expanded_detached(unsigned char *sig,
+                                       unsigned long long *siglen_p,
+                                       const unsigned char *m,
+                                       unsigned long long mlen,
+                                       const unsigned char *esk, int prehashed)
 {
     crypto_hash_sha512_state hs;
-    unsigned char            az[64];
     unsigned char            nonce[64];
     unsigned char            hram[64];
     ge25519_p3               R;
 
     _crypto_sign_ed25519_ref10_hinit(&hs, prehashed);
 
-    crypto_hash_sha512(az, sk, 32);
 #ifdef ED25519_NONDETERMINISTIC
-    _crypto_sign_ed25519_synthetic_r_hv(&hs, nonce /* Z */, az);
+    _crypto_sign_ed25519_synthetic_r_hv(&hs, nonce /* Z */, esk);
 #else
-    crypto_hash_sha512_update(&hs, az + 32, 32);
+    crypto_hash_sha512_update(&hs, esk + 32, 32);
 #endif
 
     crypto_hash_sha512_update(&hs, m, mlen);
     crypto_hash_sha512_final(&hs, nonce);
 
-    memmove(sig + 32, sk + 32, 32);
+    memmove(sig + 32, esk + 64, 32);
 
     sc25519_reduce(nonce);
     ge25519_scalarmult_base(&R, nonce);
@@ -96,10 +100,8 @@ _crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
     crypto_hash_sha512_final(&hs, hram);
 
     sc25519_reduce(hram);
-    _crypto_sign_ed25519_clamp(az);
-    sc25519_muladd(sig + 32, hram, az, nonce);
+    sc25519_muladd(sig + 32, hram, esk, nonce);
 
-    sodium_memzero(az, sizeof az);
     sodium_memzero(nonce, sizeof nonce);
 
     if (siglen_p != NULL) {
@@ -108,6 +110,36 @@ _crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
     return 0;
 }
 
+int
+_crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
+                              const unsigned char *m, unsigned long long mlen,
+                              const unsigned char *sk, int prehashed)
+{
+    unsigned char esk[crypto_sign_ed25519_EXPANDEDSECRETKEYBYTES];
+    int           ret;
+
+    crypto_sign_ed25519_sk_to_expanded(esk, sk);
+    ret = _crypto_sign_ed25519_expanded_detached(sig, siglen_p, m, mlen, esk,
+                                                 prehashed);
+    sodium_memzero(esk, sizeof esk);
+
+    return ret;
+}
+
+int
+crypto_sign_ed25519_sk_to_expanded(unsigned char *esk, const unsigned char *sk)
+{
+    unsigned char az[64];
+
+    crypto_hash_sha512(az, sk, 32);
+    _crypto_sign_ed25519_clamp(az);
+    memmove(esk + 64, sk + 32, 32);
+    memcpy(esk, az, 64);
+    sodium_memzero(az, sizeof az);
+
+    return 0;
+}
+
 int
 crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
                              const unsigned char *m, unsigned long long mlen,
@@ -116,6 +148,17 @@ crypto_sign_ed25519_detached(unsigned char *sig, unsigned long long *siglen_p,
     return _crypto_sign_ed25519_detached(sig, siglen_p, m, mlen, sk, 0);
 }
 
+int
+crypto_sign_ed25519_expanded_detached(unsigned char *sig,
+                                      unsigned long long *siglen_p,
+                                      const unsigned char *m,
+                                      unsigned long long mlen,
+                                      const unsigned char *esk)
+{
+    return _crypto_sign_ed25519_expanded_detached(sig, siglen_p, m, mlen, esk,
+                                                  0);
+}
+
 int
 crypto_sign_ed25519(unsigned char *sm, unsigned long long *smlen_p,
                     const unsigned char *m, unsigned long long mlen,
@@ -141,3 +184,29 @@ crypto_sign_ed25519(unsigned char *sm, unsigned long long *smlen_p,
     }
     return 0;
 }
+
+int
+crypto_sign_ed25519_expanded(unsigned char *sm, unsigned long long *smlen_p,
+                             const unsigned char *m, unsigned long long mlen,
+                             const unsigned char *esk)
+{
+    unsigned long long siglen;
+
+    memmove(sm + crypto_sign_ed25519_BYTES, m, mlen);
+    /* LCOV_EXCL_START */
+    if (crypto_sign_ed25519_expanded_detached(
+            sm, &siglen, sm + crypto_sign_ed25519_BYTES, mlen, esk) != 0 ||
+        siglen != crypto_sign_ed25519_BYTES) {
+        if (smlen_p != NULL) {
+            *smlen_p = 0;
+        }
+        memset(sm, 0, mlen + crypto_sign_ed25519_BYTES);
+        return -1;
+    }
+    /* LCOV_EXCL_STOP */
+
+    if (smlen_p != NULL) {
+        *smlen_p = mlen + siglen;
+    }
+    return 0;
+}
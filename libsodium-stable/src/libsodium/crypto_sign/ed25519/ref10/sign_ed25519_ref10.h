@@ -10,6 +10,13 @@ int _crypto_sign_ed25519_detached(unsigned char *sig,
                                   unsigned long long mlen,
                                   const unsigned char *sk, int prehashed);
 
+int _crypto_sign_ed25519_expanded_detached(unsigned char *sig,
+                                           unsigned long long *siglen_p,
+                                           const unsigned char *m,
+                                           unsigned long long mlen,
+                                           const unsigned char *esk,
+                                           int prehashed);
+
 int _crypto_sign_ed25519_verify_detached(const unsigned char *sig,
                                          const unsigned char *m,
                                          unsigned long long   mlen,
@@ -11,6 +11,12 @@ crypto_sign_ed25519ph_statebytes(void)
     return sizeof(crypto_sign_ed25519ph_state);
 }
 
+size_t
+crypto_sign_ed25519_preparedkeybytes(void)
+{
+    return sizeof(crypto_sign_ed25519_preparedkey);
+}
+
 size_t
 crypto_sign_ed25519_bytes(void)
 {
@@ -35,6 +41,12 @@ crypto_sign_ed25519_secretkeybytes(void)
     return crypto_sign_ed25519_SECRETKEYBYTES;
 }
 
+size_t
+crypto_sign_ed25519_expandedsecretkeybytes(void)
+{
+    return crypto_sign_ed25519_EXPANDEDSECRETKEYBYTES;
+}
+
 size_t
 crypto_sign_ed25519_messagebytes_max(void)
 {
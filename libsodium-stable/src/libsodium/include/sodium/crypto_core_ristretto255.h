@@ -28,6 +28,17 @@ SODIUM_EXPORT
 int crypto_core_ristretto255_is_valid_point(const unsigned char *p)
             __attribute__ ((nonnull));
 
+/*
+ * Checks count consecutive 32-byte encodings at once, which is faster
+ * than calling crypto_core_ristretto255_is_valid_point() for each of them.
+ * Returns 1 if all of them are valid. If results is not NULL, results[i]
+ * is set to crypto_core_ristretto255_is_valid_point(p + 32 * i).
+ */
+SODIUM_EXPORT
+int crypto_core_ristretto255_is_valid_point_batch(const unsigned char *p,
+                                                  size_t count, int *results)
+            __attribute__ ((nonnull(1)));
+
 SODIUM_EXPORT
 int crypto_core_ristretto255_add(unsigned char *r,
                                  const unsigned char *p, const unsigned char *q)
@@ -38,6 +38,13 @@ SODIUM_EXPORT
 int crypto_hash_sha256(unsigned char *out, const unsigned char *in,
                        unsigned long long inlen) __attribute__ ((nonnull(1)));
 
+/* Hashes count independent messages into count consecutive digests */
+SODIUM_EXPORT
+int crypto_hash_sha256_batch(unsigned char *out,
+                             const unsigned char * const *in,
+                             const unsigned long long *inlen, size_t count)
+            __attribute__ ((nonnull(1)));
+
 SODIUM_EXPORT
 int crypto_hash_sha256_init(crypto_hash_sha256_state *state)
             __attribute__ ((nonnull));
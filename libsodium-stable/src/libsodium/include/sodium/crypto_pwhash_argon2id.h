@@ -63,6 +63,14 @@ size_t crypto_pwhash_argon2id_memlimit_min(void);
 SODIUM_EXPORT
 size_t crypto_pwhash_argon2id_memlimit_max(void);
 
+#define crypto_pwhash_argon2id_PARALLELISM_MIN 1U
+SODIUM_EXPORT
+size_t crypto_pwhash_argon2id_parallelism_min(void);
+
+#define crypto_pwhash_argon2id_PARALLELISM_MAX 255U
+SODIUM_EXPORT
+size_t crypto_pwhash_argon2id_parallelism_max(void);
+
 #define crypto_pwhash_argon2id_OPSLIMIT_INTERACTIVE 2U
 SODIUM_EXPORT
 size_t crypto_pwhash_argon2id_opslimit_interactive(void);
@@ -104,6 +112,25 @@ int crypto_pwhash_argon2id_str(char out[crypto_pwhash_argon2id_STRBYTES],
                                unsigned long long opslimit, size_t memlimit)
             __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
 
+/* Variants of the above with `parallelism` lanes, filled concurrently */
+SODIUM_EXPORT
+int crypto_pwhash_argon2id_parallel(unsigned char * const out,
+                                    unsigned long long outlen,
+                                    const char * const passwd,
+                                    unsigned long long passwdlen,
+                                    const unsigned char * const salt,
+                                    unsigned long long opslimit, size_t memlimit,
+                                    unsigned int parallelism, int alg)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
+SODIUM_EXPORT
+int crypto_pwhash_argon2id_str_parallel(char out[crypto_pwhash_argon2id_STRBYTES],
+                                        const char * const passwd,
+                                        unsigned long long passwdlen,
+                                        unsigned long long opslimit, size_t memlimit,
+                                        unsigned int parallelism)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
 SODIUM_EXPORT
 int crypto_pwhash_argon2id_str_verify(const char str[crypto_pwhash_argon2id_STRBYTES],
                                       const char * const passwd,
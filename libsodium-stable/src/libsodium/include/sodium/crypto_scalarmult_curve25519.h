@@ -30,6 +30,17 @@ int crypto_scalarmult_curve25519(unsigned char *q, const unsigned char *n,
                                  const unsigned char *p)
             __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
 
+/*
+ * Computes count independent scalar multiplications: q[i] = n[i] * p[i],
+ * with count consecutive 32-byte scalars and points. All of them are
+ * computed, but -1 is returned if any of the results is all zeros.
+ */
+SODIUM_EXPORT
+int crypto_scalarmult_curve25519_batch(unsigned char *q,
+                                       const unsigned char *n,
+                                       const unsigned char *p, size_t count)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
 SODIUM_EXPORT
 int crypto_scalarmult_curve25519_base(unsigned char *q,
                                       const unsigned char *n)
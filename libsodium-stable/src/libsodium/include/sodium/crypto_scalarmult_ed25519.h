@@ -44,6 +44,43 @@ SODIUM_EXPORT
 int crypto_scalarmult_ed25519_base_noclamp(unsigned char *q, const unsigned char *n)
             __attribute__ ((nonnull));
 
+/*
+ * crypto_scalarmult_ed25519_base() and crypto_scalarmult_ed25519_base_noclamp()
+ * for count consecutive scalars, with the encodings of the results computed
+ * together. Return -1 if any of the results is the identity element.
+ */
+SODIUM_EXPORT
+int crypto_scalarmult_ed25519_base_batch(unsigned char *q,
+                                         const unsigned char *n, size_t count)
+            __attribute__ ((nonnull));
+
+SODIUM_EXPORT
+int crypto_scalarmult_ed25519_base_noclamp_batch(unsigned char *q,
+                                                 const unsigned char *n,
+                                                 size_t count)
+            __attribute__ ((nonnull));
+
+/*
+ * q = n[0] * p[0] + n[1] * p[1] + ... + n[count - 1] * p[count - 1]
+ *
+ * n holds count scalars and p count points, 32 bytes each.
+ * The _vartime() variant is faster, but must only be used with public
+ * scalars.
+ */
+SODIUM_EXPORT
+int crypto_scalarmult_ed25519_multi_noclamp(unsigned char *q,
+                                            const unsigned char *n,
+                                            const unsigned char *p,
+                                            size_t count)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
+SODIUM_EXPORT
+int crypto_scalarmult_ed25519_multi_noclamp_vartime(unsigned char *q,
+                                                    const unsigned char *n,
+                                                    const unsigned char *p,
+                                                    size_t count)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
 #ifdef __cplusplus
 }
 #endif
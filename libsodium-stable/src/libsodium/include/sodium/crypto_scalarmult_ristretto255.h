@@ -36,6 +36,37 @@ int crypto_scalarmult_ristretto255_base(unsigned char *q,
                                         const unsigned char *n)
             __attribute__ ((nonnull));
 
+/*
+ * crypto_scalarmult_ristretto255_base() for count consecutive scalars,
+ * with the encodings of the results computed together.
+ * Returns -1 if any of the results is the identity element.
+ */
+SODIUM_EXPORT
+int crypto_scalarmult_ristretto255_base_batch(unsigned char *q,
+                                              const unsigned char *n,
+                                              size_t count)
+            __attribute__ ((nonnull));
+
+/*
+ * q = n[0] * p[0] + n[1] * p[1] + ... + n[count - 1] * p[count - 1]
+ *
+ * n holds count scalars and p count points, 32 bytes each.
+ * The _vartime() variant is faster, but must only be used with public
+ * scalars.
+ */
+SODIUM_EXPORT
+int crypto_scalarmult_ristretto255_multi(unsigned char *q,
+                                         const unsigned char *n,
+                                         const unsigned char *p, size_t count)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
+SODIUM_EXPORT
+int crypto_scalarmult_ristretto255_multi_vartime(unsigned char *q,
+                                                 const unsigned char *n,
+                                                 const unsigned char *p,
+                                                 size_t count)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
 #ifdef __cplusplus
 }
 #endif
@@ -2,6 +2,8 @@
 #define crypto_sign_ed25519_H
 
 #include <stddef.h>
+#include <stdint.h>
+
 #include "crypto_hash_sha512.h"
 #include "export.h"
 
@@ -19,6 +21,17 @@ typedef struct crypto_sign_ed25519ph_state {
 SODIUM_EXPORT
 size_t crypto_sign_ed25519ph_statebytes(void);
 
+/* A public key with the multiples of its point that verification uses */
+typedef struct CRYPTO_ALIGN(16) crypto_sign_ed25519_preparedkey {
+    unsigned char opaque[1312];
+} crypto_sign_ed25519_preparedkey;
+
+SODIUM_EXPORT
+size_t crypto_sign_ed25519_preparedkeybytes(void);
+
+/* Least recently used prepared keys, see crypto_sign_ed25519_pkcache_new() */
+typedef struct crypto_sign_ed25519_pkcache crypto_sign_ed25519_pkcache;
+
 #define crypto_sign_ed25519_BYTES 64U
 SODIUM_EXPORT
 size_t crypto_sign_ed25519_bytes(void);
@@ -35,6 +48,11 @@ size_t crypto_sign_ed25519_publickeybytes(void);
 SODIUM_EXPORT
 size_t crypto_sign_ed25519_secretkeybytes(void);
 
+/* Clamped scalar, nonce prefix and public key, see crypto_sign_ed25519_sk_to_expanded() */
+#define crypto_sign_ed25519_EXPANDEDSECRETKEYBYTES (32U + 32U + 32U)
+SODIUM_EXPORT
+size_t crypto_sign_ed25519_expandedsecretkeybytes(void);
+
 #define crypto_sign_ed25519_MESSAGEBYTES_MAX (SODIUM_SIZE_MAX - crypto_sign_ed25519_BYTES)
 SODIUM_EXPORT
 size_t crypto_sign_ed25519_messagebytes_max(void);
@@ -59,6 +77,25 @@ int crypto_sign_ed25519_detached(unsigned char *sig,
                                  const unsigned char *sk)
             __attribute__ ((nonnull(1, 5)));
 
+/*
+ * Same signatures as crypto_sign_ed25519() and crypto_sign_ed25519_detached(),
+ * from a secret key expanded once with crypto_sign_ed25519_sk_to_expanded()
+ * instead of hashing it for every signature.
+ */
+SODIUM_EXPORT
+int crypto_sign_ed25519_expanded(unsigned char *sm, unsigned long long *smlen_p,
+                                 const unsigned char *m, unsigned long long mlen,
+                                 const unsigned char *esk)
+            __attribute__ ((nonnull(1, 5)));
+
+SODIUM_EXPORT
+int crypto_sign_ed25519_expanded_detached(unsigned char *sig,
+                                          unsigned long long *siglen_p,
+                                          const unsigned char *m,
+                                          unsigned long long mlen,
+                                          const unsigned char *esk)
+            __attribute__ ((nonnull(1, 5)));
+
 SODIUM_EXPORT
 int crypto_sign_ed25519_verify_detached(const unsigned char *sig,
                                         const unsigned char *m,
@@ -66,6 +103,71 @@ int crypto_sign_ed25519_verify_detached(const unsigned char *sig,
                                         const unsigned char *pk)
             __attribute__ ((warn_unused_result)) __attribute__ ((nonnull(1, 4)));
 
+/*
+ * Decodes a public key and precomputes what crypto_sign_ed25519_verify_detached()
+ * would compute from it for every signature. Returns -1 if the key is invalid.
+ */
+SODIUM_EXPORT
+int crypto_sign_ed25519_pk_prepare(crypto_sign_ed25519_preparedkey *prepared,
+                                   const unsigned char *pk)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull));
+
+SODIUM_EXPORT
+int crypto_sign_ed25519_verify_detached_prepared(const unsigned char *sig,
+                                                 const unsigned char *m,
+                                                 unsigned long long mlen,
+                                                 const crypto_sign_ed25519_preparedkey *prepared)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull(1, 4)));
+
+/*
+ * A cache of up to capacity prepared keys, the least recently used one
+ * being replaced when it is full. Returns NULL if it couldn't be allocated.
+ * A cache must not be used by multiple threads at the same time.
+ */
+SODIUM_EXPORT
+crypto_sign_ed25519_pkcache *crypto_sign_ed25519_pkcache_new(size_t capacity)
+            __attribute__ ((warn_unused_result));
+
+SODIUM_EXPORT
+void crypto_sign_ed25519_pkcache_free(crypto_sign_ed25519_pkcache *cache);
+
+/*
+ * Number of lookups that found the key in the cache, and of those that had
+ * to prepare it, invalid keys included, since the cache was created.
+ */
+SODIUM_EXPORT
+void crypto_sign_ed25519_pkcache_stats(const crypto_sign_ed25519_pkcache *cache,
+                                       uint64_t *hits, uint64_t *misses)
+            __attribute__ ((nonnull));
+
+/* Same as crypto_sign_ed25519_verify_detached(), preparing pk only once */
+SODIUM_EXPORT
+int crypto_sign_ed25519_verify_detached_cached(crypto_sign_ed25519_pkcache *cache,
+                                               const unsigned char *sig,
+                                               const unsigned char *m,
+                                               unsigned long long mlen,
+                                               const unsigned char *pk)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull(1, 2, 5)));
+
+/*
+ * Verifies count detached signatures, faster than one at a time.
+ * Returns 0 if they are all valid. If results is not NULL, results[i]
+ * is set to 0 if the i-th signature is valid and to -1 otherwise.
+ * Every signature accepted by crypto_sign_ed25519_verify_detached() is
+ * accepted here. Signatures are checked in chunks of up to 256; in a chunk
+ * that doesn't pass as a whole, results[] holds what
+ * crypto_sign_ed25519_verify_detached() returns for each signature. A chunk
+ * with a signature that function rejects can only pass if that signature's
+ * R or public key has a small-order component, with probability at most 1/2.
+ */
+SODIUM_EXPORT
+int crypto_sign_ed25519_verify_detached_batch(const unsigned char * const *sigs,
+                                              const unsigned char * const *ms,
+                                              const unsigned long long *mlens,
+                                              const unsigned char * const *pks,
+                                              size_t count, int *results)
+            __attribute__ ((warn_unused_result)) __attribute__ ((nonnull(1, 2, 3, 4)));
+
 SODIUM_EXPORT
 int crypto_sign_ed25519_keypair(unsigned char *pk, unsigned char *sk)
             __attribute__ ((nonnull));
@@ -94,6 +196,11 @@ SODIUM_EXPORT
 int crypto_sign_ed25519_sk_to_pk(unsigned char *pk, const unsigned char *sk)
             __attribute__ ((nonnull));
 
+SODIUM_EXPORT
+int crypto_sign_ed25519_sk_to_expanded(unsigned char *esk,
+                                       const unsigned char *sk)
+            __attribute__ ((nonnull));
+
 SODIUM_EXPORT
 int crypto_sign_ed25519ph_init(crypto_sign_ed25519ph_state *state)
             __attribute__ ((nonnull));
@@ -244,6 +244,9 @@ xor_buf(unsigned char *out, const unsigned char *in, size_t n)
 # if _MSC_VER >= 1700 && defined(_M_X64)
 #  define HAVE_AVX2INTRIN_H 1
 # endif
+# if _MSC_VER >= 1900
+#  define HAVE_SHAINTRIN_H 1
+# endif
 #elif defined(HAVE_INTRIN_H)
 # include <intrin.h>
 #endif
@@ -77,8 +77,13 @@ void ge25519_tobytes(unsigned char *s, const ge25519_p2 *h);
 
 void ge25519_p3_tobytes(unsigned char *s, const ge25519_p3 *h);
 
+void ge25519_p3_tobytes_batch(unsigned char *s, const ge25519_p3 *h, size_t n);
+
 int ge25519_frombytes(ge25519_p3 *h, const unsigned char *s);
 
+int ge25519_frombytes_batch(ge25519_p3 *h, const unsigned char *s, size_t n,
+                            int *results);
+
 int ge25519_frombytes_negate_vartime(ge25519_p3 *h, const unsigned char *s);
 
 void ge25519_p3_to_cached(ge25519_cached *r, const ge25519_p3 *p);
@@ -93,6 +98,13 @@ void ge25519_sub(ge25519_p1p1 *r, const ge25519_p3 *p, const ge25519_cached *q);
 
 void ge25519_scalarmult_base(ge25519_p3 *h, const unsigned char *a);
 
+void ge25519_odd_multiples(ge25519_cached Ai[8], const ge25519_p3 *A);
+
+void ge25519_double_scalarmult_vartime_precomp(ge25519_p2 *r,
+                                               const unsigned char *a,
+                                               const ge25519_cached Ai[8],
+                                               const unsigned char *b);
+
 void ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
                                        const ge25519_p3 *A,
                                        const unsigned char *b);
@@ -100,6 +112,12 @@ void ge25519_double_scalarmult_vartime(ge25519_p2 *r, const unsigned char *a,
 void ge25519_scalarmult(ge25519_p3 *h, const unsigned char *a,
                         const ge25519_p3 *p);
 
+int ge25519_multi_scalarmult(ge25519_p3 *h, const unsigned char *a,
+                             const ge25519_p3 *A, size_t n);
+
+int ge25519_multi_scalarmult_vartime(ge25519_p3 *h, const unsigned char *a,
+                                     const ge25519_p3 *A, size_t n);
+
 int ge25519_is_canonical(const unsigned char *s);
 
 int ge25519_is_on_curve(const ge25519_p3 *p);
@@ -118,8 +136,14 @@ void ge25519_from_hash(unsigned char s[32], const unsigned char h[64]);
 
 int ristretto255_frombytes(ge25519_p3 *h, const unsigned char *s);
 
+int ristretto255_frombytes_batch(ge25519_p3 *h, const unsigned char *s,
+                                 size_t n, int *results);
+
 void ristretto255_p3_tobytes(unsigned char *s, const ge25519_p3 *h);
 
+void ristretto255_p3_tobytes_batch(unsigned char *s, const ge25519_p3 *h,
+                                   size_t n);
+
 void ristretto255_from_hash(unsigned char s[32], const unsigned char h[64]);
 
 /*
@@ -2,10 +2,28 @@
 #define implementations_H
 
 int _crypto_generichash_blake2b_pick_best_implementation(void);
+int _crypto_hash_sha256_pick_best_implementation(void);
+int _crypto_hash_sha512_pick_best_implementation(void);
 int _crypto_onetimeauth_poly1305_pick_best_implementation(void);
 int _crypto_pwhash_argon2_pick_best_implementation(void);
 int _crypto_scalarmult_curve25519_pick_best_implementation(void);
 int _crypto_stream_chacha20_pick_best_implementation(void);
 int _crypto_stream_salsa20_pick_best_implementation(void);
 
+/*
+ * Test hooks: make SHA-256/SHA-512, batches included, use one implementation,
+ * so that every compiled path can be checked on a host that would pick
+ * another. They aren't exported: the tests calling them link statically.
+ * They return -1, changing nothing, when the implementation isn't
+ * compiled in or the CPU lacks it. _IMPL_BEST restores the sodium_init() pick.
+ */
+#define CRYPTO_HASH_IMPL_BEST  0
+#define CRYPTO_HASH_IMPL_REF   1
+#define CRYPTO_HASH_IMPL_SHANI 2 /* SHA-256 only */
+#define CRYPTO_HASH_IMPL_AVX2  3 /* portable transform, AVX2 batches */
+
+int _crypto_hash_sha256_set_implementation(int impl);
+
+int _crypto_hash_sha512_set_implementation(int impl);
+
 #endif
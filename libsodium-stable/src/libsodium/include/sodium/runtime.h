@@ -32,6 +32,9 @@ int sodium_runtime_has_avx2(void);
 SODIUM_EXPORT_WEAK
 int sodium_runtime_has_avx512f(void);
 
+SODIUM_EXPORT_WEAK
+int sodium_runtime_has_shani(void);
+
 SODIUM_EXPORT_WEAK
 int sodium_runtime_has_pclmul(void);
 
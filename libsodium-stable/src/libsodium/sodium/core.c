@@ -41,6 +41,8 @@ sodium_init(void)
     _sodium_alloc_init();
     _crypto_pwhash_argon2_pick_best_implementation();
     _crypto_generichash_blake2b_pick_best_implementation();
+    _crypto_hash_sha256_pick_best_implementation();
+    _crypto_hash_sha512_pick_best_implementation();
     _crypto_onetimeauth_poly1305_pick_best_implementation();
     _crypto_scalarmult_curve25519_pick_best_implementation();
     _crypto_stream_chacha20_pick_best_implementation();
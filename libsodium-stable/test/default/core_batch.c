@@ -0,0 +1,110 @@
+
+#define TEST_NAME "core_batch"
+#include "cmptest.h"
+
+#define MAX_COUNT 100U
+
+static unsigned char ns[MAX_COUNT * 32];
+static unsigned char ps[MAX_COUNT * 32];
+static unsigned char qs[MAX_COUNT * 32];
+static int           results[MAX_COUNT];
+
+static void
+check_base(size_t count)
+{
+    unsigned char q[32];
+    size_t        i;
+
+    memset(qs, 0, sizeof qs);
+    assert(crypto_scalarmult_ristretto255_base_batch(qs, ns, count) == 0);
+    for (i = 0; i < count; i++) {
+        assert(crypto_scalarmult_ristretto255_base(q, &ns[i * 32]) == 0);
+        assert(memcmp(q, &qs[i * 32], 32) == 0);
+    }
+    memset(qs, 0, sizeof qs);
+    assert(crypto_scalarmult_ed25519_base_batch(qs, ns, count) == 0);
+    for (i = 0; i < count; i++) {
+        assert(crypto_scalarmult_ed25519_base(q, &ns[i * 32]) == 0);
+        assert(memcmp(q, &qs[i * 32], 32) == 0);
+    }
+    memset(qs, 0, sizeof qs);
+    assert(crypto_scalarmult_ed25519_base_noclamp_batch(qs, ns, count) == 0);
+    for (i = 0; i < count; i++) {
+        assert(crypto_scalarmult_ed25519_base_noclamp(q, &ns[i * 32]) == 0);
+        assert(memcmp(q, &qs[i * 32], 32) == 0);
+    }
+}
+
+static size_t
+check_valid(size_t count)
+{
+    size_t i;
+    size_t invalid = 0;
+    int    ret;
+
+    memset(results, 0x42, sizeof results);
+    ret = crypto_core_ristretto255_is_valid_point_batch(ps, count, results);
+    for (i = 0; i < count; i++) {
+        assert(results[i] == crypto_core_ristretto255_is_valid_point(&ps[i * 32]));
+        invalid += results[i] == 0;
+    }
+    assert(ret == (invalid == 0));
+    assert(crypto_core_ristretto255_is_valid_point_batch(ps, count, NULL) == ret);
+
+    return invalid;
+}
+
+int
+main(void)
+{
+    size_t count;
+    size_t i;
+
+    for (i = 0; i < MAX_COUNT; i++) {
+        crypto_core_ristretto255_scalar_random(&ns[i * 32]);
+        crypto_core_ristretto255_random(&ps[i * 32]);
+    }
+    for (count = 0; count <= 70; count++) {
+        check_base(count);
+        assert(check_valid(count) == 0);
+    }
+    check_base(MAX_COUNT);
+    assert(check_valid(MAX_COUNT) == 0);
+    printf("valid: OK\n");
+
+    /* the top bit is ignored, as with the single-point functions */
+    for (i = 0; i < MAX_COUNT; i++) {
+        ns[i * 32 + 31] |= 0x80;
+    }
+    check_base(MAX_COUNT);
+
+    /* a zero scalar anywhere is reported, the other results are still set */
+    memset(&ns[40 * 32], 0, 32);
+    memset(qs, 0xff, sizeof qs);
+    assert(crypto_scalarmult_ristretto255_base_batch(qs, ns, MAX_COUNT) == -1);
+    assert(sodium_is_zero(&qs[40 * 32], 32));
+    assert(crypto_scalarmult_ed25519_base_noclamp_batch(qs, ns, MAX_COUNT) == -1);
+    assert(crypto_scalarmult_ed25519_base_batch(qs, ns, MAX_COUNT) == -1);
+    assert(crypto_scalarmult_ed25519_base_noclamp(&qs[41 * 32], &ns[41 * 32]) == 0);
+    assert(crypto_scalarmult_ristretto255_base_batch(qs, ns, 40) == 0);
+    printf("identity: OK\n");
+
+    /* non-canonical, negative, non-square and random encodings */
+    memset(&ps[3 * 32], 0xff, 32);
+    ps[3 * 32 + 31] = 0x7f;
+    ps[10 * 32] |= 1;
+    ps[11 * 32 + 31] |= 0x80;
+    for (i = 50; i < MAX_COUNT; i++) {
+        randombytes_buf(&ps[i * 32], 32);
+        ps[i * 32] &= 0xfe;
+        ps[i * 32 + 31] &= 0x7f;
+    }
+    assert(check_valid(1) == 0);
+    assert(check_valid(4) == 1);
+    printf("invalid: %u\n", (unsigned int) check_valid(12));
+    assert(check_valid(MAX_COUNT) >= 3);
+
+    printf("OK\n");
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+
+#define TEST_NAME "hash4"
+#include "cmptest.h"
+
+#include "private/implementations.h"
+
+#define SHORT_COUNT 130U
+#define LENS_COUNT  5U
+
+static const size_t  lens[LENS_COUNT] = { 200, 511, 512, 513, 1000 };
+static unsigned char m[1000];
+static unsigned char a[1000];
+static unsigned char h[SHORT_COUNT + LENS_COUNT + 1][crypto_hash_sha256_BYTES];
+static unsigned char h2[SHORT_COUNT + LENS_COUNT + 1][crypto_hash_sha256_BYTES];
+static unsigned char c[crypto_hash_sha256_BYTES];
+static char          hex[crypto_hash_sha256_BYTES * 2 + 1];
+
+static void
+hash_chunked(unsigned char *out, const unsigned char *in, size_t inlen,
+             size_t chunk)
+{
+    crypto_hash_sha256_state st;
+    size_t                   i;
+    size_t                   len;
+
+    crypto_hash_sha256_init(&st);
+    for (i = 0; i < inlen; i += len) {
+        len = inlen - i < chunk ? inlen - i : chunk;
+        crypto_hash_sha256_update(&st, in + i, len);
+    }
+    crypto_hash_sha256_final(&st, out);
+}
+
+static void
+hash_all(unsigned char out[][crypto_hash_sha256_BYTES])
+{
+    crypto_hash_sha256_state st;
+    size_t                   i;
+
+    for (i = 0; i < SHORT_COUNT; i++) {
+        crypto_hash_sha256(out[i], m, i);
+        hash_chunked(c, m, i, i % 13 + 1);
+        assert(memcmp(out[i], c, sizeof c) == 0);
+    }
+    for (i = 0; i < LENS_COUNT; i++) {
+        crypto_hash_sha256(out[SHORT_COUNT + i], m, lens[i]);
+        hash_chunked(c, m, lens[i], 64);
+        assert(memcmp(out[SHORT_COUNT + i], c, sizeof c) == 0);
+        hash_chunked(c, m, lens[i], 191);
+        assert(memcmp(out[SHORT_COUNT + i], c, sizeof c) == 0);
+    }
+
+    /* FIPS 180-2: one million repetitions of "a" */
+    crypto_hash_sha256_init(&st);
+    for (i = 0; i < 1000; i++) {
+        crypto_hash_sha256_update(&st, a, sizeof a);
+    }
+    crypto_hash_sha256_final(&st, out[SHORT_COUNT + LENS_COUNT]);
+}
+
+int
+main(void)
+{
+    static const int impls[] = { CRYPTO_HASH_IMPL_REF, CRYPTO_HASH_IMPL_SHANI,
+                                 CRYPTO_HASH_IMPL_AVX2 };
+    size_t           i;
+
+    for (i = 0; i < sizeof m; i++) {
+        m[i] = (unsigned char) (i * 7 + 3);
+    }
+    memset(a, 'a', sizeof a);
+
+    hash_all(h);
+    for (i = 0; i < SHORT_COUNT; i++) {
+        printf("%u %s\n", (unsigned int) i,
+               sodium_bin2hex(hex, sizeof hex, h[i], sizeof h[i]));
+    }
+    for (i = 0; i < LENS_COUNT; i++) {
+        printf("%u %s\n", (unsigned int) lens[i],
+               sodium_bin2hex(hex, sizeof hex, h[SHORT_COUNT + i],
+                              sizeof h[SHORT_COUNT + i]));
+    }
+    printf("%s\n", sodium_bin2hex(hex, sizeof hex, h[SHORT_COUNT + LENS_COUNT],
+                                  sizeof h[SHORT_COUNT + LENS_COUNT]));
+
+    /* Every transform this host can run, whichever sodium_init() picked */
+    for (i = 0; i < sizeof impls / sizeof impls[0]; i++) {
+        if (_crypto_hash_sha256_set_implementation(impls[i]) != 0) {
+            assert(impls[i] != CRYPTO_HASH_IMPL_REF);
+            continue;
+        }
+        memset(h2, 0, sizeof h2);
+        hash_all(h2);
+        assert(memcmp(h, h2, sizeof h) == 0);
+    }
+    assert(_crypto_hash_sha256_set_implementation(-1) == -1);
+    assert(_crypto_hash_sha256_set_implementation(CRYPTO_HASH_IMPL_BEST) == 0);
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+
+#define TEST_NAME "hash5"
+#include "cmptest.h"
+
+#include "private/implementations.h"
+
+#define MAX_COUNT 20U
+
+static unsigned char      m[MAX_COUNT][300];
+static const unsigned char *in[MAX_COUNT];
+static unsigned long long inlen[MAX_COUNT];
+static unsigned char      h256[MAX_COUNT * crypto_hash_sha256_BYTES];
+static unsigned char      h512[MAX_COUNT * crypto_hash_sha512_BYTES];
+static unsigned char      kat256[MAX_COUNT * crypto_hash_sha256_BYTES];
+static unsigned char      kat512[MAX_COUNT * crypto_hash_sha512_BYTES];
+static unsigned char      h[crypto_hash_sha512_BYTES];
+static char               hex[crypto_hash_sha512_BYTES * 2 + 1];
+
+static void
+check_batch(size_t count)
+{
+    size_t i;
+
+    memset(h256, 0, sizeof h256);
+    memset(h512, 0, sizeof h512);
+    assert(crypto_hash_sha256_batch(h256, in, inlen, count) == 0);
+    assert(crypto_hash_sha512_batch(h512, in, inlen, count) == 0);
+    for (i = 0; i < count; i++) {
+        crypto_hash_sha256(h, in[i], inlen[i]);
+        assert(memcmp(h, h256 + i * crypto_hash_sha256_BYTES,
+                      crypto_hash_sha256_BYTES) == 0);
+        crypto_hash_sha512(h, in[i], inlen[i]);
+        assert(memcmp(h, h512 + i * crypto_hash_sha512_BYTES,
+                      crypto_hash_sha512_BYTES) == 0);
+    }
+}
+
+static void
+check_batches(void)
+{
+    size_t count;
+    size_t i;
+    size_t j;
+
+    /* Messages of the same length, then of lengths that end in different
+     * blocks, around the padding boundaries of both hash functions */
+    for (count = 1; count <= MAX_COUNT; count++) {
+        for (i = 0; i < count; i++) {
+            inlen[i] = 64;
+        }
+        check_batch(count);
+        for (i = 0; i < count; i++) {
+            inlen[i] = (unsigned long long) ((i * 37 + count * 13) % 300);
+        }
+        check_batch(count);
+    }
+    for (j = 0; j < 300; j++) {
+        for (i = 0; i < 9; i++) {
+            inlen[i] = (unsigned long long) ((j + i * 41) % 300);
+        }
+        check_batch(9);
+    }
+}
+
+int
+main(void)
+{
+    static const int impls[] = { CRYPTO_HASH_IMPL_REF, CRYPTO_HASH_IMPL_SHANI,
+                                 CRYPTO_HASH_IMPL_AVX2 };
+    size_t           i;
+    size_t           j;
+    int              ok256;
+    int              ok512;
+
+    for (i = 0; i < MAX_COUNT; i++) {
+        for (j = 0; j < sizeof m[i]; j++) {
+            m[i][j] = (unsigned char) (i * 31 + j * 7 + 3);
+        }
+        in[i] = m[i];
+    }
+
+    check_batches();
+    for (i = 0; i < MAX_COUNT; i++) {
+        inlen[i] = (unsigned long long) (i * 15);
+    }
+    crypto_hash_sha256_batch(h256, in, inlen, MAX_COUNT);
+    crypto_hash_sha512_batch(h512, in, inlen, MAX_COUNT);
+    for (i = 0; i < MAX_COUNT; i += 6) {
+        printf("%u %s\n", (unsigned int) inlen[i],
+               sodium_bin2hex(hex, sizeof hex,
+                              h256 + i * crypto_hash_sha256_BYTES,
+                              crypto_hash_sha256_BYTES));
+        printf("%u %s\n", (unsigned int) inlen[i],
+               sodium_bin2hex(hex, sizeof hex,
+                              h512 + i * crypto_hash_sha512_BYTES,
+                              crypto_hash_sha512_BYTES));
+    }
+    memcpy(kat256, h256, sizeof kat256);
+    memcpy(kat512, h512, sizeof kat512);
+
+    /* Every batch path this host can run, whichever sodium_init() picked,
+     * must give the same digests */
+    for (i = 0; i < sizeof impls / sizeof impls[0]; i++) {
+        ok256 = _crypto_hash_sha256_set_implementation(impls[i]) == 0;
+        ok512 = _crypto_hash_sha512_set_implementation(impls[i]) == 0;
+        assert((ok256 && ok512) || impls[i] != CRYPTO_HASH_IMPL_REF);
+        if (!ok256 && !ok512) {
+            continue;
+        }
+        check_batches();
+        for (j = 0; j < MAX_COUNT; j++) {
+            inlen[j] = (unsigned long long) (j * 15);
+        }
+        crypto_hash_sha256_batch(h256, in, inlen, MAX_COUNT);
+        crypto_hash_sha512_batch(h512, in, inlen, MAX_COUNT);
+        assert(memcmp(h256, kat256, sizeof kat256) == 0);
+        assert(memcmp(h512, kat512, sizeof kat512) == 0);
+    }
+    assert(_crypto_hash_sha256_set_implementation(CRYPTO_HASH_IMPL_BEST) == 0);
+    assert(_crypto_hash_sha512_set_implementation(CRYPTO_HASH_IMPL_BEST) == 0);
+
+    assert(crypto_hash_sha256_batch(h256, in, inlen, 0U) == 0);
+    assert(crypto_hash_sha512_batch(h512, in, inlen, 0U) == 0);
+
+    printf("OK\n");
+
+    return 0;
+}
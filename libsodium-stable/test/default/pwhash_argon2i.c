@@ -395,6 +395,64 @@ str_tests(void)
     sodium_free(str_out2);
 }
 
+static void
+parallel_tests(void)
+{
+    char          str[crypto_pwhash_argon2i_STRBYTES];
+    unsigned char out1[32];
+    unsigned char out4[32];
+    unsigned char out4b[32];
+    unsigned char salt[crypto_pwhash_argon2i_SALTBYTES];
+    const char   *passwd = "Correct Horse Battery Staple";
+    unsigned int  parallelism;
+
+    memset(salt, 0x42, sizeof salt);
+    assert(crypto_pwhash_argon2i(out1, sizeof out1, passwd, strlen(passwd),
+                              salt, 3, 1U << 20,
+                              crypto_pwhash_argon2i_ALG_ARGON2I13) == 0);
+    assert(crypto_pwhash_argon2i_parallel(out4, sizeof out4, passwd,
+                                       strlen(passwd), salt, 3, 1U << 20, 1U,
+                                       crypto_pwhash_argon2i_ALG_ARGON2I13) == 0);
+    assert(memcmp(out1, out4, sizeof out1) == 0);
+    assert(crypto_pwhash_argon2i_parallel(out4, sizeof out4, passwd,
+                                       strlen(passwd), salt, 3, 1U << 20, 4U,
+                                       crypto_pwhash_argon2i_ALG_ARGON2I13) == 0);
+    assert(crypto_pwhash_argon2i_parallel(out4b, sizeof out4b, passwd,
+                                       strlen(passwd), salt, 3, 1U << 20, 4U,
+                                       crypto_pwhash_argon2i_ALG_ARGON2I13) == 0);
+    assert(memcmp(out4, out4b, sizeof out4) == 0);
+    assert(memcmp(out1, out4, sizeof out1) != 0);
+
+    for (parallelism = 1U; parallelism <= 8U; parallelism *= 2U) {
+        assert(crypto_pwhash_argon2i_str_parallel(str, passwd, strlen(passwd),
+                                               3, 1U << 20, parallelism) == 0);
+        assert(crypto_pwhash_argon2i_str_verify(str, passwd,
+                                             strlen(passwd)) == 0);
+        assert(crypto_pwhash_argon2i_str_verify(str, passwd,
+                                             strlen(passwd) - 1U) == -1);
+    }
+    /* More lanes than fill threads: the lanes get spread over the threads */
+    assert(crypto_pwhash_argon2i_str_parallel(str, passwd, strlen(passwd), 3,
+                                           4U << 20, 255U) == 0);
+    assert(strstr(str, ",p=255$") != NULL);
+    assert(crypto_pwhash_argon2i_str_verify(str, passwd, strlen(passwd)) == 0);
+    assert(crypto_pwhash_argon2i_str_parallel(str, passwd, strlen(passwd), 3,
+                                           1U << 20, 0U) == -1);
+    assert(crypto_pwhash_argon2i_str_parallel(str, passwd, strlen(passwd), 3,
+                                           1U << 20, 256U) == -1);
+    assert(crypto_pwhash_argon2i_str_parallel(str, passwd, strlen(passwd), 3,
+                                           crypto_pwhash_argon2i_MEMLIMIT_MIN,
+                                           2U) == -1);
+    assert(crypto_pwhash_argon2i_parallel(out4, sizeof out4, passwd,
+                                       strlen(passwd), salt, 3, 1U << 20, 0U,
+                                       crypto_pwhash_argon2i_ALG_ARGON2I13) == -1);
+    assert(crypto_pwhash_argon2i_parallelism_min() ==
+           crypto_pwhash_argon2i_PARALLELISM_MIN);
+    assert(crypto_pwhash_argon2i_parallelism_max() ==
+           crypto_pwhash_argon2i_PARALLELISM_MAX);
+    printf("parallel_tests: OK\n");
+}
+
 int
 main(void)
 {
@@ -402,6 +460,7 @@ main(void)
     tv2();
     tv3();
     str_tests();
+    parallel_tests();
 
     assert(crypto_pwhash_argon2i_bytes_min() > 0U);
     assert(crypto_pwhash_argon2i_bytes_max() > crypto_pwhash_argon2i_bytes_min());
@@ -0,0 +1,91 @@
+
+#define TEST_NAME "scalarmult9"
+#include "cmptest.h"
+
+#define MAX_COUNT 100U
+
+static unsigned char ns[MAX_COUNT][crypto_scalarmult_curve25519_SCALARBYTES];
+static unsigned char ps[MAX_COUNT][crypto_scalarmult_curve25519_BYTES];
+static unsigned char qs[MAX_COUNT][crypto_scalarmult_curve25519_BYTES];
+static unsigned char q[crypto_scalarmult_curve25519_BYTES];
+static char          hex[crypto_scalarmult_curve25519_BYTES * 2 + 1];
+
+static void
+check_batch(size_t count, int expected)
+{
+    size_t i;
+    int    ret;
+
+    memset(qs, 0x42, sizeof qs);
+    assert(crypto_scalarmult_curve25519_batch(qs[0], ns[0], ps[0], count) ==
+           expected);
+    for (i = 0; i < count; i++) {
+        ret = crypto_scalarmult_curve25519(q, ns[i], ps[i]);
+        if (ret != 0) {
+            memset(q, 0, sizeof q);
+        }
+        assert(memcmp(q, qs[i], sizeof q) == 0);
+    }
+}
+
+int
+main(void)
+{
+    /* RFC 7748, section 5.2 */
+    static const unsigned char rfc_n[32] = {
+        0xa5, 0x46, 0xe3, 0x6b, 0xf0, 0x52, 0x7c, 0x9d, 0x3b, 0x16, 0x15,
+        0x4b, 0x82, 0x46, 0x5e, 0xdd, 0x62, 0x14, 0x4c, 0x0a, 0xc1, 0xfc,
+        0x5a, 0x18, 0x50, 0x6a, 0x22, 0x44, 0xba, 0x44, 0x9a, 0xc4
+    };
+    static const unsigned char rfc_p[32] = {
+        0xe6, 0xdb, 0x68, 0x67, 0x58, 0x30, 0x30, 0xdb, 0x35, 0x94, 0xc1,
+        0xa4, 0x24, 0xb1, 0x5f, 0x7c, 0x72, 0x66, 0x24, 0xec, 0x26, 0xb3,
+        0x35, 0x3b, 0x10, 0xa9, 0x03, 0xa6, 0xd0, 0xab, 0x1c, 0x4c
+    };
+    size_t count;
+    size_t i;
+
+    for (i = 0; i < MAX_COUNT; i++) {
+        crypto_box_keypair(ps[i], ns[i]);
+        randombytes_buf(ns[i], sizeof ns[i]);
+    }
+    for (count = 0; count <= 12; count++) {
+        check_batch(count, 0);
+    }
+    check_batch(MAX_COUNT, 0);
+    printf("random: OK\n");
+
+    /* the top bit of a point is ignored, p + 9 is the base point, and
+     * p + 1 is of order 1 */
+    ps[1][31] |= 0x80;
+    memset(ps[6], 0xff, sizeof ps[6]);
+    ps[6][0] = 0xf6;
+    check_batch(9, 0);
+    crypto_scalarmult_curve25519_base(q, ns[6]);
+    assert(memcmp(q, qs[6], sizeof q) == 0);
+    ps[6][0] = 0xee;
+    check_batch(9, -1);
+    ps[6][0] = 0xf6;
+    printf("non-canonical points: OK\n");
+
+    /* small order points don't affect the other results */
+    memset(ps[2], 0, sizeof ps[2]);
+    check_batch(8, -1);
+    check_batch(2, 0);
+    check_batch(3, -1);
+    printf("small order: OK\n");
+
+    for (i = 0; i < 5; i++) {
+        memcpy(ns[i], rfc_n, sizeof rfc_n);
+        memcpy(ps[i], rfc_p, sizeof rfc_p);
+    }
+    check_batch(5, 0);
+    for (i = 1; i < 5; i++) {
+        assert(memcmp(qs[i], qs[0], sizeof qs[0]) == 0);
+    }
+    printf("%s\n", sodium_bin2hex(hex, sizeof hex, qs[0], sizeof qs[0]));
+
+    printf("OK\n");
+
+    return 0;
+}
@@ -23,6 +23,7 @@ int
 main(void)
 {
     unsigned char *n, *p, *q, *q2;
+    int            i;
 
     n = (unsigned char *) sodium_malloc(crypto_scalarmult_ed25519_SCALARBYTES);
     p = (unsigned char *) sodium_malloc(crypto_scalarmult_ed25519_BYTES);
@@ -41,6 +42,18 @@ main(void)
         printf("crypto_scalarmult_ed25519_base(n) != crypto_scalarmult_ed25519(n, 9)\n");
     }
 
+    for (i = 1; i < 256; i++) {
+        memset(n, i, crypto_scalarmult_ed25519_SCALARBYTES);
+        n[31] &= 0x7f;
+        if (crypto_scalarmult_ed25519_base_noclamp(q, n) != 0 ||
+            crypto_scalarmult_ed25519_noclamp(q2, n, p) != 0) {
+            printf("crypto_scalarmult_ed25519_noclamp() failed\n");
+        }
+        if (memcmp(q, q2, crypto_scalarmult_ed25519_BYTES) != 0) {
+            printf("crypto_scalarmult_ed25519_base_noclamp(%d) != crypto_scalarmult_ed25519_noclamp(%d, 9)\n", i, i);
+        }
+    }
+
     memset(n, 0, crypto_scalarmult_ed25519_SCALARBYTES);
     if (crypto_scalarmult_ed25519_base(q, n) != -1) {
         printf("crypto_scalarmult_ed25519_base(0) passed\n");
@@ -0,0 +1,125 @@
+
+#define TEST_NAME "scalarmult_multi"
+#include "cmptest.h"
+
+#define MAX_COUNT 300U
+
+static unsigned char ns[MAX_COUNT * 32];
+static unsigned char rps[MAX_COUNT * 32];
+static unsigned char eps[MAX_COUNT * 32];
+
+static void
+check_ristretto255(size_t count)
+{
+    unsigned char q[crypto_scalarmult_ristretto255_BYTES];
+    unsigned char q2[crypto_scalarmult_ristretto255_BYTES];
+    unsigned char r[crypto_scalarmult_ristretto255_BYTES];
+    unsigned char t[crypto_scalarmult_ristretto255_BYTES];
+    size_t        i;
+
+    assert(crypto_scalarmult_ristretto255(r, ns, rps) == 0);
+    for (i = 1; i < count; i++) {
+        assert(crypto_scalarmult_ristretto255(t, &ns[i * 32], &rps[i * 32]) == 0);
+        assert(crypto_core_ristretto255_add(r, r, t) == 0);
+    }
+    assert(crypto_scalarmult_ristretto255_multi(q, ns, rps, count) == 0);
+    assert(crypto_scalarmult_ristretto255_multi_vartime(q2, ns, rps, count) == 0);
+    assert(memcmp(q, r, sizeof r) == 0);
+    assert(memcmp(q2, r, sizeof r) == 0);
+}
+
+static void
+check_ed25519(size_t count)
+{
+    unsigned char q[crypto_scalarmult_ed25519_BYTES];
+    unsigned char q2[crypto_scalarmult_ed25519_BYTES];
+    unsigned char r[crypto_scalarmult_ed25519_BYTES];
+    unsigned char t[crypto_scalarmult_ed25519_BYTES];
+    size_t        i;
+
+    assert(crypto_scalarmult_ed25519_noclamp(r, ns, eps) == 0);
+    for (i = 1; i < count; i++) {
+        assert(crypto_scalarmult_ed25519_noclamp(t, &ns[i * 32], &eps[i * 32]) == 0);
+        assert(crypto_core_ed25519_add(r, r, t) == 0);
+    }
+    assert(crypto_scalarmult_ed25519_multi_noclamp(q, ns, eps, count) == 0);
+    assert(crypto_scalarmult_ed25519_multi_noclamp_vartime(q2, ns, eps, count) == 0);
+    assert(memcmp(q, r, sizeof r) == 0);
+    assert(memcmp(q2, r, sizeof r) == 0);
+}
+
+int
+main(void)
+{
+    unsigned char q[crypto_scalarmult_ristretto255_BYTES];
+    unsigned char saved[32];
+    size_t        count;
+    size_t        i;
+
+    for (i = 0; i < MAX_COUNT; i++) {
+        crypto_core_ristretto255_scalar_random(&ns[i * 32]);
+        crypto_core_ristretto255_random(&rps[i * 32]);
+        crypto_core_ed25519_random(&eps[i * 32]);
+    }
+    for (count = 1; count <= 70; count++) {
+        check_ristretto255(count);
+        check_ed25519(count);
+    }
+    check_ristretto255(100);
+    check_ed25519(100);
+    check_ristretto255(MAX_COUNT);
+    check_ed25519(MAX_COUNT);
+    printf("random: OK\n");
+
+    /* scalars of any size, and digits that don't fit in a sliding window */
+    for (i = 0; i < MAX_COUNT * 32; i++) {
+        ns[i] = (unsigned char) (i % 7 == 0 ? 0xff : i * 13);
+    }
+    memset(ns, 0xff, 64);
+    for (count = 1; count <= 70; count += 13) {
+        check_ristretto255(count);
+        check_ed25519(count);
+    }
+    check_ristretto255(MAX_COUNT);
+    check_ed25519(MAX_COUNT);
+    printf("large scalars: OK\n");
+
+    /* n * p + (-n) * p is the identity */
+    memcpy(&rps[32], rps, 32);
+    memcpy(&eps[32], eps, 32);
+    crypto_core_ristretto255_scalar_random(ns);
+    crypto_core_ristretto255_scalar_negate(&ns[32], ns);
+    assert(crypto_scalarmult_ristretto255_multi(q, ns, rps, 2) == -1);
+    assert(crypto_scalarmult_ristretto255_multi_vartime(q, ns, rps, 2) == -1);
+    assert(crypto_scalarmult_ed25519_multi_noclamp(q, ns, eps, 2) == -1);
+    assert(crypto_scalarmult_ed25519_multi_noclamp_vartime(q, ns, eps, 2) == -1);
+    memset(ns, 0, 32);
+    assert(crypto_scalarmult_ristretto255_multi(q, ns, rps, 1) == -1);
+    assert(crypto_scalarmult_ed25519_multi_noclamp_vartime(q, ns, eps, 1) == -1);
+    printf("identity: OK\n");
+
+    /* an invalid point anywhere fails the whole computation */
+    crypto_core_ristretto255_scalar_random(ns);
+    memcpy(saved, &rps[50 * 32], 32);
+    memset(&rps[50 * 32], 0xff, 32);
+    assert(crypto_scalarmult_ristretto255_multi(q, ns, rps, 100) == -1);
+    assert(crypto_scalarmult_ristretto255_multi_vartime(q, ns, rps, 100) == -1);
+    memcpy(&rps[50 * 32], saved, 32);
+    memcpy(saved, &eps[7 * 32], 32);
+    memset(&eps[7 * 32], 0, 32);
+    eps[7 * 32] = 1; /* (0, 1), of small order */
+    assert(crypto_scalarmult_ed25519_multi_noclamp(q, ns, eps, 10) == -1);
+    assert(crypto_scalarmult_ed25519_multi_noclamp_vartime(q, ns, eps, 10) == -1);
+    memcpy(&eps[7 * 32], saved, 32);
+    assert(crypto_scalarmult_ed25519_multi_noclamp(q, ns, eps, 10) == 0);
+    printf("invalid points: OK\n");
+
+    assert(crypto_scalarmult_ristretto255_multi(q, ns, rps, 0U) == -1);
+    assert(crypto_scalarmult_ristretto255_multi_vartime(q, ns, rps, 0U) == -1);
+    assert(crypto_scalarmult_ed25519_multi_noclamp(q, ns, eps, 0U) == -1);
+    assert(crypto_scalarmult_ed25519_multi_noclamp_vartime(q, ns, eps, 0U) == -1);
+
+    printf("OK\n");
+
+    return 0;
+}
@@ -1066,6 +1066,7 @@ int main(void)
     unsigned char      sm[1024 + crypto_sign_BYTES];
     unsigned char      m[1024];
     unsigned char      skpk[crypto_sign_SECRETKEYBYTES];
+    unsigned char      esk[crypto_sign_ed25519_EXPANDEDSECRETKEYBYTES];
     unsigned char      pk[crypto_sign_PUBLICKEYBYTES];
     unsigned char      sk[crypto_sign_SECRETKEYBYTES];
     char               sig_hex[crypto_sign_BYTES * 2 + 1];
@@ -1147,6 +1148,18 @@ int main(void)
             printf("detached signature verification failed: [%u]\n", i);
             continue;
         }
+        crypto_sign_ed25519_sk_to_expanded(esk, skpk);
+        memset(sig, 0, sizeof sig);
+        if (crypto_sign_ed25519_expanded_detached(
+                sig, &siglen, (const unsigned char *)test_data[i].m, i, esk)
+            != 0 || siglen != crypto_sign_BYTES) {
+            printf("expanded detached signature failed: [%u]\n", i);
+            continue;
+        }
+        if (memcmp(test_data[i].sig, sig, crypto_sign_BYTES) != 0) {
+            printf("expanded detached signature failure: [%u]\n", i);
+            continue;
+        }
     }
     printf("%u tests\n", i);
 
@@ -1162,6 +1175,15 @@ int main(void)
     if (memcmp(test_data[i].m, sm, (size_t)mlen) != 0) {
         printf("crypto_sign_open() with overlap failed (content)\n");
     }
+    if (crypto_sign_ed25519_expanded(sm, &smlen, sm, i, esk) != 0 ||
+        smlen != i + crypto_sign_BYTES ||
+        memcmp(test_data[i].sig, sm, crypto_sign_BYTES) != 0) {
+        printf("crypto_sign_ed25519_expanded() with overlap failed\n");
+    }
+    if (crypto_sign_open(sm, &mlen, sm, smlen, test_data[i].pk) != 0 ||
+        memcmp(test_data[i].m, sm, (size_t)mlen) != 0) {
+        printf("crypto_sign_ed25519_expanded() output doesn't verify\n");
+    }
 
     for (j = 1U; j < 8U; j++) {
         sig[63] ^= (j << 5);
@@ -1315,6 +1337,8 @@ int main(void)
     assert(crypto_sign_secretkeybytes()
            == crypto_sign_ed25519_secretkeybytes());
     assert(crypto_sign_statebytes() == crypto_sign_ed25519ph_statebytes());
+    assert(crypto_sign_ed25519_expandedsecretkeybytes()
+           == crypto_sign_ed25519_EXPANDEDSECRETKEYBYTES);
 
 #ifdef ED25519_NONDETERMINISTIC
     exit(0);
@@ -0,0 +1,167 @@
+
+#define TEST_NAME "sign2"
+#include "cmptest.h"
+
+#define COUNT 300U
+
+static unsigned char       pks[COUNT][crypto_sign_PUBLICKEYBYTES];
+static unsigned char       sigs[COUNT][crypto_sign_BYTES];
+static unsigned char       ms[COUNT][100];
+static const unsigned char *sigs_p[COUNT];
+static const unsigned char *ms_p[COUNT];
+static const unsigned char *pks_p[COUNT];
+static unsigned long long  mlens[COUNT];
+static int                 results[COUNT];
+
+static size_t
+count_invalid(size_t count)
+{
+    size_t i;
+    size_t invalid = 0;
+
+    for (i = 0; i < count; i++) {
+        assert(results[i] == 0 || results[i] == -1);
+        assert(results[i] == crypto_sign_verify_detached(sigs_p[i], ms_p[i],
+                                                         mlens[i], pks_p[i]));
+        invalid += results[i] != 0;
+    }
+    return invalid;
+}
+
+static int
+verify_batch(size_t count)
+{
+    memset(results, 0x42, sizeof results);
+
+    return crypto_sign_ed25519_verify_detached_batch(sigs_p, ms_p, mlens, pks_p,
+                                                     count, results);
+}
+
+/* A signature whose R has an order-8 component is rejected by
+ * crypto_sign_verify_detached(). The batch equation only misses it when the
+ * coefficient cancels that component, and a chunk that fails reports it
+ * rejected, like crypto_sign_verify_detached() does */
+static void
+mixed_order_r(void)
+{
+    static const unsigned char t8[32] = {
+        0xc7, 0x17, 0x6a, 0x70, 0x3d, 0x4d, 0xd8, 0x4f, 0xba, 0x3c, 0x0b,
+        0x76, 0x0d, 0x10, 0x67, 0x0f, 0x2a, 0x20, 0x53, 0xfa, 0x2c, 0x39,
+        0xcc, 0xc6, 0x4e, 0xc7, 0xfd, 0x77, 0x92, 0xac, 0x03, 0x7a
+    };
+    crypto_hash_sha512_state hs;
+    unsigned char            a[crypto_core_ed25519_SCALARBYTES];
+    unsigned char            r[crypto_core_ed25519_SCALARBYTES];
+    unsigned char            hram[crypto_core_ed25519_NONREDUCEDSCALARBYTES];
+    size_t                   i;
+
+    crypto_core_ed25519_scalar_random(a);
+    assert(crypto_scalarmult_ed25519_base_noclamp(pks[0], a) == 0);
+    crypto_core_ed25519_scalar_random(r);
+    assert(crypto_scalarmult_ed25519_base_noclamp(sigs[0], r) == 0);
+    assert(crypto_core_ed25519_add(sigs[0], sigs[0], t8) == 0);
+    crypto_hash_sha512_init(&hs);
+    crypto_hash_sha512_update(&hs, sigs[0], 32);
+    crypto_hash_sha512_update(&hs, pks[0], 32);
+    crypto_hash_sha512_update(&hs, ms[0], mlens[0]);
+    crypto_hash_sha512_final(&hs, hram);
+    crypto_core_ed25519_scalar_reduce(hram, hram);
+    crypto_core_ed25519_scalar_mul(sigs[0] + 32, hram, a);
+    crypto_core_ed25519_scalar_add(sigs[0] + 32, sigs[0] + 32, r);
+
+    assert(crypto_sign_verify_detached(sigs[0], ms[0], mlens[0], pks[0]) == -1);
+    for (i = 0; i < 64; i++) {
+        if (verify_batch(1) != 0) {
+            assert(results[0] == -1);
+            break;
+        }
+        assert(results[0] == 0);
+    }
+    assert(i < 64);
+    sigs[1][40] ^= 1;
+    for (i = 0; i < 16; i++) {
+        assert(verify_batch(10) == -1);
+        assert(results[0] == -1 && results[1] == -1);
+        assert(results[2] == 0);
+    }
+    sigs[1][40] ^= 1;
+    printf("mixed-order R: rejected\n");
+}
+
+int
+main(void)
+{
+    /* l = 2^252 + 27742317777372353535851937790883648493 */
+    static const unsigned char l[32] = {
+        0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+        0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10
+    };
+    unsigned char sk[crypto_sign_SECRETKEYBYTES];
+    unsigned char saved[crypto_sign_BYTES];
+    size_t        count;
+    size_t        i;
+
+    for (i = 0; i < COUNT; i++) {
+        crypto_sign_keypair(pks[i], sk);
+        mlens[i] = i % sizeof ms[i];
+        randombytes_buf(ms[i], (size_t) mlens[i]);
+        crypto_sign_detached(sigs[i], NULL, ms[i], mlens[i], sk);
+        sigs_p[i] = sigs[i];
+        ms_p[i]   = ms[i];
+        pks_p[i]  = pks[i];
+    }
+    for (count = 0; count <= COUNT; count += count < 10 ? 1 : 29) {
+        assert(verify_batch(count) == 0);
+        assert(count_invalid(count) == 0);
+    }
+    printf("valid: OK\n");
+
+    /* a bad signature in a chunk is found, the other chunks still pass */
+    sigs[5][0] ^= 1;
+    assert(verify_batch(COUNT) == -1);
+    printf("bad R: %u\n", (unsigned int) count_invalid(COUNT));
+    sigs[5][0] ^= 1;
+
+    sigs[7][40] ^= 1;
+    sigs[200][63] ^= 0x08;
+    assert(verify_batch(COUNT) == -1);
+    printf("bad S: %u\n", (unsigned int) count_invalid(COUNT));
+    sigs[7][40] ^= 1;
+    sigs[200][63] ^= 0x08;
+
+    ms[150][0] ^= 1;
+    pks_p[299] = pks[298];
+    assert(verify_batch(COUNT) == -1);
+    printf("bad message and key: %u\n", (unsigned int) count_invalid(COUNT));
+    ms[150][0] ^= 1;
+    pks_p[299] = pks[299];
+
+    /* two signatures swapped between messages only pass when both match */
+    sigs_p[10] = sigs[11];
+    sigs_p[11] = sigs[10];
+    assert(verify_batch(20) == -1);
+    printf("swapped: %u\n", (unsigned int) count_invalid(20));
+    sigs_p[10] = sigs[10];
+    sigs_p[11] = sigs[11];
+
+    /* S + l is rejected, as by crypto_sign_verify_detached() */
+    memcpy(saved, sigs[3], sizeof saved);
+    sodium_add(sigs[3] + 32, l, 32);
+    assert(verify_batch(10) == -1);
+    printf("non-canonical S: %u\n", (unsigned int) count_invalid(10));
+    memcpy(sigs[3], saved, sizeof saved);
+
+    assert(crypto_sign_ed25519_verify_detached_batch(sigs_p, ms_p, mlens, pks_p,
+                                                     COUNT, NULL) == 0);
+    sigs[299][1] ^= 1;
+    assert(crypto_sign_ed25519_verify_detached_batch(sigs_p, ms_p, mlens, pks_p,
+                                                     COUNT, NULL) == -1);
+    sigs[299][1] ^= 1;
+
+    mixed_order_r();
+
+    printf("OK\n");
+
+    return 0;
+}
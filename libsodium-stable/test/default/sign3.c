@@ -0,0 +1,152 @@
+
+#define TEST_NAME "sign3"
+#include "cmptest.h"
+
+#define KEYS   10U
+#define CACHED 4U
+
+static unsigned char pks[KEYS][crypto_sign_PUBLICKEYBYTES];
+static unsigned char sigs[KEYS][crypto_sign_BYTES];
+static unsigned char ms[KEYS][64];
+
+static crypto_sign_ed25519_preparedkey prepared;
+
+/* What the cache should hold, from the most to the least recently used key */
+static unsigned int lru[CACHED];
+static unsigned int lru_count;
+static uint64_t     expected_hits;
+static uint64_t     expected_misses;
+
+static void
+expect_lookup(unsigned int key)
+{
+    unsigned int i;
+
+    for (i = 0; i < lru_count && lru[i] != key; i++) {
+    }
+    if (i < lru_count) {
+        expected_hits++;
+    } else {
+        expected_misses++;
+        if (lru_count < CACHED) {
+            lru_count++;
+        }
+        i = lru_count - 1U;
+    }
+    memmove(&lru[1], &lru[0], i * sizeof lru[0]);
+    lru[0] = key;
+}
+
+int
+main(void)
+{
+    /* (0, 1), of small order */
+    static const unsigned char small_order_pk[32] = {
+        0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    crypto_sign_ed25519_pkcache *cache;
+    unsigned char                sk[crypto_sign_SECRETKEYBYTES];
+    unsigned char                bad_pk[crypto_sign_PUBLICKEYBYTES];
+    uint64_t                     hits;
+    uint64_t                     misses;
+    uint64_t                     hits2;
+    uint64_t                     misses2;
+    unsigned int                 i;
+    unsigned int                 j;
+
+    for (i = 0; i < KEYS; i++) {
+        crypto_sign_keypair(pks[i], sk);
+        randombytes_buf(ms[i], sizeof ms[i]);
+        crypto_sign_detached(sigs[i], NULL, ms[i], sizeof ms[i], sk);
+    }
+
+    for (i = 0; i < KEYS; i++) {
+        assert(crypto_sign_ed25519_pk_prepare(&prepared, pks[i]) == 0);
+        for (j = 0; j < KEYS; j++) {
+            assert(crypto_sign_ed25519_verify_detached_prepared(
+                       sigs[j], ms[j], sizeof ms[j], &prepared) == (i == j ? 0 : -1));
+        }
+        sigs[i][10] ^= 1;
+        assert(crypto_sign_ed25519_verify_detached_prepared(
+                   sigs[i], ms[i], sizeof ms[i], &prepared) == -1);
+        sigs[i][10] ^= 1;
+        assert(crypto_sign_ed25519_verify_detached_prepared(
+                   sigs[i], ms[i], sizeof ms[i] - 1U, &prepared) == -1);
+    }
+    printf("prepared: OK\n");
+
+    assert(crypto_sign_ed25519_pk_prepare(&prepared, small_order_pk) == -1);
+    memset(bad_pk, 0xff, sizeof bad_pk);
+    assert(crypto_sign_ed25519_pk_prepare(&prepared, bad_pk) == -1);
+    printf("invalid keys: OK\n");
+
+    /* fewer entries than keys, so that keys are evicted and prepared again */
+    cache = crypto_sign_ed25519_pkcache_new(CACHED);
+    assert(cache != NULL);
+    for (i = 0; i < 200U; i++) {
+        j = (i * 7U + i / 13U) % (i < 100U ? KEYS : 5U);
+        expect_lookup(j);
+        assert(crypto_sign_ed25519_verify_detached_cached(
+                   cache, sigs[j], ms[j], sizeof ms[j], pks[j]) == 0);
+        expect_lookup(j);
+        assert(crypto_sign_ed25519_verify_detached_cached(
+                   cache, sigs[(j + 1U) % KEYS], ms[j], sizeof ms[j], pks[j]) == -1);
+        if (i % 17U == 0U) {
+            assert(crypto_sign_ed25519_verify_detached_cached(
+                       cache, sigs[j], ms[j], sizeof ms[j], small_order_pk) == -1);
+            assert(crypto_sign_ed25519_verify_detached_cached(
+                       cache, sigs[j], ms[j], sizeof ms[j], bad_pk) == -1);
+            expected_misses += 2U;
+        }
+        crypto_sign_ed25519_pkcache_stats(cache, &hits, &misses);
+        assert(hits == expected_hits && misses == expected_misses);
+    }
+    printf("cached: %u hits, %u misses\n", (unsigned int) hits,
+           (unsigned int) misses);
+
+    /* the least recently used key is the one replaced */
+    for (i = 0; i < CACHED; i++) {
+        assert(crypto_sign_ed25519_verify_detached_cached(
+                   cache, sigs[i], ms[i], sizeof ms[i], pks[i]) == 0);
+    }
+    assert(crypto_sign_ed25519_verify_detached_cached(
+               cache, sigs[0], ms[0], sizeof ms[0], pks[0]) == 0);
+    assert(crypto_sign_ed25519_verify_detached_cached(
+               cache, sigs[CACHED], ms[CACHED], sizeof ms[CACHED],
+               pks[CACHED]) == 0);
+    crypto_sign_ed25519_pkcache_stats(cache, &hits, &misses);
+    assert(crypto_sign_ed25519_verify_detached_cached(
+               cache, sigs[0], ms[0], sizeof ms[0], pks[0]) == 0);
+    crypto_sign_ed25519_pkcache_stats(cache, &hits2, &misses2);
+    assert(hits2 == hits + 1U && misses2 == misses);
+    assert(crypto_sign_ed25519_verify_detached_cached(
+               cache, sigs[1], ms[1], sizeof ms[1], pks[1]) == 0);
+    crypto_sign_ed25519_pkcache_stats(cache, &hits, &misses);
+    assert(hits == hits2 && misses == misses2 + 1U);
+    printf("evicted: OK\n");
+    crypto_sign_ed25519_pkcache_free(cache);
+
+    cache = crypto_sign_ed25519_pkcache_new(1U);
+    assert(cache != NULL);
+    for (i = 0; i < KEYS * 2U; i++) {
+        j = i % KEYS;
+        assert(crypto_sign_ed25519_verify_detached_cached(
+                   cache, sigs[j], ms[j], sizeof ms[j], pks[j]) == 0);
+        assert(crypto_sign_ed25519_verify_detached_cached(
+                   cache, sigs[j], ms[j], sizeof ms[j], pks[j]) == 0);
+    }
+    crypto_sign_ed25519_pkcache_stats(cache, &hits, &misses);
+    assert(hits == KEYS * 2U && misses == KEYS * 2U);
+    crypto_sign_ed25519_pkcache_free(cache);
+
+    assert(crypto_sign_ed25519_pkcache_new(0U) == NULL);
+    crypto_sign_ed25519_pkcache_free(NULL);
+    assert(crypto_sign_ed25519_preparedkeybytes() ==
+           sizeof(crypto_sign_ed25519_preparedkey));
+
+    printf("OK\n");
+
+    return 0;
+}
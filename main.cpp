@@ -1,9 +1,20 @@
 #include "Buffer.h"
 #include "Tester.h"
+#include "Compressor.h"
+#include "SecureBuffer.h"
+#include "SecureChannel.h"
+#include "DigestBuffer.h"
 #include <stdint.h>
+#include <atomic>
+#include <thread>
 
 
-int main() { return Tester::Run(); }
+int main(int argc, char** argv)
+{
+	if (sodium_init() < 0)
+		return 1;
+	return Tester::Run(argc, argv);
+}
 
 TEST("Construct a Buffer from int8_t", "work",
 	for (int8_t i = -128;; i++)
@@ -23,6 +34,7 @@ TEST("Construct a Buffer from int8_t", "work",
 BENCH("Construct a Buffer from int8_t", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf((int8_t)-5);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -44,6 +56,7 @@ TEST("Construct a Buffer from uint8_t", "work",
 BENCH("Construct a Buffer from uint8_t", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf((uint8_t)250);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -80,6 +93,7 @@ TEST("Construct a Buffer from int16_t", "work",
 BENCH("Construct a Buffer from int16_t", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf((int16_t)-31523);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -116,6 +130,7 @@ TEST("Construct a Buffer from uint16_t", "work",
 BENCH("Construct a Buffer from uint16_t", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf((uint16_t)45321);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -152,6 +167,7 @@ TEST("Construct a Buffer from int32_t", "work",
 BENCH("Construct a Buffer from int32_t", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf((int32_t)-4532541);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -188,6 +204,7 @@ TEST("Construct a Buffer from int32_t", "work",
 BENCH("Construct a Buffer from uint32_t", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf((uint32_t)4532541);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -205,6 +222,7 @@ BENCH("Construct a Buffer from std::string", "be fast",
 	std::string target("hello guys!");
 	START_BENCH;
 	Buffer::Buffer buf(target);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -221,6 +239,7 @@ TEST("Construct a Buffer from std::tuple<int8_t, int16_t>", "work",
 BENCH("Construct a Buffer from std::tuple<int8_t, int16_t>", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf(tup_res1);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -237,6 +256,7 @@ TEST("Construct a Buffer from std::tuple<int8_t, std::string>", "work",
 BENCH("Construct a Buffer from std::tuple<int8_t, std::string>", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf(tup_res2);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -253,6 +273,7 @@ TEST("Construct a Buffer from std::vector<int8_t>", "work",
 BENCH("Construct a Buffer from std::vector<int8_t>", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf(vec_res1);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -269,6 +290,7 @@ TEST("Construct a Buffer from std::vector<std::string>", "work",
 BENCH("Construct a Buffer from std::vector<std::string>", "be fast",
 	START_BENCH;
 	Buffer::Buffer buf(vec_res2);
+	Tester::DoNotOptimize(buf);
 	STOP_BENCH;
 );
 
@@ -290,5 +312,978 @@ TEST(("Construct a Buffer from std::vector<std::tuple<int8_t, std::string>>"), "
 BENCH(("Construct a Buffer from std::vector<std::tuple<int8_t, std::string>>"), "be fast",
 	START_BENCH;
 	Buffer::Buffer buf(vec_res3);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+
+// Representative payload shapes for the compression stage
+std::vector<std::string> cmp_res1(255, "player_name_placeholder#");
+std::vector<int32_t> cmp_res2 = []() { std::vector<int32_t> v; for (int32_t i = 0; i < 255; i++) v.push_back(i % 17); return v; }();
+std::vector<std::string> cmp_res3 = []()
+{
+	std::vector<std::string> v;
+	uint32_t seed = 0x2545F491;
+	for (int i = 0; i < 255; i++)
+	{
+		std::string s(200, '\0');
+		for (auto& c : s)
+		{
+			seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+			c = static_cast<char>(seed);
+		}
+		v.push_back(s);
+	}
+	return v;
+}();
+std::vector<std::tuple<int8_t, std::string>> cmp_res4 = []()
+{
+	std::vector<std::tuple<int8_t, std::string>> v;
+	for (int8_t i = 0; i < 100; i++)
+		v.push_back({ i, "status=ok;region=eu-west;retry=" + std::to_string(i % 3) });
+	return v;
+}();
+
+TEST("Compress a Buffer of repeated strings", "round-trip and shrink",
+	Buffer::Buffer buf(cmp_res1);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	EXPECT("the frame to be flagged as compressed", Buffer::Compressor::IsCompressed(frame.data(), frame.size()));
+	EXPECT("the frame to be under a tenth of the Buffer", frame.size() < buf.GetSize() / 10);
+	auto restored = Buffer::Compressor::Decompress(frame);
+	ASSERT("Decompress() to succeed", restored.has_value());
+	EXPECT("Decompress() to restore the Buffer", *restored == buf.GetDataAsString());
+	EXPECT("Buffer::GetArguments() to read the restored data", Buffer::Buffer::GetArguments<std::vector<std::string>>(restored->data()) == cmp_res1);
+);
+
+TEST("Compress a Buffer of small ints", "round-trip and shrink",
+	Buffer::Buffer buf(cmp_res2);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	EXPECT("the frame to be flagged as compressed", Buffer::Compressor::IsCompressed(frame.data(), frame.size()));
+	EXPECT("the frame to be smaller than the Buffer", frame.size() < buf.GetSize());
+	auto restored = Buffer::Compressor::Decompress(frame);
+	ASSERT("Decompress() to succeed", restored.has_value());
+	EXPECT("Buffer::GetArguments() to read the restored data", Buffer::Buffer::GetArguments<std::vector<int32_t>>(restored->data()) == cmp_res2);
+);
+
+TEST("Compress a Buffer of random bytes", "fall back to raw",
+	Buffer::Buffer buf(cmp_res3);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	EXPECT("the frame not to be flagged as compressed", !Buffer::Compressor::IsCompressed(frame.data(), frame.size()));
+	EXPECT("the frame to only add the header", frame.size() == buf.GetSize() + Buffer::Compressor::HeaderSize);
+	auto restored = Buffer::Compressor::Decompress(frame);
+	ASSERT("Decompress() to succeed", restored.has_value());
+	EXPECT("Decompress() to restore the Buffer", *restored == buf.GetDataAsString());
+);
+
+TEST("Compress a small Buffer", "skip compression below the threshold",
+	Buffer::Buffer buf(vec_res2);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	EXPECT("the frame not to be flagged as compressed", !Buffer::Compressor::IsCompressed(frame.data(), frame.size()));
+	EXPECT("the frame to hold the Buffer after the header", frame.substr(Buffer::Compressor::HeaderSize) == buf.GetDataAsString());
+	std::string forced = Buffer::Compressor::Compress(buf.GetData(), buf.GetSize(), 0);
+	auto restored = Buffer::Compressor::Decompress(forced);
+	EXPECT("a forced compression to round-trip", restored.has_value() && *restored == buf.GetDataAsString());
+	Buffer::Buffer empty;
+	auto restoredEmpty = Buffer::Compressor::Decompress(Buffer::Compressor::Compress(empty.GetData(), empty.GetSize(), 0));
+	EXPECT("an empty Buffer to round-trip", restoredEmpty.has_value() && restoredEmpty->empty());
+);
+
+TEST("Compress a batch of Buffers", "round-trip as one frame",
+	Buffer::Buffer buf1(cmp_res1);
+	Buffer::Buffer buf2(cmp_res4);
+	std::string frame = Buffer::Compressor::CompressBatch(buf1, buf2);
+	auto restored = Buffer::Compressor::Decompress(frame);
+	ASSERT("Decompress() to succeed", restored.has_value());
+	EXPECT("the frame to be flagged as compressed", Buffer::Compressor::IsCompressed(frame.data(), frame.size()));
+	auto first = Buffer::Buffer::GetArgumentsAndSize<std::vector<std::string>>(restored->data());
+	EXPECT("the first Buffer to be read back", first.first == cmp_res1 && first.second == buf1.GetSize());
+	EXPECT("the second Buffer to be read back", (Buffer::Buffer::GetArguments<std::vector<std::tuple<int8_t, std::string>>>(restored->data() + first.second)) == cmp_res4);
+);
+
+TEST("Decompress a malformed frame", "be rejected",
+	Buffer::Buffer buf(cmp_res1);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	EXPECT("a truncated header to be rejected", !Buffer::Compressor::Decompress(frame.data(), 3).has_value());
+	EXPECT("a truncated payload to be rejected", !Buffer::Compressor::Decompress(frame.data(), frame.size() - 1).has_value());
+	std::string unknown = frame;
+	unknown[0] = '\x7F';
+	EXPECT("an unknown flag to be rejected", !Buffer::Compressor::Decompress(unknown).has_value());
+	std::string wrongSize = frame;
+	wrongSize[1] = static_cast<char>(wrongSize[1] + 1);
+	EXPECT("a wrong original size to be rejected", !Buffer::Compressor::Decompress(wrongSize).has_value());
+	const char huge[] = "\x01\xFF\xFF\xFF\xFF"; // an LZ frame claiming 4 GiB out of no payload
+	EXPECT("an original size beyond what the payload can expand to to be rejected", !Buffer::Compressor::Decompress(huge, sizeof huge - 1).has_value());
+	bool threw = false;
+	try
+	{
+		// Never read: the size check comes first
+		(void) Buffer::Compressor::Compress(huge, static_cast<size_t>(UINT32_MAX) + 1);
+	}
+	catch (const std::length_error&)
+	{
+		threw = true;
+	}
+	EXPECT("an input of 4 GiB to be refused rather than truncated", threw);
+	bool survived = true;
+	for (size_t i = Buffer::Compressor::HeaderSize; i < frame.size(); i++)
+	{
+		std::string corrupted = frame;
+		corrupted[i] = static_cast<char>(corrupted[i] ^ 0xA5);
+		auto restored = Buffer::Compressor::Decompress(corrupted);
+		survived &= !restored.has_value() || restored->size() == buf.GetSize();
+	}
+	EXPECT("corrupted payloads never to overflow the output", survived);
+);
+
+BENCH("Compress a Buffer of repeated strings", "be fast",
+	Buffer::Buffer buf(cmp_res1);
+	START_BENCH;
+	std::string frame = Buffer::Compressor::Compress(buf);
+	Tester::DoNotOptimize(frame);
+	STOP_BENCH;
+);
+
+BENCH("Decompress a Buffer of repeated strings", "be fast",
+	Buffer::Buffer buf(cmp_res1);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	START_BENCH;
+	auto restored = Buffer::Compressor::Decompress(frame);
+	Tester::DoNotOptimize(restored);
 	STOP_BENCH;
 );
+
+BENCH("Compress a Buffer of small ints", "be fast",
+	Buffer::Buffer buf(cmp_res2);
+	START_BENCH;
+	std::string frame = Buffer::Compressor::Compress(buf);
+	Tester::DoNotOptimize(frame);
+	STOP_BENCH;
+);
+
+BENCH("Compress a Buffer of random bytes", "be fast",
+	Buffer::Buffer buf(cmp_res3);
+	START_BENCH;
+	std::string frame = Buffer::Compressor::Compress(buf);
+	Tester::DoNotOptimize(frame);
+	STOP_BENCH;
+);
+
+BENCH("Compress a Buffer of std::tuple<int8_t, std::string> records", "be fast",
+	Buffer::Buffer buf(cmp_res4);
+	START_BENCH;
+	std::string frame = Buffer::Compressor::Compress(buf);
+	Tester::DoNotOptimize(frame);
+	STOP_BENCH;
+);
+
+BENCH("Decompress a Buffer of std::tuple<int8_t, std::string> records", "be fast",
+	Buffer::Buffer buf(cmp_res4);
+	std::string frame = Buffer::Compressor::Compress(buf);
+	START_BENCH;
+	auto restored = Buffer::Compressor::Decompress(frame);
+	Tester::DoNotOptimize(restored);
+	STOP_BENCH;
+);
+
+unsigned char sec_key[Buffer::SecureBuffer::KeySize] = {};
+unsigned char sec_ad[] = "channel-42";
+TEST("Encrypt a SecureBuffer in place", "round-trip",
+	unsigned char key[Buffer::SecureBuffer::KeySize];
+	Buffer::SecureBuffer::GenerateKey(key);
+	Buffer::SecureBuffer buf(vec_res3);
+	Buffer::Buffer plain(vec_res3);
+	EXPECT("buf.GetSize() to add the nonce and the tag", buf.GetSize() == plain.GetSize() + Buffer::SecureBuffer::Overhead);
+	EXPECT("buf.GetPayload() to hold the arguments", std::string(buf.GetPayload(), buf.GetPayloadSize()) == plain.GetDataAsString());
+	buf.Encrypt(key);
+	EXPECT("buf.GetPayload() to be encrypted", std::string(buf.GetPayload(), buf.GetPayloadSize()) != plain.GetDataAsString());
+	bool decrypted = buf.Decrypt(key);
+	ASSERT("buf.Decrypt() to succeed", decrypted);
+	EXPECT("Buffer::GetArguments() to read the decrypted payload", (Buffer::Buffer::GetArguments<std::vector<std::tuple<int8_t, std::string>>>(buf.GetPayload())) == vec_res3);
+);
+
+TEST("Open a SecureBuffer message", "interoperate with the combined AEAD API",
+	unsigned char key[Buffer::SecureBuffer::KeySize];
+	Buffer::SecureBuffer::GenerateKey(key);
+	Buffer::SecureBuffer buf(tup_res2);
+	buf.Encrypt(key, sec_ad, sizeof sec_ad);
+	std::string wire = buf.GetDataAsString();
+	const unsigned char* nonce = reinterpret_cast<const unsigned char*>(wire.data());
+	std::string plain(wire.size() - Buffer::SecureBuffer::Overhead, '\0');
+	int res = crypto_aead_xchacha20poly1305_ietf_decrypt(reinterpret_cast<unsigned char*>(plain.data()), nullptr, nullptr,
+		nonce + Buffer::SecureBuffer::NonceSize, wire.size() - Buffer::SecureBuffer::NonceSize, sec_ad, sizeof sec_ad, nonce, key);
+	EXPECT("crypto_aead_xchacha20poly1305_ietf_decrypt() to accept the message", res == 0);
+	EXPECT("crypto_aead_xchacha20poly1305_ietf_decrypt() to restore the arguments", (Buffer::Buffer::GetArguments<std::tuple<int8_t, std::string>>(plain.data())) == tup_res2);
+	bool opened = Buffer::SecureBuffer::Open(wire.data(), wire.size(), key, sec_ad, sizeof sec_ad);
+	ASSERT("Buffer::SecureBuffer::Open() to succeed", opened);
+	EXPECT("Buffer::GetArguments() to read the opened message", (Buffer::Buffer::GetArguments<std::tuple<int8_t, std::string>>(wire.data() + Buffer::SecureBuffer::NonceSize)) == tup_res2);
+);
+
+TEST("Open a tampered SecureBuffer message", "be rejected",
+	unsigned char key[Buffer::SecureBuffer::KeySize];
+	Buffer::SecureBuffer::GenerateKey(key);
+	Buffer::SecureBuffer buf(vec_res2);
+	buf.Encrypt(key, sec_ad, sizeof sec_ad);
+	std::string wire = buf.GetDataAsString();
+	std::string tampered = wire;
+	tampered[Buffer::SecureBuffer::NonceSize] ^= 1;
+	EXPECT("a flipped payload bit to be rejected", !Buffer::SecureBuffer::Open(tampered.data(), tampered.size(), key, sec_ad, sizeof sec_ad));
+	tampered = wire;
+	tampered.back() ^= 1;
+	EXPECT("a flipped tag bit to be rejected", !Buffer::SecureBuffer::Open(tampered.data(), tampered.size(), key, sec_ad, sizeof sec_ad));
+	tampered = wire;
+	EXPECT("a different additional data to be rejected", !Buffer::SecureBuffer::Open(tampered.data(), tampered.size(), key, nullptr, 0));
+	EXPECT("a message shorter than the overhead to be rejected", !Buffer::SecureBuffer::Open(tampered.data(), Buffer::SecureBuffer::Overhead - 1, key));
+);
+
+BENCH("Construct and encrypt a SecureBuffer from std::vector<std::tuple<int8_t, std::string>>", "be fast",
+	Buffer::SecureBuffer::GenerateKey(sec_key);
+	START_BENCH;
+	Buffer::SecureBuffer buf(vec_res3);
+	buf.Encrypt(sec_key);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+BENCH("Construct and encrypt a Buffer from std::vector<std::tuple<int8_t, std::string>> with a separate ciphertext", "be fast",
+	Buffer::SecureBuffer::GenerateKey(sec_key);
+	START_BENCH;
+	Buffer::Buffer buf(vec_res3);
+	unsigned char nonce[Buffer::SecureBuffer::NonceSize];
+	randombytes_buf(nonce, sizeof nonce);
+	unsigned char* ciphertext = new unsigned char[buf.GetSize() + Buffer::SecureBuffer::TagSize];
+	crypto_aead_xchacha20poly1305_ietf_encrypt(ciphertext, nullptr, reinterpret_cast<const unsigned char*>(buf.GetData()), buf.GetSize(), nullptr, 0, nullptr, nonce, sec_key);
+	Tester::DoNotOptimize(ciphertext);
+	delete[] ciphertext;
+	STOP_BENCH;
+);
+
+unsigned char chan_key[Buffer::SecureChannel::KeySize] = {};
+TEST("Stream Buffers over a SecureChannel", "round-trip in order",
+	unsigned char key[Buffer::SecureChannel::KeySize];
+	Buffer::SecureChannel::GenerateKey(key);
+	Buffer::SecureChannel::Sender sender(key);
+	Buffer::SecureChannel::Receiver receiver(key);
+	Buffer::Buffer buf1(vec_res3);
+	Buffer::Buffer buf2(tup_res2);
+	Buffer::Buffer buf3(cmp_res1);
+	sender.Push(buf1);
+	sender.Push(buf2);
+	std::string wire = sender.Flush();
+	EXPECT("two coalesced frames to cost one header and one record", wire.size() == Buffer::SecureChannel::HeaderSize + Buffer::SecureChannel::RecordOverhead
+		+ 2 * Buffer::SecureChannel::FrameOverhead + buf1.GetSize() + buf2.GetSize());
+	sender.Push(buf3);
+	wire += sender.Close();
+	EXPECT("sender.IsClosed() to be true", sender.IsClosed());
+	bool received = true;
+	for (char c : wire) // worst case: the pipe delivers one byte at a time
+		received &= receiver.Receive(&c, 1);
+	ASSERT("receiver.Receive() to accept the stream", received);
+	EXPECT("receiver.IsClosed() to be true", receiver.IsClosed());
+	EXPECT("receiver.GetPendingCount() to be 3", receiver.GetPendingCount() == 3);
+	EXPECT("the first Buffer to be received", (Buffer::Buffer::GetArguments<std::vector<std::tuple<int8_t, std::string>>>(receiver.Pop()->data())) == vec_res3);
+	EXPECT("the second Buffer to be received", (Buffer::Buffer::GetArguments<std::tuple<int8_t, std::string>>(receiver.Pop()->data())) == tup_res2);
+	EXPECT("the third Buffer to be received", *receiver.Pop() == buf3.GetDataAsString());
+	EXPECT("no other Buffer to be received", !receiver.Pop().has_value());
+);
+
+TEST("Stream many Buffers over a SecureChannel", "coalesce and rekey",
+	unsigned char key[Buffer::SecureChannel::KeySize];
+	Buffer::SecureChannel::GenerateKey(key);
+	Buffer::SecureChannel::Sender sender(key, 1024, 4);
+	Buffer::SecureChannel::Receiver receiver(key);
+	Buffer::Buffer buf(vec_res2);
+	std::string wire;
+	for (int i = 0; i < 2000; i++)
+		sender.Push(buf);
+	wire = sender.Close();
+	size_t records = (wire.size() - Buffer::SecureChannel::HeaderSize - 2000 * (Buffer::SecureChannel::FrameOverhead + buf.GetSize())) / Buffer::SecureChannel::RecordOverhead;
+	EXPECT("frames to be coalesced into records of the coalesce size", records == 2000 * (Buffer::SecureChannel::FrameOverhead + buf.GetSize()) / 1024 + 1);
+	bool received = receiver.Receive(wire);
+	ASSERT("receiver.Receive() to follow the rekeyed stream", received);
+	EXPECT("every Buffer to be received", receiver.GetPendingCount() == 2000);
+	EXPECT("receiver.IsClosed() to be true", receiver.IsClosed());
+);
+
+TEST("Receive a tampered SecureChannel stream", "be rejected",
+	unsigned char key[Buffer::SecureChannel::KeySize];
+	Buffer::SecureChannel::GenerateKey(key);
+	Buffer::SecureChannel::Sender sender(key);
+	Buffer::Buffer buf(vec_res3);
+	sender.Push(buf);
+	std::string first = sender.Flush();
+	sender.Push(buf);
+	std::string second = sender.Flush();
+	std::string last = sender.Close();
+
+	Buffer::SecureChannel::Receiver truncated(key);
+	EXPECT("a stream without its FINAL record to be accepted", truncated.Receive(first + second));
+	EXPECT("a stream without its FINAL record not to be closed", !truncated.IsClosed());
+
+	Buffer::SecureChannel::Receiver reordered(key);
+	EXPECT("reordered records to be rejected", !reordered.Receive(first + last));
+
+	std::string flipped = first;
+	flipped.back() ^= 1;
+	Buffer::SecureChannel::Receiver forged(key);
+	EXPECT("a flipped bit to be rejected", !forged.Receive(flipped));
+	EXPECT("a failed receiver to stay failed", !forged.Receive(second));
+
+	Buffer::SecureChannel::Receiver extended(key);
+	EXPECT("bytes after the FINAL record to be rejected", !extended.Receive(first + second + last + "x"));
+
+	unsigned char otherKey[Buffer::SecureChannel::KeySize];
+	Buffer::SecureChannel::GenerateKey(otherKey);
+	Buffer::SecureChannel::Receiver wrongKey(otherKey);
+	EXPECT("a wrong key to be rejected", !wrongKey.Receive(first));
+);
+
+TEST("Push an oversized Buffer to a SecureChannel", "be refused by the Sender",
+	unsigned char key[Buffer::SecureChannel::KeySize];
+	Buffer::SecureChannel::GenerateKey(key);
+	Buffer::SecureChannel::Sender sender(key);
+	Buffer::SecureChannel::Receiver receiver(key);
+	std::string largest(Buffer::SecureChannel::MaxFrameSize, 'x');
+	EXPECT("a frame of MaxFrameSize to be pushed", sender.Push(largest.data(), largest.size()));
+	EXPECT("a frame over MaxFrameSize to be refused", !sender.Push(largest.data(), largest.size() + 1));
+	std::string wire = sender.Close();
+	EXPECT("a push after Close() to be refused", !sender.Push("x", 1));
+	ASSERT("receiver.Receive() to accept the largest frame", receiver.Receive(wire));
+	EXPECT("only the largest frame to be received", receiver.GetPendingCount() == 1 && receiver.Pop()->size() == largest.size());
+	bool threw = false;
+	try
+	{
+		Buffer::SecureChannel::Sender noRekey(key, Buffer::SecureChannel::DefaultCoalesceSize, 0);
+	}
+	catch (const std::invalid_argument&)
+	{
+		threw = true;
+	}
+	EXPECT("a rekey interval of 0 to throw std::invalid_argument", threw);
+);
+
+BENCH("Stream std::vector<std::string> Buffers over a SecureChannel", "be fast",
+	Buffer::SecureChannel::GenerateKey(chan_key);
+	Buffer::SecureChannel::Sender sender(chan_key);
+	Buffer::Buffer buf(vec_res2);
+	size_t pushed = 0;
+	START_BENCH;
+	sender.Push(buf);
+	if (++pushed % 64 == 0)
+		Tester::DoNotOptimize(sender.Flush());
+	STOP_BENCH;
+);
+
+BENCH("Seal std::vector<std::string> Buffers individually with a random nonce", "be fast",
+	Buffer::SecureBuffer::GenerateKey(sec_key);
+	START_BENCH;
+	Buffer::SecureBuffer buf(vec_res2);
+	buf.Encrypt(sec_key);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+TEST("Compute a CRC32C digest", "match the reference check value",
+	Buffer::Crc32cDigest digest;
+	digest.Update("1234", 4);
+	digest.Update("56789", 5);
+	unsigned char out[Buffer::Crc32cDigest::Size];
+	digest.Final(out);
+	EXPECT("CRC32C(\"123456789\") to be 0xE3069283", std::string(reinterpret_cast<char*>(out), 4) == std::string("\x83\x92\x06\xE3", 4));
+);
+
+TEST("Construct a DigestBuffer<Blake2bDigest>", "hash while encoding",
+	Buffer::DigestBuffer<Buffer::Blake2bDigest> buf(cmp_res3);
+	Buffer::Buffer plain(cmp_res3);
+	EXPECT("buf.GetSize() to add the digest", buf.GetSize() == plain.GetSize() + Buffer::Blake2bDigest::Size);
+	EXPECT("buf.GetData() to start with the arguments", std::string(buf.GetData(), buf.GetPayloadSize()) == plain.GetDataAsString());
+	unsigned char expected[Buffer::Blake2bDigest::Size];
+	crypto_generichash(expected, sizeof expected, reinterpret_cast<const unsigned char*>(plain.GetData()), plain.GetSize(), nullptr, 0);
+	EXPECT("buf.GetDigest() to be crypto_generichash() of the arguments", memcmp(buf.GetDigest(), expected, sizeof expected) == 0);
+	auto decoded = Buffer::DigestBuffer<Buffer::Blake2bDigest>::GetVerifiedArguments<std::vector<std::string>>(buf.GetData(), buf.GetSize());
+	EXPECT("GetVerifiedArguments() to decode the arguments", decoded.has_value() && *decoded == cmp_res3);
+	Buffer::DigestBuffer<Buffer::Blake2bDigest> records((int8_t)1, cmp_res4, std::string("trailer"));
+	Buffer::Buffer recordsPlain((int8_t)1, cmp_res4, std::string("trailer"));
+	crypto_generichash(expected, sizeof expected, reinterpret_cast<const unsigned char*>(recordsPlain.GetData()), recordsPlain.GetSize(), nullptr, 0);
+	EXPECT("a digest over scalars, tuples and strings to match too", memcmp(records.GetDigest(), expected, sizeof expected) == 0);
+);
+
+TEST("Construct a DigestBuffer<Crc32cDigest>", "hash while encoding",
+	Buffer::DigestBuffer<Buffer::Crc32cDigest> buf(cmp_res1, tup_res2);
+	Buffer::Buffer plain(cmp_res1, tup_res2);
+	Buffer::Crc32cDigest digest;
+	digest.Update(plain.GetData(), plain.GetSize());
+	unsigned char expected[Buffer::Crc32cDigest::Size];
+	digest.Final(expected);
+	EXPECT("buf.GetDigest() to be the CRC32C of the arguments", memcmp(buf.GetDigest(), expected, sizeof expected) == 0);
+	EXPECT("Verify() to accept the Buffer", Buffer::DigestBuffer<Buffer::Crc32cDigest>::Verify(buf.GetData(), buf.GetSize()));
+	Buffer::DigestBuffer<Buffer::Crc32cDigest> small((int16_t)-1);
+	EXPECT("Verify() to accept a Buffer smaller than a chunk", Buffer::DigestBuffer<Buffer::Crc32cDigest>::Verify(small.GetData(), small.GetSize()));
+);
+
+TEST("Verify a corrupted DigestBuffer", "be rejected",
+	Buffer::DigestBuffer<Buffer::Blake2bDigest> buf(cmp_res1);
+	std::string corrupted = buf.GetDataAsString();
+	corrupted[corrupted.size() / 2] ^= 0x10;
+	EXPECT("a flipped payload bit to be rejected", !Buffer::DigestBuffer<Buffer::Blake2bDigest>::Verify(corrupted.data(), corrupted.size()));
+	EXPECT("GetVerifiedArguments() to refuse to decode", !Buffer::DigestBuffer<Buffer::Blake2bDigest>::GetVerifiedArguments<std::vector<std::string>>(corrupted.data(), corrupted.size()).has_value());
+	Buffer::DigestBuffer<Buffer::Crc32cDigest> crc(cmp_res1);
+	corrupted = crc.GetDataAsString();
+	corrupted.back() ^= 0x01;
+	EXPECT("a flipped CRC32C bit to be rejected", !Buffer::DigestBuffer<Buffer::Crc32cDigest>::Verify(corrupted.data(), corrupted.size()));
+	EXPECT("a message shorter than the digest to be rejected", !Buffer::DigestBuffer<Buffer::Crc32cDigest>::Verify(corrupted.data(), 3));
+);
+
+BENCH("Construct a DigestBuffer<Blake2bDigest> from random bytes", "be fast",
+	START_BENCH;
+	Buffer::DigestBuffer<Buffer::Blake2bDigest> buf(cmp_res3);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+BENCH("Construct a Buffer from random bytes then crypto_generichash() it", "be fast",
+	unsigned char digest[crypto_generichash_BYTES];
+	START_BENCH;
+	Buffer::Buffer buf(cmp_res3);
+	crypto_generichash(digest, sizeof digest, reinterpret_cast<const unsigned char*>(buf.GetData()), buf.GetSize(), nullptr, 0);
+	Tester::DoNotOptimize(digest);
+	STOP_BENCH;
+);
+
+BENCH("Construct a DigestBuffer<Blake2bDigest> from std::vector<std::tuple<int8_t, std::string>>", "be fast",
+	START_BENCH;
+	Buffer::DigestBuffer<Buffer::Blake2bDigest> buf(cmp_res4);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+BENCH("Construct a Buffer from std::vector<std::tuple<int8_t, std::string>> then crypto_generichash() it", "be fast",
+	unsigned char digest[crypto_generichash_BYTES];
+	START_BENCH;
+	Buffer::Buffer buf(cmp_res4);
+	crypto_generichash(digest, sizeof digest, reinterpret_cast<const unsigned char*>(buf.GetData()), buf.GetSize(), nullptr, 0);
+	Tester::DoNotOptimize(digest);
+	STOP_BENCH;
+);
+
+BENCH("Construct a DigestBuffer<Crc32cDigest> from random bytes", "be fast",
+	START_BENCH;
+	Buffer::DigestBuffer<Buffer::Crc32cDigest> buf(cmp_res3);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+TEST("Allocate from the Pool", "reuse blocks on the same thread",
+	char* first = Buffer::Pool::Allocate(100);
+	Buffer::Pool::Free(first);
+	char* second = Buffer::Pool::Allocate(100);
+	EXPECT("a freed block to be handed out again", first == second);
+	Buffer::Pool::Free(second);
+	char* large = Buffer::Pool::Allocate(Buffer::Pool::MaxBlockSize * 4);
+	large[Buffer::Pool::MaxBlockSize * 4 - 1] = 1;
+	Buffer::Pool::Free(large);
+	EXPECT("blocks above the largest class not to be cached", Buffer::Pool::GetCachedCount(Buffer::Pool::MaxBlockSize * 4) == 0);
+	const char* storage;
+	{
+		Buffer::Buffer buf(vec_res3);
+		storage = buf.GetData();
+	}
+	Buffer::Buffer buf(vec_res3);
+	EXPECT("a Buffer to reuse the storage of a destroyed one", buf.GetData() == storage);
+);
+
+TEST("Free to the Pool from another thread", "return blocks to their owner",
+	std::atomic<char*> handedOver{ nullptr };
+	std::atomic<bool> released{ false };
+	bool reused = false;
+	std::thread producer([&]()
+	{
+		char* block = Buffer::Pool::Allocate(300);
+		handedOver.store(block);
+		while (!released.load())
+			std::this_thread::yield();
+		std::vector<char*> cached;
+		while (Buffer::Pool::GetCachedCount(300) != 0) // empty the local list so the remote one is drained
+			cached.push_back(Buffer::Pool::Allocate(300));
+		char* reallocated = Buffer::Pool::Allocate(300);
+		reused = reallocated == block;
+		Buffer::Pool::Free(reallocated);
+		for (char* c : cached)
+			Buffer::Pool::Free(c);
+	});
+	while (handedOver.load() == nullptr)
+		std::this_thread::yield();
+	size_t cachedBefore = Buffer::Pool::GetCachedCount(300);
+	Buffer::Pool::Free(handedOver.load());
+	EXPECT("a block freed by another thread not to enter the freeing thread's cache", Buffer::Pool::GetCachedCount(300) == cachedBefore);
+	released.store(true);
+	producer.join();
+	EXPECT("the owner to get the block back", reused);
+);
+
+// Serial: a thread exiting in a parallel test could push its own cache on top of the orphans in between
+TEST_SERIAL("Start a thread after another exited", "adopt its Pool cache",
+	char* adopted = nullptr;
+	std::thread([&]() { adopted = Buffer::Pool::Allocate(5000); Buffer::Pool::Free(adopted); }).join();
+	char* reallocated = nullptr;
+	std::thread([&]() { reallocated = Buffer::Pool::Allocate(5000); Buffer::Pool::Free(reallocated); }).join();
+	EXPECT("a new thread to adopt the cache of an exited one", adopted == reallocated);
+);
+
+// Producer threads allocate Buffer-sized blocks and hand them over single-producer rings to one writer
+// thread that frees them, like an ingest service does with its Buffers. Returns the blocks freed in a second.
+struct handoffRing
+{
+	static constexpr size_t capacity = 1024;
+	char* slots[capacity];
+	alignas(64) std::atomic<size_t> head{ 0 };
+	alignas(64) std::atomic<size_t> tail{ 0 };
+};
+
+template<bool Pooled>
+int crossThreadFrees(unsigned Producers)
+{
+	std::vector<handoffRing> rings(Producers);
+	std::atomic<bool> stop{ false }, producersDone{ false };
+	int freed = 0;
+
+	std::vector<std::thread> producers;
+	for (unsigned p = 0; p < Producers; p++)
+		producers.emplace_back([&rings, &stop, p]()
+		{
+			handoffRing& ring = rings[p];
+			for (size_t head = 0; !stop.load(std::memory_order_relaxed);)
+			{
+				if (head - ring.tail.load(std::memory_order_acquire) == handoffRing::capacity)
+				{
+					std::this_thread::yield();
+					continue;
+				}
+				size_t size = 64 + (head % 8) * 96;
+				char* block = Pooled ? Buffer::Pool::Allocate(size) : new char[size];
+				block[0] = static_cast<char>(head);
+				ring.slots[head % handoffRing::capacity] = block;
+				ring.head.store(++head, std::memory_order_release);
+			}
+		});
+
+	std::thread writer([&]()
+	{
+		while (true)
+		{
+			bool idle = true;
+			for (auto& ring : rings)
+			{
+				size_t tail = ring.tail.load(std::memory_order_relaxed);
+				size_t head = ring.head.load(std::memory_order_acquire);
+				idle &= tail == head;
+				for (; tail != head; tail++, freed++)
+				{
+					if constexpr (Pooled)
+						Buffer::Pool::Free(ring.slots[tail % handoffRing::capacity]);
+					else
+						delete[] ring.slots[tail % handoffRing::capacity];
+				}
+				ring.tail.store(tail, std::memory_order_release);
+			}
+			if (idle && producersDone.load())
+				break;
+			if (idle)
+				std::this_thread::yield();
+		}
+	});
+
+	std::this_thread::sleep_for(std::chrono::seconds(1));
+	stop.store(true);
+	for (auto& t : producers)
+		t.join();
+	producersDone.store(true);
+	writer.join();
+	return freed;
+}
+
+BENCH("Hand Buffer blocks from 1 producer thread to a writer thread", "scale with the Pool",
+	r.counter = crossThreadFrees<true>(1);
+);
+
+BENCH("Hand Buffer blocks from 1 producer thread to a writer thread", "without the Pool",
+	r.counter = crossThreadFrees<false>(1);
+);
+
+BENCH("Hand Buffer blocks from 2 producer threads to a writer thread", "scale with the Pool",
+	r.counter = crossThreadFrees<true>(2);
+);
+
+BENCH("Hand Buffer blocks from 2 producer threads to a writer thread", "without the Pool",
+	r.counter = crossThreadFrees<false>(2);
+);
+
+BENCH("Hand Buffer blocks from 4 producer threads to a writer thread", "scale with the Pool",
+	r.counter = crossThreadFrees<true>(4);
+);
+
+BENCH("Hand Buffer blocks from 4 producer threads to a writer thread", "without the Pool",
+	r.counter = crossThreadFrees<false>(4);
+);
+
+BENCH("Hand Buffer blocks from every hardware thread to a writer thread", "scale with the Pool",
+	r.counter = crossThreadFrees<true>(std::thread::hardware_concurrency());
+);
+
+BENCH("Hand Buffer blocks from every hardware thread to a writer thread", "without the Pool",
+	r.counter = crossThreadFrees<false>(std::thread::hardware_concurrency());
+);
+
+std::vector<double> stats_res1 = { 4, 1, 100, 3, 2 };
+TEST("Compute benchmark statistics", "be robust to outliers",
+	benchStats stats = benchStats::Compute(stats_res1);
+	EXPECT("the median to be 3", stats.median == 3);
+	EXPECT("the MAD to be 1", stats.mad == 1);
+	EXPECT("the mean to be 22", stats.mean == 22);
+	EXPECT("the minimum to be 1", stats.min == 1);
+	EXPECT("the CV to reflect the outlier", stats.cv > 1);
+	stats_res1.push_back(5);
+	EXPECT("the median of an even count to be 3.5", benchStats::Compute(stats_res1).median == 3.5);
+);
+
+// Serial: it changes the global settings every bench reads
+TEST_SERIAL("Run the benchmark engine", "time batches instead of iterations",
+	benchSettings saved = settings;
+	settings.warmupNs = 1'000'000;
+	settings.sampleNs = 100'000;
+	settings.sampleCount = 7;
+	benchRet bench;
+	size_t iterations = 0;
+	while (bench.NextBatch())
+		for (size_t i = bench.batch; i != 0; --i)
+			Tester::DoNotOptimize(++iterations);
+	settings = saved;
+	EXPECT("sampleCount samples to be recorded", bench.samples.size() == 7);
+	EXPECT("batches to grow past one iteration", bench.batch > 1);
+	EXPECT("every sample to be a positive time per iteration", std::all_of(bench.samples.begin(), bench.samples.end(), [](double ns) { return ns > 0; }));
+	EXPECT("the body to run at least once per sample and batch", iterations >= 7 * bench.batch);
+);
+
+std::vector<std::pair<double, double>> fit_res1 = { { 1, 12 }, { 4, 41 }, { 16, 163 }, { 64, 641 }, { 255, 2551 } };
+std::vector<std::pair<double, double>> fit_res2 = { { 1, 20 }, { 4, 21 }, { 16, 19 }, { 64, 20 }, { 255, 21 } };
+std::vector<std::pair<double, double>> fit_res3 = { { 2, 8 }, { 8, 96 }, { 32, 640 }, { 128, 3584 }, { 512, 18432 } };
+TEST("Fit the complexity of a BENCH_RANGE", "find the growth rate",
+	complexityFit linear = complexityFit::Fit(fit_res1);
+	EXPECT("a linear series to be O(n)", std::string(linear.name) == "O(n)");
+	EXPECT("the linear coefficient to be about 10 ns", linear.coefficient > 9.5 && linear.coefficient < 10.5);
+	EXPECT("a flat series to be O(1)", std::string(complexityFit::Fit(fit_res2).name) == "O(1)");
+	EXPECT("an n log n series to be O(n log n)", std::string(complexityFit::Fit(fit_res3).name) == "O(n log n)");
+);
+
+BENCH_RANGE("Construct a Buffer from std::vector<int32_t>", "scale linearly", 1, 255, 4,
+	std::vector<int32_t> values(r.range, 0x12345678);
+	r.SetItemsProcessed(r.range);
+	r.SetBytesProcessed(1 + 4 * r.range);
+	START_BENCH;
+	Buffer::Buffer buf(values);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+BENCH_RANGE("Decode a Buffer into std::vector<int32_t>", "scale linearly", 1, 255, 4,
+	std::vector<int32_t> values(r.range, 0x12345678);
+	Buffer::Buffer buf(values);
+	r.SetItemsProcessed(r.range);
+	r.SetBytesProcessed(buf.GetSize());
+	START_BENCH;
+	auto decoded = Buffer::Buffer::GetArguments<std::vector<int32_t>>(buf.GetData());
+	Tester::DoNotOptimize(decoded);
+	STOP_BENCH;
+);
+
+BENCH_RANGE("Construct a Buffer from std::vector<std::string>", "scale linearly", 1, 255, 4,
+	std::vector<std::string> values(r.range, "player_name_placeholder#");
+	r.SetItemsProcessed(r.range);
+	r.SetBytesProcessed(1 + 25 * r.range);
+	START_BENCH;
+	Buffer::Buffer buf(values);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+BENCH_RANGE("Compress a Buffer of repeated strings", "scale linearly", 16, 255, 4,
+	std::vector<std::string> values(r.range, "player_name_placeholder#");
+	Buffer::Buffer buf(values);
+	r.SetBytesProcessed(buf.GetSize());
+	START_BENCH;
+	std::string frame = Buffer::Compressor::Compress(buf);
+	Tester::DoNotOptimize(frame);
+	STOP_BENCH;
+);
+
+TEST("List the thread counts of a BENCH_THREADS", "double up to the maximum",
+	EXPECT("1 thread to run alone", threadCounts(1) == std::vector<size_t>{ 1 });
+	EXPECT("8 threads to run 1, 2, 4 and 8", threadCounts(8) == std::vector<size_t>({ 1, 2, 4, 8 }));
+	EXPECT("6 threads to run 1, 2, 4 and 6", threadCounts(6) == std::vector<size_t>({ 1, 2, 4, 6 }));
+);
+
+BENCH_THREADS("Construct a Buffer from std::vector<std::tuple<int8_t, std::string>>", "scale across threads",
+	r.SetBytesProcessed(Buffer::Buffer(vec_res3).GetSize());
+	START_BENCH;
+	Buffer::Buffer buf(vec_res3);
+	Tester::DoNotOptimize(buf);
+	STOP_BENCH;
+);
+
+BENCH_THREADS("Decode a Buffer into std::vector<std::tuple<int8_t, std::string>>", "scale across threads",
+	Buffer::Buffer buf(vec_res3);
+	r.SetBytesProcessed(buf.GetSize());
+	START_BENCH;
+	auto decoded = (Buffer::Buffer::GetArguments<std::vector<std::tuple<int8_t, std::string>>>(buf.GetData()));
+	Tester::DoNotOptimize(decoded);
+	STOP_BENCH;
+);
+
+TEST("Record latencies in a log-linear histogram", "keep 2 significant digits",
+	latencyHistogram histogram;
+	for (int64_t ns = 1; ns <= 1000; ns++)
+		histogram.Record(ns);
+	EXPECT("the count to be 1000", histogram.Count() == 1000);
+	EXPECT("the max to be exact", histogram.max == 1000);
+	EXPECT("the mean to be 500.5", histogram.Mean() == 500.5);
+	EXPECT("p50 to be 500 within 1%", histogram.ValueAtPercentile(50) >= 500 && histogram.ValueAtPercentile(50) <= 505);
+	EXPECT("p99.9 to be 999 within 1%", histogram.ValueAtPercentile(99.9) >= 999 && histogram.ValueAtPercentile(99.9) <= 1000);
+	EXPECT("p100 to be the max", histogram.ValueAtPercentile(100) == 1000);
+	histogram.Record(1'000'000'000, 1000);
+	EXPECT("p50 to stay at 1 us within 1%", histogram.ValueAtPercentile(50) >= 1000 && histogram.ValueAtPercentile(50) <= 1008);
+	EXPECT("p99 to land on 1 s within 1%", histogram.ValueAtPercentile(99) >= 1'000'000'000 && histogram.ValueAtPercentile(99) < 1'008'000'000);
+	bool exact = true;
+	for (uint64_t value = 0; value < 100000; value += 7)
+		exact &= latencyHistogram::highestOf(latencyHistogram::indexOf(value)) >= value
+			&& latencyHistogram::highestOf(latencyHistogram::indexOf(value)) <= value + value / 128;
+	EXPECT("every bucket to hold values within 1/128", exact);
+);
+
+TEST_SERIAL("Calibrate the TSC", "agree with the steady clock",
+	int64_t tscStart = tscClock::Now();
+	int64_t steadyStart = steadyTimer::Now();
+	while (steadyTimer::Now() - steadyStart < 100'000'000) // long enough for a preempted calibration not to matter
+		;
+	int64_t tscElapsed = tscClock::Now() - tscStart;
+	int64_t steadyElapsed = steadyTimer::Now() - steadyStart;
+	if (tscClock::Usable()) // a TSC that isn't invariant follows the CPU frequency: no agreement to expect
+		EXPECT("100 ms to measure the same on both clocks within 5%", std::abs(tscElapsed - steadyElapsed) < steadyElapsed / 20);
+	EXPECT("the TSC to be read for the benchmarks only when invariant", tscClock::Usable() || !benchClock::UsesTsc());
+);
+
+TEST_SERIAL("Measure the benchmark timer overhead", "subtract it",
+	int64_t overhead = benchClock::Overhead();
+	EXPECT("an empty measurement to cost something below 1 us", overhead >= 0 && overhead < 1000);
+	int64_t start = benchClock::Start();
+	int64_t stop = benchClock::Stop();
+	EXPECT("Stop() not to come before Start()", stop >= start);
+	EXPECT("an empty measurement to be near 0 once the overhead is gone", benchClock::Elapsed(start, stop) < 1000);
+	EXPECT("a measurement never to be negative", benchClock::Elapsed(stop, start) == 0);
+);
+
+BENCH("Construct a Buffer from uint8_t 250", "be measurable per operation",
+	START_LATENCY;
+	Buffer::Buffer buf((uint8_t)250);
+	Tester::DoNotOptimize(buf);
+	STOP_LATENCY;
+);
+
+BENCH("Construct a Buffer from int8_t", "have a short tail",
+	START_LATENCY;
+	Buffer::Buffer buf((int8_t)1);
+	Tester::DoNotOptimize(buf);
+	STOP_LATENCY;
+);
+
+BENCH("Construct a Buffer from std::vector<std::tuple<int8_t, std::string>>", "have a short tail at 100k op/s",
+	r.SetTargetRate(100'000);
+	START_LATENCY;
+	Buffer::Buffer buf(vec_res3);
+	Tester::DoNotOptimize(buf);
+	STOP_LATENCY;
+);
+
+std::vector<size_t> pool_res1 = []() { std::vector<size_t> v(1000); for (size_t i = 0; i < v.size(); i++) v[i] = i; return v; }();
+TEST("Run tasks on a work-stealing pool", "run each exactly once",
+	std::vector<std::atomic<int>> runs(pool_res1.size());
+	std::mutex threadsLock;
+	std::vector<std::thread::id> threads;
+	runWorkStealing(pool_res1, 4, [&](size_t Task)
+	{
+		runs[Task]++;
+		std::lock_guard<std::mutex> guard(threadsLock);
+		if (std::find(threads.begin(), threads.end(), std::this_thread::get_id()) == threads.end())
+			threads.push_back(std::this_thread::get_id());
+	});
+	EXPECT("every task to run once", std::all_of(runs.begin(), runs.end(), [](const std::atomic<int>& Runs) { return Runs == 1; }));
+	EXPECT("at most 4 threads to take part", threads.size() >= 1 && threads.size() <= 4);
+	bool ran = false;
+	runWorkStealing({}, 4, [&](size_t) { ran = true; });
+	EXPECT("no task to run nothing", !ran);
+);
+
+// Spends about 100 ms of CPU time constructing Buffers under Profiler
+void profileBuffers(samplingProfiler& Profiler)
+{
+	Profiler.Start();
+	clock_t start = clock();
+	while (clock() - start < CLOCKS_PER_SEC / 10)
+		for (int i = 0; i < 1000; i++)
+		{
+			Buffer::Buffer buf(cmp_res4);
+			Tester::DoNotOptimize(buf);
+		}
+	Profiler.Stop();
+}
+
+TEST_SERIAL("Sample the stack with SIGPROF", "see where the time goes",
+	samplingProfiler framePointers;
+	profileBuffers(framePointers);
+	std::ostringstream folded;
+	framePointers.Write(folded);
+	EXPECT("samples to be taken at the timer tick or faster", !samplingProfiler::Available() || framePointers.Count() >= 10);
+	EXPECT("the samples to be written as stacks", !samplingProfiler::Available() || !folded.str().empty());
+	EXPECT("every line to end with a count", folded.str().empty() || folded.str().back() == '\n');
+	samplingProfiler pcOnly;
+	pcOnly.framePointers = false;
+	profileBuffers(pcOnly);
+	folded.str("");
+	pcOnly.Write(folded);
+	EXPECT("samples to be taken without frame pointers", !samplingProfiler::Available() || pcOnly.Count() >= 10);
+	EXPECT("a sample without frame pointers to be a single frame", folded.str().find(';') == std::string::npos);
+);
+
+TEST("Filter benchmarks by name", "match wildcards and substrings",
+	EXPECT("a substring to match", matchesFilter("Buffer from int", "Construct a Buffer from int8_t - be fast"));
+	EXPECT("a missing substring not to match", !matchesFilter("uint16_t", "Construct a Buffer from int8_t - be fast"));
+	EXPECT("* to match any run", matchesFilter("Construct*int8_t*", "Construct a Buffer from int8_t - be fast"));
+	EXPECT("? to match one character", matchesFilter("*from ?int8_t*", "Construct a Buffer from uint8_t - be fast"));
+	EXPECT("a wildcard pattern to match the whole name", !matchesFilter("Construct*int8_t", "Construct a Buffer from int8_t - be fast"));
+);
+
+std::vector<double> cmp_before = { 10.1, 10.3, 9.9, 10.0, 10.2, 10.1, 9.8, 10.0, 10.4, 10.1, 9.9, 10.2 };
+std::vector<double> cmp_after = { 12.1, 12.3, 11.9, 12.0, 12.2, 12.1, 11.8, 12.0, 12.4, 12.1, 11.9, 12.2 };
+TEST("Compare benchmarks with a baseline", "flag significant regressions only",
+	EXPECT("identical samples not to differ", mannWhitney(cmp_before, cmp_before) > 0.9);
+	EXPECT("disjoint samples to differ", mannWhitney(cmp_before, cmp_after) < 0.001);
+	benchResult before;
+	before.name = "a";
+	before.samples = cmp_before;
+	before.stats = benchStats::Compute(cmp_before);
+	benchResult after = before;
+	after.samples = cmp_after;
+	after.stats = benchStats::Compute(cmp_after);
+	EXPECT("a 20% slowdown to regress at a 5% threshold", benchComparison::Compare(before, after, 5, 0.05).verdict == benchComparison::regressed);
+	EXPECT("a 20% slowdown to pass at a 25% threshold", benchComparison::Compare(before, after, 25, 0.05).verdict == benchComparison::unchanged);
+	EXPECT("a 20% speedup to improve", benchComparison::Compare(after, before, 5, 0.05).verdict == benchComparison::improved);
+	EXPECT("no samples not to be compared", benchComparison::Compare(benchResult(), after, 5, 0.05).verdict == benchComparison::incomparable);
+	EXPECT("no samples and no percentiles not to be compared", benchComparison::Compare(benchResult(), benchResult(), 5, 0.05).verdict == benchComparison::incomparable);
+	benchResult fast;
+	fast.latency[0] = 1000;
+	fast.latency[2] = 5000;
+	benchResult slowTail = fast;
+	slowTail.latency[2] = 6000;
+	EXPECT("a 20% slower p99 to regress at a 5% threshold", benchComparison::Compare(fast, slowTail, 5, 0.05).verdict == benchComparison::regressed);
+	EXPECT("a 20% slower p99 to pass at a 25% threshold", benchComparison::Compare(fast, slowTail, 25, 0.05).verdict == benchComparison::unchanged);
+	EXPECT("a faster p99 alone not to improve", benchComparison::Compare(slowTail, fast, 5, 0.05).verdict == benchComparison::unchanged);
+	benchResult slow = slowTail;
+	slow.latency[0] = 1200;
+	EXPECT("faster p50 and p99 to improve", benchComparison::Compare(slow, fast, 5, 0.05).verdict == benchComparison::improved);
+	before.itemsPerSecond = 1000;
+	benchResult fewerItems = before;
+	fewerItems.samples = cmp_after;
+	fewerItems.stats = after.stats;
+	fewerItems.itemsPerSecond = 800;
+	benchComparison throughput = benchComparison::Compare(before, fewerItems, 5, 0.05);
+	EXPECT("20% fewer items/s to regress", throughput.throughput && throughput.verdict == benchComparison::regressed && std::abs(throughput.change - 0.25) < 1e-9);
+	fewerItems.itemsPerSecond = 990;
+	EXPECT("1% fewer items/s to pass although the median slowed down", benchComparison::Compare(before, fewerItems, 5, 0.05).verdict == benchComparison::unchanged);
+	before.itemsPerSecond = 0;
+	before.bytesPerSecond = 2e6;
+	fewerItems.bytesPerSecond = 1e6;
+	EXPECT("half the bytes/s to regress when items aren't counted", benchComparison::Compare(before, fewerItems, 5, 0.05).verdict == benchComparison::regressed);
+);
+
+TEST("Write benchmark results as JSON", "read them back as a baseline",
+	benchResult result;
+	result.name = "Construct a \"Buffer\" - be fast\n";
+	result.range = 64;
+	result.samples = cmp_before;
+	result.stats = benchStats::Compute(cmp_before);
+	result.latency[3] = 1234;
+	result.itemsPerSecond = 2.5e6;
+	result.bytesPerSecond = 1e8;
+	std::ostringstream json;
+	benchResult::WriteJson(json, { result });
+	auto read = benchResult::ReadJson(json.str());
+	ASSERT("the JSON to parse", read.has_value() && read->size() == 1);
+	EXPECT("the name to survive escaping", (*read)[0].name == result.name);
+	EXPECT("the label to keep the range", (*read)[0].Label() == result.Label());
+	EXPECT("the samples to round-trip", (*read)[0].samples == result.samples);
+	EXPECT("the median to round-trip", (*read)[0].stats.median == result.stats.median);
+	EXPECT("p99.9 to round-trip", (*read)[0].latency[3] == 1234);
+	EXPECT("the throughputs to round-trip", (*read)[0].itemsPerSecond == 2.5e6 && (*read)[0].bytesPerSecond == 1e8);
+	EXPECT("truncated JSON to be rejected", !benchResult::ReadJson(json.str().substr(0, json.str().size() / 2)));
+	EXPECT("JSON without benchmarks to be rejected", !benchResult::ReadJson("{ \"tests\": [] }"));
+);
+
+TEST("Collect performance counters", "degrade gracefully",
+	perfCounters perf;
+	bool opened = perf.Open();
+	EXPECT("Open() to either succeed or explain why not", opened || !perf.error.empty());
+	double values[perfCounters::count];
+	perf.Start();
+	std::vector<char> touched(16 * 1024 * 1024, 1);
+	Tester::DoNotOptimize(touched);
+	perf.Stop();
+	perf.Read(values);
+	// An opened counter the host never schedules (time running 0) reads as unavailable too: only the ones that ran are checked
+	bool consistent = true;
+	for (size_t i = 0; i < perfCounters::count; i++)
+		consistent &= perf.fds[i] >= 0 || values[i] < 0;
+	EXPECT("no unopened counter to be read", consistent);
+	if (values[5] >= 0)
+		EXPECT("page faults to be counted when they ran", values[5] > 0);
+);
+
+// Allocation counting is opt-in: build with make COUNT_ALLOCATIONS=1 to check the counts below
+TEST("Count allocations", "see every heap allocation",
+	Tester::AllocationStats none = Tester::CountAllocations([]() { Tester::DoNotOptimize(1 + 1); });
+	EXPECT("an allocation-free scope to count 0 allocations", none.Allocations == 0 && none.Bytes == 0);
+	Tester::AllocationStats vector = Tester::CountAllocations([]()
+	{
+		std::vector<int32_t> values(1000);
+		Tester::DoNotOptimize(values);
+	});
+	if constexpr (Tester::CountsAllocations)
+	{
+		EXPECT("a std::vector<int32_t>(1000) to count 1 allocation", vector.Allocations == 1 && vector.Frees == 1);
+		EXPECT("a std::vector<int32_t>(1000) to count 4000 bytes", vector.Bytes == 4000);
+		EXPECT("a std::vector<int32_t>(1000) to peak at 4000 bytes or more", vector.PeakLiveBytes >= 4000);
+	}
+	else
+		EXPECT("every figure to stay 0 without TESTER_COUNT_ALLOCATIONS", vector.Allocations == 0 && vector.Bytes == 0);
+);
+
+TEST("Construct a Buffer on a warm Pool", "not allocate",
+	size_t bytes = Buffer::Buffer(vec_res3).GetSize();
+	size_t cached = Buffer::Pool::GetCachedCount(bytes);
+	size_t cachedDuring = 0;
+	Tester::AllocationStats construct = Tester::CountAllocations([bytes, &cachedDuring]()
+	{
+		Buffer::Buffer buf(vec_res3);
+		cachedDuring = Buffer::Pool::GetCachedCount(bytes);
+		Tester::DoNotOptimize(buf);
+	});
+	EXPECT("Buffer construction to take its block from the thread's cache", cached > 0 && cachedDuring == cached - 1);
+	EXPECT("the block to go back to the cache", Buffer::Pool::GetCachedCount(bytes) == cached);
+	if constexpr (Tester::CountsAllocations)
+		EXPECT("Buffer construction to make 0 allocations", construct.Allocations == 0);
+	Buffer::Buffer buf(vec_res1);
+	Tester::AllocationStats decode = Tester::CountAllocations([&buf]()
+	{
+		auto values = Buffer::Buffer::GetArguments<std::vector<int8_t>>(buf.GetData());
+		Tester::DoNotOptimize(values);
+	});
+	if constexpr (Tester::CountsAllocations)
+		EXPECT("decoding a std::vector<int8_t> to make 1 allocation", decode.Allocations == 1);
+);